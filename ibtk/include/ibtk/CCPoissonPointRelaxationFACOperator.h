@@ -85,6 +85,30 @@ namespace IBTK
  * By default, the class is configured to solve the Poisson problem \f$
  * -\nabla^2 u = f \f$, subject to homogeneous Dirichlet boundary conditions.
  *
+ * The smoothers are limited by memory bandwidth, and when \f$ C \f$ or \f$ D
+ * \f$ are variable, reading the coefficients accounts for a large part of the
+ * data moved by each sweep. Because the operator is only used as a
+ * preconditioner, the smoothers may instead use single precision copies of the
+ * variable coefficients; see setUseSinglePrecisionCoefficients(). The copies
+ * are made when the operator state is initialized and whenever the problem
+ * specification is set, so setPoissonSpecifications() must be called again
+ * after the coefficient values are changed in place.
+ *
+ * On levels with many small patches, the ghost cell fills that precede each
+ * sweep can cost more than the sweeps themselves. With red-black Gauss-Seidel
+ * smoothing, the smoothers may instead fill \f$ k \f$ layers of ghost cells
+ * once and then perform \f$ k \f$ half-sweeps without further communication;
+ * see setNumSweepsPerGhostFill(). For constant coefficient problems, patches
+ * whose ghost cell layers are covered by the level (or by its periodic images)
+ * also smooth a layer of ghost cells that shrinks by one cell per half-sweep.
+ * Since each red or black update uses only values of the other color, these
+ * patches compute the same values as the patches that own those cells, and if
+ * all patches of a level do this, the smoother gives the same results as with
+ * a ghost cell fill before each half-sweep. The remaining patches (e.g., those
+ * next to physical or coarse-fine boundaries) reuse the neighboring values
+ * obtained by the last ghost cell fill, which makes the smoother somewhat
+ * weaker.
+ *
  * Sample parameters for initialization from database (and their default
  * values): \verbatim
 
@@ -95,6 +119,8 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 1             // see setCoarseSolverMaxIterations()
+ use_single_precision_coefficients = FALSE    // see setUseSinglePrecisionCoefficients()
+ num_sweeps_per_ghost_fill = 1                // see setNumSweepsPerGhostFill()
  coarse_solver_db {                           // SAMRAI::tbox::Database for initializing coarse
  level solver
     solver_type = "PFMG"
@@ -151,6 +177,40 @@ public:
      */
     void setCoarseSolverType(const std::string& coarse_solver_type) override;
 
+    /*!
+     * \brief Specify whether the smoothers use single precision copies of the
+     * variable coefficients \f$ C \f$ and \f$ D \f$.
+     *
+     * \note This function has no effect for constant coefficient problems.
+     */
+    void setUseSinglePrecisionCoefficients(bool use_single_precision_coefficients);
+
+    /*!
+     * \brief Specify the number of smoother sweeps performed for each ghost
+     * cell fill, counting each red or black half-sweep as one sweep.
+     *
+     * \note With values larger than one, the smoothers act on copies of the
+     * error and residual that have this many layers of ghost cells. This
+     * requires the smoother type to be "RED_BLACK_GAUSS_SEIDEL". A point
+     * relaxation coarse level solver with a different ordering still fills
+     * ghost cells before each sweep.
+     *
+     * \note Only patches away from physical and coarse-fine boundaries of
+     * constant coefficient problems smooth their ghost cells. Other patches
+     * use stale values from their neighbors after the first sweep following
+     * each ghost cell fill, so the smoother differs from the one obtained with
+     * one sweep per ghost cell fill. A warning is printed for variable
+     * coefficient problems.
+     */
+    void setNumSweepsPerGhostFill(int num_sweeps_per_ghost_fill);
+
+    /*!
+     * \brief Specify the scalar Poisson problem and, if the operator state is
+     * initialized, refresh the single precision copies of the variable
+     * coefficients.
+     */
+    void setPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec) override;
+
     //\}
 
     /*!
@@ -250,12 +310,50 @@ private:
      */
     CCPoissonPointRelaxationFACOperator& operator=(const CCPoissonPointRelaxationFACOperator& that) = delete;
 
+    /*!
+     * \brief Fill the non-coarse-fine interface ghost cell values of the copy
+     * of the error with wide ghost cell layers and, optionally, of the
+     * corresponding copy of the residual.
+     */
+    void xeqScheduleWideGhostFill(int dst_ln, bool fill_residual);
+
+    /*!
+     * \brief Set the physical boundary ghost cell values of the copy of the
+     * error with wide ghost cell layers without filling any other ghost cells.
+     */
+    void setWidePhysicalBoundaryConditions(int dst_ln);
+
+    /*!
+     * \brief Copy the variable coefficients to their single precision copies
+     * on the specified levels, allocating the copies as needed.
+     */
+    void copyCoefficientsToSinglePrecision(int coarsest_ln, int finest_ln);
+
     /*
      * Coarse level solvers and solver parameters.
      */
     SAMRAI::tbox::Pointer<PoissonSolver> d_coarse_solver;
     SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> d_coarse_solver_db;
 
+    /*
+     * Single precision copies of the variable coefficients used by the
+     * smoothers.
+     */
+    bool d_use_single_precision_coefficients = false;
+    int d_C_sp_idx = IBTK::invalid_index, d_D_sp_idx = IBTK::invalid_index;
+
+    /*
+     * Copies of the error and residual with wide ghost cell layers, which are
+     * used to perform several sweeps for each ghost cell fill.
+     */
+    int d_num_sweeps_per_ghost_fill = 1;
+    int d_error_wide_idx = IBTK::invalid_index, d_residual_wide_idx = IBTK::invalid_index;
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > d_wide_ghostfill_refine_algorithm;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_wide_ghostfill_refine_schedules;
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > d_wide_error_ghostfill_refine_algorithm;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_wide_error_ghostfill_refine_schedules;
+    std::vector<std::vector<bool> > d_patch_smooths_ghost_cells;
+
     /*
      * Patch overlap data.
      */
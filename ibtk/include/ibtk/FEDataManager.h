@@ -22,11 +22,13 @@
 
 #ifdef IBTK_HAVE_LIBMESH
 
+#include "ibtk/FEMappingCache.h"
 #include "ibtk/QuadratureCache.h"
 #include "ibtk/SAMRAIDataCache.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "Box.h"
 #include "CellVariable.h"
 #include "IntVector.h"
 #include "PatchHierarchy.h"
@@ -222,6 +224,24 @@ public:
      */
     void clearPatchHierarchyDependentData();
 
+    /*!
+     * \brief Enable or disable the cache of reference configuration geometry
+     * of affine elements (see IBTK::FEGeometryCache) used by FEDataInterpolation
+     * objects set up with this object.
+     *
+     * Enabling the cache (re)computes it for the active local elements of the
+     * mesh, so this function should be called again when the mesh is
+     * repartitioned. The reference configuration (i.e., the node locations of
+     * the libMesh mesh) must not change while the cache is enabled.
+     */
+    void setUseGeometryCache(bool use_geometry_cache);
+
+    /*!
+     * \return A pointer to the reference configuration geometry cache or
+     * nullptr if it is not in use.
+     */
+    const FEGeometryCache* getGeometryCache() const;
+
 protected:
     /*!
      * The object name is used as a handle to databases stored in restart files
@@ -256,6 +276,12 @@ protected:
      */
     std::map<std::pair<unsigned int, libMesh::FEType>, std::unique_ptr<SystemDofMapCache> > d_system_dof_map_cache;
 
+    /*!
+     * Cache of the reference configuration geometry of affine elements, if in
+     * use.
+     */
+    std::unique_ptr<FEGeometryCache> d_geometry_cache;
+
     /**
      * Permit FEDataManager to directly examine the internals of this class.
      */
@@ -529,6 +555,33 @@ public:
         double duplicated_node_weight = 0.0;
     };
 
+    /*!
+     * \brief Enumeration ElementSubset selects which of the active elements
+     * of each patch are processed by spread() and interpWeighted().
+     *
+     * An element is local if all of the degrees of freedom that it reads from
+     * the input vectors are owned by the current processor. Local elements may
+     * hence be processed while the ghost values of the input vectors are still
+     * being communicated, e.g.,
+     * @code
+     * batch_vec_ghost_update_begin(vecs, INSERT_VALUES, SCATTER_FORWARD);
+     * fe_data_manager->spread(f_data_idx, F, X, system_name, spread_spec, FEDataManager::LOCAL_ELEMS);
+     * batch_vec_ghost_update_end(vecs, INSERT_VALUES, SCATTER_FORWARD);
+     * fe_data_manager->spread(f_data_idx, F, X, system_name, spread_spec, FEDataManager::NONLOCAL_ELEMS);
+     * @endcode
+     * Processing LOCAL_ELEMS and then NONLOCAL_ELEMS gives the same result as
+     * ALL_ELEMS up to roundoff.
+     *
+     * @note When nodal quadrature is used, all work is done when processing
+     * NONLOCAL_ELEMS.
+     */
+    enum ElementSubset
+    {
+        ALL_ELEMS,
+        LOCAL_ELEMS,
+        NONLOCAL_ELEMS
+    };
+
 protected:
     /*!
      * FEData object that contains the libMesh data structures.
@@ -734,6 +787,22 @@ public:
      */
     void reinitElementMappings();
 
+    /*!
+     * \brief Update the mappings from elements to Cartesian grid patches after
+     * the structure has moved but the patch hierarchy has not changed.
+     *
+     * Only elements whose bounding boxes cover a different set of cells than
+     * they did at the last association are reassociated with patches: the
+     * associations of all other elements are reused. If no element changed
+     * cells then all cached ghost data is kept as well.
+     *
+     * @note This function falls back to reinitElementMappings() if elements
+     * have not yet been associated with the current patch hierarchy. Since it
+     * cannot, in general, detect that the patch hierarchy has been regridded,
+     * reinitElementMappings() must be called after every regrid.
+     */
+    void updateElementMappings();
+
     /*!
      * \return A pointer to the unghosted solution vector associated with the
      * specified system.
@@ -810,9 +879,13 @@ public:
      * position of the mesh.
      * @param[in] system_name name of the system corresponding to @p F.
      *
+     * @param[in] elem_subset Which elements of each patch to spread from. See
+     * the documentation of ElementSubset.
+     *
      * Both @p X and @p F should contain ghost values corresponding to the IB
      * partitioning of the Lagrangian data, i.e., vectors returned from
-     * buildIBGhostedVector.
+     * buildIBGhostedVector. Only the locally owned values are read when @p
+     * elem_subset is LOCAL_ELEMS.
      *
      * @note This function may spread forces from points near the physical
      * boundary into ghost cells outside the physical domain. To account for
@@ -824,7 +897,8 @@ public:
                 libMesh::NumericVector<double>& F,
                 libMesh::NumericVector<double>& X,
                 const std::string& system_name,
-                const SpreadSpec& spread_spec);
+                const SpreadSpec& spread_spec,
+                ElementSubset elem_subset = ALL_ELEMS);
 
     /*!
      * \brief Spread a density from the FE mesh to the Cartesian grid using
@@ -941,6 +1015,13 @@ public:
      * an L2-projection of the interpolated quantity. It does however weighs/filters
      * the interpolated quantity at the quadrature points to the nodes. Here, the
      * basis functions of the deformational field is used as the filter.
+     *
+     * The elements of each patch that are processed are selected by @p
+     * elem_subset: see the documentation of ElementSubset. @p F is zeroed
+     * unless @p elem_subset is NONLOCAL_ELEMS, in which case values are added
+     * to those computed for LOCAL_ELEMS. When processing LOCAL_ELEMS, only the
+     * locally owned values of @p X are read and both @p close_F and @p close_X
+     * should be false.
      */
     void
     interpWeighted(int f_data_idx,
@@ -952,7 +1033,8 @@ public:
                        std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >(),
                    double fill_data_time = 0.0,
                    bool close_F = true,
-                   bool close_X = true);
+                   bool close_X = true,
+                   ElementSubset elem_subset = ALL_ELEMS);
 
     /*!
      * \brief Interpolate a value from the Cartesian grid to the FE mesh using
@@ -1213,11 +1295,16 @@ private:
      *
      * In this method, the determination as to whether an element is local or
      * not is based on the position of the bounding box of the element.
+     *
+     * If @p elem_index_boxes is not <code>nullptr</code> then it is set to the
+     * boxes of cell indices on level @p level_number covered by the bounding
+     * boxes of all elements, in the order of the mesh's element iterators.
      */
     void collectActivePatchElements(std::vector<std::vector<libMesh::Elem*> >& active_patch_elems,
                                     int level_number,
                                     int coarsest_elem_ln,
-                                    int finest_elem_ln);
+                                    int finest_elem_ln,
+                                    std::vector<SAMRAI::hier::Box<NDIM> >* elem_index_boxes = nullptr);
 
     /*!
      * Collect all of the nodes of the active elements that are located within a
@@ -1248,6 +1335,12 @@ private:
      */
     void reinitializeIBGhostedDOFs(const std::string& system_name);
 
+    /*!
+     * Check that all active nodes are inside some patch (or outside the
+     * computational domain) and respond as specified by d_node_patch_check.
+     */
+    void checkActivePatchNodes();
+
     /*!
      * Read object state from the restart file and initialize class data
      * members.  The database from which the restart data is read is determined
@@ -1364,6 +1457,15 @@ private:
     std::map<std::string, std::vector<unsigned int> > d_active_patch_ghost_dofs;
     std::vector<libMesh::Elem*> d_active_elems;
 
+    /*!
+     * Boxes of cell indices covered by the bounding boxes of all elements at
+     * the time of the last association, indexed first by level number and
+     * then by position in the mesh's element ordering. These are used by
+     * updateElementMappings() to find the elements that need to be
+     * reassociated with patches.
+     */
+    std::vector<std::vector<SAMRAI::hier::Box<NDIM> > > d_active_elem_index_boxes;
+
     /*!
      * Ghost vectors for the various equation systems.
      */
@@ -29,11 +29,15 @@
 #include <libmesh/enum_elem_type.h>
 #include <libmesh/enum_order.h>
 #include <libmesh/enum_quadrature_type.h>
+#include <libmesh/id_types.h>
 #include <libmesh/quadrature.h>
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <tuple>
+#include <unordered_map>
+#include <vector>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -130,6 +134,110 @@ FEMappingCache<dim, spacedim>::operator[](const FEMappingCache<dim, spacedim>::k
     }
 }
 
+/**
+ * \brief Class storing the reference configuration geometry of affine
+ * elements.
+ *
+ * The reference configuration of a Lagrangian mesh does not change during a
+ * simulation, so for affine elements (TRI3 and TET4 elements as well as QUAD4
+ * and HEX8 elements which are parallelograms or parallelepipeds) the mapping
+ * from the reference element only needs to be computed once. This class
+ * computes and stores, for each affine element, the affine map
+ * \f$ x = x_0 + J \hat{x} \f$ along with the covariant matrix (the inverse
+ * transpose of \f$ J \f$) and the Jacobian determinant. These quantities are
+ * independent of the quadrature rule, so one instance of this class can be
+ * shared by all IBTK::FEValues objects associated with a mesh: see
+ * IBTK::FEData::setUseGeometryCache().
+ *
+ * All data is stored in a single contiguous array. Each entry contains, in
+ * order,
+ * - \f$ x_0 \f$ (spacedim values),
+ * - \f$ J \f$ (spacedim x dim values, column-major),
+ * - the covariant matrix (spacedim x dim values, column-major),
+ * - the Jacobian determinant (one value).
+ *
+ * @note Elements that are not affine are not stored and must be handled by
+ * the usual mapping classes.
+ *
+ * @note Adding elements is not thread-safe, but looking elements up is.
+ */
+class FEGeometryCache
+{
+public:
+    /**
+     * Constructor.
+     */
+    FEGeometryCache(int dim, int spacedim);
+
+    /**
+     * Clear the cache and then add every active local element of @p mesh.
+     * The storage is allocated once for all of these elements.
+     */
+    void reinit(const libMesh::MeshBase& mesh);
+
+    /**
+     * Add an element to the cache. Returns whether or not the element is
+     * stored, i.e., whether or not it is affine.
+     */
+    bool addElement(const libMesh::Elem* elem);
+
+    /**
+     * Return a pointer to the beginning of the entry for the given element or
+     * nullptr if the element is not stored.
+     */
+    const double* getAffineMapData(const libMesh::Elem* elem) const;
+
+    /**
+     * Clear the cache.
+     */
+    void clear();
+
+    /**
+     * Return the number of stored elements.
+     */
+    std::size_t size() const
+    {
+        return d_offsets.size();
+    }
+
+    /**
+     * Return the dimension of the stored elements.
+     */
+    int getDimension() const
+    {
+        return d_dim;
+    }
+
+    /**
+     * Return the spatial dimension of the stored elements.
+     */
+    int getSpatialDimension() const
+    {
+        return d_spacedim;
+    }
+
+protected:
+    /**
+     * Element dimension and spatial dimension.
+     */
+    const int d_dim, d_spacedim;
+
+    /**
+     * Number of doubles stored for each element.
+     */
+    const std::size_t d_entry_size;
+
+    /**
+     * Offsets into d_data, indexed by element id.
+     */
+    std::unordered_map<libMesh::dof_id_type, std::size_t> d_offsets;
+
+    /**
+     * Geometric data of all stored elements.
+     */
+    std::vector<double> d_data;
+};
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
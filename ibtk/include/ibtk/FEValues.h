@@ -42,6 +42,8 @@
 
 namespace IBTK
 {
+class FEGeometryCache;
+
 /**
  * Class defining the interface to FEValues in a dimension-independent way to
  * improve compatibility with libMesh.
@@ -73,6 +75,17 @@ public:
         return d_shape_gradients;
     }
 
+    /**
+     * Use the reference configuration geometry stored in @p geometry_cache for
+     * the elements it contains instead of recomputing the mapping from the
+     * element's nodes. Elements not stored in the cache are handled as usual.
+     * The cache must outlive this object; passing nullptr disables it.
+     */
+    inline void setGeometryCache(const FEGeometryCache* geometry_cache)
+    {
+        d_geometry_cache = geometry_cache;
+    }
+
     static std::unique_ptr<FEValuesBase> build(const int dim,
                                                const int spacedim,
                                                libMesh::QBase* qrule,
@@ -87,6 +100,8 @@ protected:
     std::vector<std::vector<double> > d_shape_values;
 
     std::vector<std::vector<libMesh::VectorValue<double> > > d_shape_gradients;
+
+    const FEGeometryCache* d_geometry_cache = nullptr;
 };
 
 /**
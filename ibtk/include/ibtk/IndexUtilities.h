@@ -30,6 +30,7 @@
 #include "IntVector.h"
 #include "Patch.h"
 
+#include <cstdint>
 #include <functional>
 #include <vector>
 
@@ -280,6 +281,21 @@ public:
                       const int offset = 0,
                       const SAMRAI::hier::IntVector<NDIM>& periodic_shift = SAMRAI::hier::IntVector<NDIM>(0));
 
+    /*!
+     * \brief Map a cell index to its position along a Morton (Z-order) curve.
+     *
+     * The bits of the components of <code>i - lower</code> are interleaved, so
+     * cells which are close in index space usually have nearby keys. At most
+     * 64 / NDIM bits of each component are used.
+     *
+     * \param i Cell index. Each component must be at least as large as the
+     * corresponding component of \em lower.
+     *
+     * \param lower Origin of the curve, e.g., the lower corner of a patch's
+     * ghost box.
+     */
+    static std::uint64_t getMortonIndex(const SAMRAI::hier::Index<NDIM>& i, const SAMRAI::hier::Index<NDIM>& lower);
+
     /*!
      * \brief Partition a patch box into subdomains of size \em box_size
      * and into equal number of overlapping subdomains whose overlap region
@@ -263,6 +263,54 @@ public:
      */
     const SAMRAI::hier::IntVector<NDIM>& getGhostCellWidth() const;
 
+    /*!
+     * \brief Set whether or not the local nodes of each patch are renumbered
+     * along a Morton (Z-order) curve through the cells of the patch whenever
+     * data are redistributed.
+     *
+     * With this ordering, nodes which are close in space usually have nearby
+     * local PETSc indices, so that the LData storage is read nearly
+     * sequentially during interpolation and spreading. The Lagrangian indices
+     * of the nodes are not changed. The ordering is first applied by the
+     * redistribution following the call to this function.
+     */
+    void setUseMortonOrdering(bool use_morton_ordering);
+
+    /*!
+     * \brief Return whether or not local nodes are renumbered along a Morton
+     * curve whenever data are redistributed.
+     */
+    bool getUseMortonOrdering() const;
+
+    /*!
+     * \brief Set whether or not Lagrangian data are redistributed incrementally.
+     *
+     * Incremental redistribution only applies to levels on which no node has
+     * changed processors since the previous redistribution. On such a level
+     * the local nodes keep their PETSc ordering, the existing AO is reused, no
+     * data are scattered, and the LData vectors are replaced only if the set
+     * of nonlocal (ghost) nodes has changed. Nonlocal nodes keep their
+     * relative order, so the ghost index set changes only where nodes have
+     * entered or left the ghost cell regions.
+     *
+     * A full redistribution is performed on every level on which any node has
+     * changed processors, and on levels with displaced structures. A PETSc AO
+     * cannot be modified in place, and any migration changes the PETSc
+     * indices of the nodes on all processors that follow, so nothing is saved
+     * by preserving the ordering in that case.
+     *
+     * \note Because the ordering is kept, nodes that move between cells or
+     * patches of the same processor do not regain the Morton ordering (if
+     * enabled) until the next full redistribution.
+     */
+    void setUseIncrementalRedistribution(bool use_incremental_redistribution);
+
+    /*!
+     * \brief Return whether or not Lagrangian data are redistributed
+     * incrementally.
+     */
+    bool getUseIncrementalRedistribution() const;
+
     /*!
      * \brief Return the default kernel function associated with the
      * Eulerian-to-Lagrangian interpolation scheme.
@@ -543,6 +591,64 @@ public:
                 int coarsest_ln = invalid_level_number,
                 int finest_ln = invalid_level_number);
 
+    /*!
+     * \brief Spread several quantities from the Lagrangian mesh to the
+     * Eulerian grid using the default spreading kernel function.
+     *
+     * Each entry of f_F_data pairs an Eulerian patch data index with the
+     * level-indexed Lagrangian data to spread into it.  All of the quantities
+     * are spread in a single traversal of the patch hierarchy, so the
+     * Lagrangian index lists and, if the LEInteractor weight cache is enabled,
+     * the delta-function weights are computed once per patch and reused by
+     * every quantity.  The Lagrangian ghost node updates are started together
+     * for all quantities.
+     *
+     * f_phys_bdry_ops must either be empty or have one entry (possibly null)
+     * per quantity, and f_prolongation_scheds must either be empty or have one
+     * entry per quantity.
+     *
+     * \see spread()
+     */
+    void spread(const std::vector<std::pair<int, std::vector<SAMRAI::tbox::Pointer<LData> > > >& f_F_data,
+                std::vector<SAMRAI::tbox::Pointer<LData> >& X_data,
+                const std::vector<RobinPhysBdryPatchStrategy*>& f_phys_bdry_ops,
+                const std::vector<std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > >&
+                    f_prolongation_scheds =
+                        std::vector<std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > >(),
+                double fill_data_time = 0.0,
+                bool F_data_ghost_node_update = true,
+                bool X_data_ghost_node_update = true,
+                int coarsest_ln = invalid_level_number,
+                int finest_ln = invalid_level_number);
+
+    /*!
+     * \brief Interpolate several quantities from the Eulerian grid to the
+     * Lagrangian mesh using the default interpolation kernel function.
+     *
+     * Each entry of f_F_data pairs an Eulerian patch data index with the
+     * level-indexed Lagrangian data to interpolate into.  All of the
+     * quantities are interpolated in a single traversal of the patch
+     * hierarchy, so the Lagrangian index lists and, if the LEInteractor weight
+     * cache is enabled, the delta-function weights are computed once per patch
+     * and reused by every quantity.
+     *
+     * f_synch_scheds and f_ghost_fill_scheds must either be empty or have one
+     * entry per quantity.
+     *
+     * \see interp()
+     */
+    void interp(const std::vector<std::pair<int, std::vector<SAMRAI::tbox::Pointer<LData> > > >& f_F_data,
+                std::vector<SAMRAI::tbox::Pointer<LData> >& X_data,
+                const std::vector<std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > > >&
+                    f_synch_scheds =
+                        std::vector<std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > > >(),
+                const std::vector<std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > >&
+                    f_ghost_fill_scheds =
+                        std::vector<std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > >(),
+                double fill_data_time = 0.0,
+                int coarsest_ln = invalid_level_number,
+                int finest_ln = invalid_level_number);
+
     /*!
      * Register a concrete strategy object with the integrator that specifies
      * the initial configuration of the curvilinear mesh nodes.
@@ -1089,7 +1195,17 @@ private:
                                  std::vector<int>& nonlocal_petsc_indices,
                                  unsigned int& num_nodes,
                                  unsigned int& node_offset,
-                                 int level_number);
+                                 int level_number,
+                                 bool preserve_ordering = false);
+
+    /*!
+     * Determine the total number of nodes on the specified level that are
+     * owned by a different processor than before the current redistribution.
+     *
+     * \note This must be called after the index patch data have been updated
+     * but before the new node distribution has been computed.
+     */
+    int computeNumberOfMigratedNodes(int level_number) const;
 
     /*!
      * Determine the number of local Lagrangian nodes on all MPI processes with
@@ -1204,6 +1320,18 @@ private:
      */
     bool d_error_if_points_leave_domain;
 
+    /*
+     * Whether to renumber local nodes along a Morton curve when data are
+     * redistributed.
+     */
+    bool d_use_morton_ordering = false;
+
+    /*
+     * Whether to redistribute data incrementally on levels where no node has
+     * changed processors.
+     */
+    bool d_use_incremental_redistribution = false;
+
     /*
      * SAMRAI::hier::IntVector object that determines the ghost cell width of
      * the LNodeData SAMRAI::hier::PatchData objects.
@@ -25,7 +25,9 @@
 #include "tbox/Pointer.h"
 
 #include <array>
+#include <cstddef>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace IBTK
@@ -40,6 +42,8 @@ namespace hier
 {
 template <int DIM>
 class Patch;
+template <int DIM>
+class PatchData;
 } // namespace hier
 namespace pdat
 {
@@ -80,6 +84,42 @@ public:
 
     /*!
      * \brief Set configuration options from a user-supplied database.
+     *
+     * The following keys are read from the database:
+     * <ul>
+     * <li><code>use_threaded_spreading</code>: If true, the Lagrangian points
+     * of each patch are sorted into tiles which are colored so that the kernel
+     * footprints of points in distinct tiles of the same color do not overlap.
+     * Tiles of the same color are then spread concurrently. Defaults to
+     * false.</li>
+     * <li><code>use_threaded_interpolation</code>: If true, the Lagrangian
+     * points of each patch are split into contiguous batches which are
+     * interpolated concurrently. FEDataManager::interpWeighted() also uses
+     * this setting to compute quadrature point positions and element
+     * right-hand sides concurrently. Defaults to false.</li>
+     * <li><code>num_threads</code>: Number of threads used by the threaded
+     * routines. A nonpositive value uses the OpenMP default. Defaults to
+     * 0.</li>
+     * <li><code>use_weight_cache</code>: If true, the stencils and
+     * one-dimensional delta function weights of the Lagrangian points are
+     * cached by the interpolation and spreading routines that take
+     * LIndexSetData arguments so that subsequent operations at the same
+     * positions reuse them. Cached weights are recomputed whenever the
+     * position of a point changes. Only the PIECEWISE_LINEAR, IB_3 through
+     * IB_6 (excluding IB_4_W8), and BSPLINE_3 through BSPLINE_6 kernels use
+     * the cache. Defaults to false.</li>
+     * <li><code>use_templated_kernels</code>: If true, the PIECEWISE_LINEAR,
+     * IB_3 through IB_6 (excluding IB_4_W8), and BSPLINE_3 through BSPLINE_6
+     * kernels are applied by the header-only C++ implementations in
+     * LEInteractorKernels.h instead of the Fortran ones. The results agree up
+     * to roundoff. The remaining kernels always use the Fortran
+     * implementations. When <code>use_weight_cache</code> is also true, the
+     * cached weights take precedence: operations that use the cache never
+     * evaluate the templated kernels. Defaults to false.</li>
+     * </ul>
+     *
+     * \note Threading requires that IBAMR be compiled with OpenMP. Otherwise
+     * the threaded routines fall back to a single thread.
      */
     static void setFromDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
@@ -88,6 +128,39 @@ public:
      */
     static void printClassData(std::ostream& os);
 
+    /*!
+     * \brief Return the number of threads used by the threaded interaction
+     * routines. This is always one if IBAMR was compiled without OpenMP.
+     */
+    static int getNumThreads();
+
+    /*!
+     * \brief Return whether or not interpolation is done concurrently over
+     * batches of Lagrangian points.
+     */
+    static bool getUseThreadedInterpolation();
+
+    /*!
+     * \brief Free all cached delta function weights.
+     *
+     * \note Cached weights are validated against the current positions of
+     * the Lagrangian points, so this is only needed to release memory (e.g.,
+     * after the Lagrangian data are redistributed).
+     */
+    static void clearWeightCache();
+
+    /*!
+     * \brief Return the number of Lagrangian point evaluations that reused
+     * cached delta function weights since the cache was last cleared.
+     */
+    static std::size_t getNumberOfWeightCacheHits();
+
+    /*!
+     * \brief Return the number of Lagrangian point evaluations that computed
+     * and cached delta function weights since the cache was last cleared.
+     */
+    static std::size_t getNumberOfWeightCacheMisses();
+
     /*!
      * \brief Returns the interpolation/spreading stencil corresponding to the
      * specified kernel function.
@@ -212,6 +285,30 @@ public:
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Interpolate several quantities from an Eulerian grid to a
+     * Lagrangian mesh.  The positions of the nodes of the Lagrangian mesh are
+     * specified by X_data.
+     *
+     * Each entry of q_Q_data pairs the cell-, node-, side-, or edge-centered
+     * Eulerian data to interpolate with the LData object that stores the
+     * interpolated values.  The Lagrangian nodes within interp_box are
+     * determined only once, and, for kernels supported by the weight cache,
+     * the delta function weights are computed once for each data centering
+     * and shared by all quantities.  If the weight cache is disabled (see
+     * setFromDatabase()), these weights are discarded at the end of the call.
+     */
+    template <class T>
+    static void interpolate(
+        const std::vector<std::pair<SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> >,
+                                    SAMRAI::tbox::Pointer<LData> > >& q_Q_data,
+        SAMRAI::tbox::Pointer<LData> X_data,
+        SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data,
+        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+        const SAMRAI::hier::Box<NDIM>& interp_box,
+        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+        const std::string& interp_fcn = "IB_4");
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -735,6 +832,33 @@ public:
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Spread several quantities from a Lagrangian mesh to an Eulerian
+     * grid.  The positions of the nodes of the Lagrangian mesh are specified
+     * by X_data.
+     *
+     * Each entry of q_Q_data pairs the cell-, node-, side-, or edge-centered
+     * Eulerian data that are spread to with the LData object that stores the
+     * values to spread.  The Lagrangian nodes within spread_box are
+     * determined only once, and, for kernels supported by the weight cache,
+     * the delta function weights are computed once for each data centering
+     * and shared by all quantities.  If the weight cache is disabled (see
+     * setFromDatabase()), these weights are discarded at the end of the call.
+     *
+     * \note As with the other spread() functions that take LData arguments,
+     * this spreads values, NOT densities.
+     */
+    template <class T>
+    static void
+    spread(const std::vector<std::pair<SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> >,
+                                       SAMRAI::tbox::Pointer<LData> > >& q_Q_data,
+           SAMRAI::tbox::Pointer<LData> X_data,
+           SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data,
+           SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+           const SAMRAI::hier::Box<NDIM>& spread_box,
+           const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+           const std::string& spread_fcn = "IB_4");
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -1231,7 +1355,9 @@ private:
     LEInteractor& operator=(const LEInteractor& that) = delete;
 
     /*!
-     * Implementation of the IB interpolation operation.
+     * Implementation of the IB interpolation operation. If use_weight_cache is true,
+     * the cached weights associated with X_data are used for the kernels
+     * that support caching.
      */
     static void interpolate(double* Q_data,
                             int Q_depth,
@@ -1248,10 +1374,33 @@ private:
                             const std::vector<int>& local_indices,
                             const std::vector<double>& periodic_shifts,
                             const std::string& interp_fcn,
-                            int axis = 0);
+                            int axis = 0,
+                            bool use_weight_cache = false);
+
+    /*!
+     * Apply the IB interpolation kernel to the num_local_indices points listed
+     * in local_indices.
+     */
+    static void interpolateKernel(double* Q_data,
+                                  int Q_depth,
+                                  const double* X_data,
+                                  const double* q_data,
+                                  const SAMRAI::hier::Box<NDIM>& q_data_box,
+                                  const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                                  int q_depth,
+                                  const double* x_lower,
+                                  const double* x_upper,
+                                  const double* dx,
+                                  const int* local_indices,
+                                  const double* periodic_shifts,
+                                  int num_local_indices,
+                                  const std::string& interp_fcn,
+                                  int axis);
 
     /*!
-     * Implementation of the IB spreading operation.
+     * Implementation of the IB spreading operation. If use_weight_cache is true,
+     * the cached weights associated with X_data are used for the kernels
+     * that support caching.
      */
     static void spread(double* q_data,
                        const SAMRAI::hier::Box<NDIM>& q_data_box,
@@ -1268,7 +1417,56 @@ private:
                        const std::vector<int>& local_indices,
                        const std::vector<double>& periodic_shifts,
                        const std::string& spread_fcn,
-                       int axis = 0);
+                       int axis = 0,
+                       bool use_weight_cache = false);
+
+    /*!
+     * Apply the IB spreading kernel to the num_local_indices points listed in
+     * local_indices.
+     */
+    static void spreadKernel(double* q_data,
+                             const SAMRAI::hier::Box<NDIM>& q_data_box,
+                             const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                             int q_depth,
+                             const double* Q_data,
+                             int Q_depth,
+                             const double* X_data,
+                             const double* x_lower,
+                             const double* x_upper,
+                             const double* dx,
+                             const int* local_indices,
+                             const double* periodic_shifts,
+                             int num_local_indices,
+                             const std::string& spread_fcn,
+                             int axis);
+
+    /*!
+     * Interpolate cell-, node-, side-, or edge-centered data at the points
+     * listed in local_indices.
+     */
+    static void interpolateField(double* Q_data,
+                                 int Q_depth,
+                                 const double* X_data,
+                                 SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> > q_data,
+                                 SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                 const std::vector<int>& local_indices,
+                                 const std::vector<double>& periodic_shifts,
+                                 const std::string& interp_fcn,
+                                 bool use_weight_cache);
+
+    /*!
+     * Spread values at the points listed in local_indices to cell-, node-,
+     * side-, or edge-centered data.
+     */
+    static void spreadField(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> > q_data,
+                            const double* Q_data,
+                            int Q_depth,
+                            const double* X_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const std::vector<int>& local_indices,
+                            const std::vector<double>& periodic_shifts,
+                            const std::string& spread_fcn,
+                            bool use_weight_cache);
 
     /*!
      * \brief Compute the local PETSc indices located within the provided box
@@ -1327,6 +1525,34 @@ private:
                                   const int* local_indices,
                                   const double* X_shift,
                                   int num_local_indices);
+
+    /*!
+     * Number of threads used by the threaded interaction routines.
+     */
+    static int s_num_threads;
+
+    /*!
+     * Whether or not spreading is done concurrently over colored tiles of
+     * Lagrangian points.
+     */
+    static bool s_use_threaded_spreading;
+
+    /*!
+     * Whether or not interpolation is done concurrently over batches of
+     * Lagrangian points.
+     */
+    static bool s_use_threaded_interpolation;
+
+    /*!
+     * Whether or not delta function weights are cached.
+     */
+    static bool s_use_weight_cache;
+
+    /*!
+     * Whether or not to use the templated C++ kernels in place of the Fortran
+     * ones when they are available.
+     */
+    static bool s_use_templated_kernels;
 };
 } // namespace IBTK
 
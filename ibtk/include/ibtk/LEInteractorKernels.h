@@ -0,0 +1,536 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_LEInteractorKernels
+#define included_IBTK_LEInteractorKernels
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include <algorithm>
+#include <cmath>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+/*!
+ * \brief Namespace LEInteractorKernels provides header-only C++
+ * implementations of the tensor-product interpolation and spreading kernels
+ * used by class LEInteractor.
+ *
+ * Each kernel is described by a small class providing the stencil width as a
+ * compile-time constant and a function that computes the one-dimensional
+ * weights. The interpolation and spreading loops are templated on the kernel,
+ * the spatial dimension, and the data depth, so that the compiler sees fixed
+ * trip counts and can vectorize over the (contiguous) innermost stencil
+ * direction.
+ *
+ * All of the routines use the same conventions as the Fortran kernels: the
+ * Eulerian data are stored in SAMRAI's (Fortran) ordering on the ghost box of
+ * the patch data, the components of vector-valued data are stored one after
+ * another, and the data centering is accounted for by the values of x_lower
+ * and the index box (e.g., node-centered data use a node box and an x_lower
+ * shifted by half a grid cell).
+ *
+ * New kernels may be added by writing a class with the same interface as
+ * IB4Kernel.
+ */
+namespace IBTK
+{
+namespace LEInteractorKernels
+{
+/*!
+ * \brief Round to the nearest integer, with halfway cases rounded away from
+ * zero (i.e., Fortran's NINT).
+ */
+inline int
+nint(const double a)
+{
+    return a >= 0.0 ? static_cast<int>(a + 0.5) : static_cast<int>(a - 0.5);
+}
+
+/*!
+ * \brief Determine the index of the cell containing the point X_o_dx (which
+ * is measured in units of the grid spacing relative to x_lower).
+ */
+inline int
+cell_index(const double X_o_dx, const int ilower)
+{
+    return static_cast<int>(std::floor(X_o_dx)) + ilower;
+}
+
+/*!
+ * \brief The piecewise linear (2-point) kernel.
+ */
+struct PiecewiseLinearKernel
+{
+    static constexpr int width = 2;
+
+    static inline void
+    weights(int& ic_lower,
+            double* const w,
+            const double X,
+            const double X_shift,
+            const double x_lower,
+            const int ilower,
+            const double dx)
+    {
+        const double X_shifted = X + X_shift;
+        const int ic_center = ilower + nint((X_shifted - x_lower) / dx - 0.5);
+        const double X_cell = x_lower + (static_cast<double>(ic_center - ilower) + 0.5) * dx;
+        if (X_shifted < X_cell)
+        {
+            ic_lower = ic_center - 1;
+            w[0] = (X_cell - X_shifted) / dx;
+        }
+        else
+        {
+            ic_lower = ic_center;
+            w[0] = 1.0 + (X_cell - X_shifted) / dx;
+        }
+        w[1] = 1.0 - w[0];
+        return;
+    }
+};
+
+/*!
+ * \brief The IB 3-point kernel.
+ */
+struct IB3Kernel
+{
+    static constexpr int width = 3;
+
+    static inline double
+    delta(double r)
+    {
+        r = std::abs(r);
+        if (r < 0.5) return (1.0 / 3.0) * (1.0 + std::sqrt(1.0 - 3.0 * r * r));
+        if (r < 1.5) return (1.0 / 6.0) * (5.0 - 3.0 * r - std::sqrt(1.0 - 3.0 * (1.0 - r) * (1.0 - r)));
+        return 0.0;
+    }
+
+    static inline void
+    weights(int& ic_lower,
+            double* const w,
+            const double X,
+            const double X_shift,
+            const double x_lower,
+            const int ilower,
+            const double dx)
+    {
+        const double X_shifted = X + X_shift;
+        ic_lower = cell_index((X_shifted - x_lower) / dx, ilower) - 1;
+        for (int i = 0; i < width; ++i)
+        {
+            const double X_cell = x_lower + (static_cast<double>(ic_lower + i - ilower) + 0.5) * dx;
+            w[i] = delta((X_shifted - X_cell) / dx);
+        }
+        return;
+    }
+};
+
+/*!
+ * \brief The IB 4-point kernel.
+ */
+struct IB4Kernel
+{
+    static constexpr int width = 4;
+
+    static inline void
+    weights(int& ic_lower,
+            double* const w,
+            const double X,
+            const double X_shift,
+            const double x_lower,
+            const int ilower,
+            const double dx)
+    {
+        const double X_o_dx = (X + X_shift - x_lower) / dx;
+        ic_lower = nint(X_o_dx) + ilower - 2;
+        const double r = X_o_dx - ((ic_lower + 1 - ilower) + 0.5);
+        const double q = std::sqrt(1.0 + 4.0 * r * (1.0 - r));
+        w[0] = 0.125 * (3.0 - 2.0 * r - q);
+        w[1] = 0.125 * (3.0 - 2.0 * r + q);
+        w[2] = 0.125 * (1.0 + 2.0 * r + q);
+        w[3] = 0.125 * (1.0 + 2.0 * r - q);
+        return;
+    }
+};
+
+/*!
+ * \brief The IB 5-point kernel with three continuous derivatives.
+ */
+struct IB5Kernel
+{
+    static constexpr int width = 5;
+
+    static inline void
+    weights(int& ic_lower,
+            double* const w,
+            const double X,
+            const double X_shift,
+            const double x_lower,
+            const int ilower,
+            const double dx)
+    {
+        static const double K = (38.0 - std::sqrt(69.0)) / 60.0;
+        const double X_shifted = X + X_shift;
+        const int ic_center = cell_index((X_shifted - x_lower) / dx, ilower);
+        ic_lower = ic_center - 2;
+        const double X_cell = x_lower + (static_cast<double>(ic_center - ilower) + 0.5) * dx;
+        const double r = (X_shifted - X_cell) / dx;
+        const double r2 = r * r;
+        const double r3 = r2 * r;
+        const double r4 = r2 * r2;
+        const double phi = (136.0 - 40.0 * K - 40.0 * r2 +
+                            std::sqrt(2.0) * std::sqrt(3123.0 - 6840.0 * K + 3600.0 * K * K - 12440.0 * r2 +
+                                                       25680.0 * K * r2 - 12600.0 * K * K * r2 + 8080.0 * r4 -
+                                                       8400.0 * K * r4 - 1400.0 * r4 * r2)) /
+                           280.0;
+        w[0] = (1.0 / 12.0) * (-2.0 + 2.0 * phi + 2.0 * K + r - 3.0 * K * r + 2.0 * r2 - r3);
+        w[1] = (1.0 / 6.0) * (4.0 - 4.0 * phi - K - 4.0 * r + 3.0 * K * r - r2 + r3);
+        w[2] = phi;
+        w[3] = (1.0 / 6.0) * (4.0 - 4.0 * phi - K + 4.0 * r - 3.0 * K * r - r2 - r3);
+        w[4] = (1.0 / 12.0) * (-2.0 + 2.0 * phi + 2.0 * K - r + 3.0 * K * r + 2.0 * r2 + r3);
+        return;
+    }
+};
+
+/*!
+ * \brief The IB 6-point kernel.
+ */
+struct IB6Kernel
+{
+    static constexpr int width = 6;
+
+    static inline void
+    weights(int& ic_lower,
+            double* const w,
+            const double X,
+            const double X_shift,
+            const double x_lower,
+            const int ilower,
+            const double dx)
+    {
+        static const double K = (59.0 / 60.0) * (1.0 - std::sqrt(1.0 - (3220.0 / 3481.0)));
+        const double X_o_dx = (X + X_shift - x_lower) / dx;
+        ic_lower = nint(X_o_dx) + ilower - 3;
+        const double r = 1.0 - X_o_dx + ((ic_lower + 2 - ilower) + 0.5);
+        const double r2 = r * r;
+        const double r3 = r2 * r;
+        const double alpha = 28.0;
+        const double beta = (9.0 / 4.0) - (3.0 / 2.0) * (K + r2) + ((22.0 / 3.0) - 7.0 * K) * r - (7.0 / 3.0) * r3;
+        const double gamma = 0.25 * (((161.0 / 36.0) - (59.0 / 6.0) * K + 5.0 * K * K) * 0.5 * r2 +
+                                     (-(109.0 / 24.0) + 5.0 * K) * (1.0 / 3.0) * r2 * r2 + (5.0 / 18.0) * r3 * r3);
+        const double discr = beta * beta - 4.0 * alpha * gamma;
+        const double pm3 = (-beta + std::copysign(1.0, 1.5 - K) * std::sqrt(discr)) / (2.0 * alpha);
+        w[0] = pm3;
+        w[1] = -3.0 * pm3 - (1.0 / 16.0) + (1.0 / 8.0) * (K + r2) + (1.0 / 12.0) * (3.0 * K - 1.0) * r +
+               (1.0 / 12.0) * r3;
+        w[2] = 2.0 * pm3 + (1.0 / 4.0) + (1.0 / 6.0) * (4.0 - 3.0 * K) * r - (1.0 / 6.0) * r3;
+        w[3] = 2.0 * pm3 + (5.0 / 8.0) - (1.0 / 4.0) * (K + r2);
+        w[4] = -3.0 * pm3 + (1.0 / 4.0) - (1.0 / 6.0) * (4.0 - 3.0 * K) * r + (1.0 / 6.0) * r3;
+        w[5] = pm3 - (1.0 / 16.0) + (1.0 / 8.0) * (K + r2) - (1.0 / 12.0) * (3.0 * K - 1.0) * r - (1.0 / 12.0) * r3;
+        return;
+    }
+};
+
+/*!
+ * \brief The N-point B-spline kernels, for N = 3, 4, 5, 6.
+ *
+ * As in the Fortran kernels, even-width stencils are shifted towards the side
+ * of the cell center on which the unshifted point lies.
+ */
+template <int N>
+struct BSplineKernel
+{
+    static_assert(3 <= N && N <= 6, "only the 3-, 4-, 5-, and 6-point B-splines are implemented");
+
+    static constexpr int width = N;
+
+    static inline double
+    delta(const double x)
+    {
+        const double modx = std::abs(x);
+        const double r = modx + 0.5 * N;
+        const double r2 = r * r;
+        const double r3 = r2 * r;
+        const double r4 = r3 * r;
+        switch (N)
+        {
+        case 3:
+            if (modx <= 0.5) return 0.5 * (-2.0 * r2 + 6.0 * r - 3.0);
+            if (modx <= 1.5) return 0.5 * (r2 - 6.0 * r + 9.0);
+            return 0.0;
+        case 4:
+            if (modx <= 1.0) return (1.0 / 6.0) * (3.0 * r3 - 24.0 * r2 + 60.0 * r - 44.0);
+            if (modx <= 2.0) return (1.0 / 6.0) * (-r3 + 12.0 * r2 - 48.0 * r + 64.0);
+            return 0.0;
+        case 5:
+            if (modx <= 0.5) return (1.0 / 24.0) * (6.0 * r4 - 60.0 * r3 + 210.0 * r2 - 300.0 * r + 155.0);
+            if (modx <= 1.5) return (1.0 / 24.0) * (-4.0 * r4 + 60.0 * r3 - 330.0 * r2 + 780.0 * r - 655.0);
+            if (modx <= 2.5) return (1.0 / 24.0) * (r4 - 20.0 * r3 + 150.0 * r2 - 500.0 * r + 625.0);
+            return 0.0;
+        default:
+        {
+            const double r5 = r4 * r;
+            if (modx <= 1.0)
+                return (1.0 / 60.0) * (2193.0 - 3465.0 * r + 2130.0 * r2 - 630.0 * r3 + 90.0 * r4 - 5.0 * r5);
+            if (modx <= 2.0)
+                return (1.0 / 120.0) *
+                       (-10974.0 + 12270.0 * r - 5340.0 * r2 + 1140.0 * r3 - 120.0 * r4 + 5.0 * r5);
+            if (modx <= 3.0)
+                return (1.0 / 120.0) * (7776.0 - 6480.0 * r + 2160.0 * r2 - 360.0 * r3 + 30.0 * r4 - r5);
+            return 0.0;
+        }
+        }
+    }
+
+    static inline void
+    weights(int& ic_lower,
+            double* const w,
+            const double X,
+            const double X_shift,
+            const double x_lower,
+            const int ilower,
+            const double dx)
+    {
+        const int ic_center = cell_index((X + X_shift - x_lower) / dx, ilower);
+        const double X_center = x_lower + (static_cast<double>(ic_center - ilower) + 0.5) * dx;
+        ic_lower = ic_center - (N - 1) / 2;
+        if (N % 2 == 0 && X < X_center) ic_lower -= 1;
+        for (int i = 0; i < N; ++i)
+        {
+            const double X_cell = x_lower + (static_cast<double>(ic_lower + i - ilower) + 0.5) * dx;
+            w[i] = delta((X + X_shift - X_cell) / dx);
+        }
+        return;
+    }
+};
+
+/*!
+ * \brief Tensor-product stencil operations along the coordinate directions
+ * 0, ..., AXIS, with the innermost (contiguous) direction unrolled and
+ * vectorized.
+ */
+template <int W, int AXIS>
+struct TensorProductStencil
+{
+    static inline double
+    interpolate(const double* const u, const double (*w)[W], const int* const stride)
+    {
+        double V = 0.0;
+        for (int i = 0; i < W; ++i)
+        {
+            V += w[AXIS][i] * TensorProductStencil<W, AXIS - 1>::interpolate(u + i * stride[AXIS], w, stride);
+        }
+        return V;
+    }
+
+    static inline void
+    spread(double* const u, const double (*w)[W], const int* const stride, const double V)
+    {
+        for (int i = 0; i < W; ++i)
+        {
+            TensorProductStencil<W, AXIS - 1>::spread(u + i * stride[AXIS], w, stride, w[AXIS][i] * V);
+        }
+        return;
+    }
+};
+
+template <int W>
+struct TensorProductStencil<W, 0>
+{
+    static inline double
+    interpolate(const double* const u, const double (*w)[W], const int* const /*stride*/)
+    {
+        double V = 0.0;
+#ifdef IBTK_HAVE_OPENMP
+#pragma omp simd reduction(+ : V)
+#endif
+        for (int i = 0; i < W; ++i)
+        {
+            V += w[0][i] * u[i];
+        }
+        return V;
+    }
+
+    static inline void
+    spread(double* const u, const double (*w)[W], const int* const /*stride*/, const double V)
+    {
+#ifdef IBTK_HAVE_OPENMP
+#pragma omp simd
+#endif
+        for (int i = 0; i < W; ++i)
+        {
+            u[i] += w[0][i] * V;
+        }
+        return;
+    }
+};
+
+/*!
+ * \brief Compute the weights and the offset into the Eulerian data of the
+ * lower corner of the stencil of a single point.
+ *
+ * Stencils that extend past the ghost box are shifted so that they lie
+ * within the ghost box and the weights outside of the ghost box are zeroed.
+ * This requires the ghost box to be at least as wide as the stencil, which
+ * holds whenever there are enough ghost cells for the kernel.
+ */
+template <class Kernel, int DIM>
+inline void
+compute_stencil(int& offset,
+                double (*w)[Kernel::width],
+                const double* const X,
+                const double* const X_shift,
+                const double* const x_lower,
+                const double* const dx,
+                const int* const ilower,
+                const int* const ig_lower,
+                const int* const ig_upper,
+                const int* const stride)
+{
+    static constexpr int W = Kernel::width;
+    offset = 0;
+    for (int d = 0; d < DIM; ++d)
+    {
+        int ic_lower;
+        Kernel::weights(ic_lower, w[d], X[d], X_shift[d], x_lower[d], ilower[d], dx[d]);
+        if (ic_lower < ig_lower[d] || ic_lower + W - 1 > ig_upper[d])
+        {
+            // Shift the weights so that the stencil starts within the ghost
+            // box and drop the weights that fall outside of it.
+            const int ic_start = std::max(std::min(ic_lower, ig_upper[d] - W + 1), ig_lower[d]);
+            double w_shifted[W];
+            for (int i = 0; i < W; ++i)
+            {
+                const int ic = ic_start + i;
+                const int k = ic - ic_lower;
+                w_shifted[i] = (0 <= k && k < W && ic <= ig_upper[d]) ? w[d][k] : 0.0;
+            }
+            std::copy(w_shifted, w_shifted + W, w[d]);
+            ic_lower = ic_start;
+        }
+        offset += (ic_lower - ig_lower[d]) * stride[d];
+    }
+    return;
+}
+
+/*!
+ * \brief Interpolate the Eulerian data q_data to the Lagrangian points
+ * X_data(local_indices) + periodic_shifts.
+ *
+ * Q_DEPTH is the depth of the data if it is known at compile time, or zero if
+ * the depth is given by the runtime argument depth.
+ */
+template <class Kernel, int DIM, int Q_DEPTH>
+void
+interpolate(double* const Q_data,
+            const double* const X_data,
+            const double* const q_data,
+            const int depth,
+            const int* const ilower,
+            const int* const iupper,
+            const int* const q_gcw,
+            const double* const x_lower,
+            const double* const dx,
+            const int* const local_indices,
+            const double* const periodic_shifts,
+            const int num_local_indices)
+{
+    static constexpr int W = Kernel::width;
+    const int q_depth = Q_DEPTH > 0 ? Q_DEPTH : depth;
+    int ig_lower[DIM], ig_upper[DIM], stride[DIM];
+    int depth_stride = 1;
+    for (int d = 0; d < DIM; ++d)
+    {
+        ig_lower[d] = ilower[d] - q_gcw[d];
+        ig_upper[d] = iupper[d] + q_gcw[d];
+        stride[d] = depth_stride;
+        depth_stride *= ig_upper[d] - ig_lower[d] + 1;
+    }
+    double w[DIM][W];
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        const int s = local_indices[l];
+        int offset;
+        compute_stencil<Kernel, DIM>(
+            offset, w, &X_data[DIM * s], &periodic_shifts[DIM * l], x_lower, dx, ilower, ig_lower, ig_upper, stride);
+        double* const V = &Q_data[q_depth * s];
+        for (int k = 0; k < q_depth; ++k)
+        {
+            V[k] = TensorProductStencil<W, DIM - 1>::interpolate(&q_data[k * depth_stride + offset], w, stride);
+        }
+    }
+    return;
+}
+
+/*!
+ * \brief Spread the Lagrangian values Q_data(local_indices) located at the
+ * points X_data(local_indices) + periodic_shifts to the Eulerian data q_data.
+ *
+ * Q_DEPTH is the depth of the data if it is known at compile time, or zero if
+ * the depth is given by the runtime argument depth.
+ */
+template <class Kernel, int DIM, int Q_DEPTH>
+void
+spread(double* const q_data,
+       const double* const Q_data,
+       const double* const X_data,
+       const int depth,
+       const int* const ilower,
+       const int* const iupper,
+       const int* const q_gcw,
+       const double* const x_lower,
+       const double* const dx,
+       const int* const local_indices,
+       const double* const periodic_shifts,
+       const int num_local_indices)
+{
+    static constexpr int W = Kernel::width;
+    const int q_depth = Q_DEPTH > 0 ? Q_DEPTH : depth;
+    int ig_lower[DIM], ig_upper[DIM], stride[DIM];
+    int depth_stride = 1;
+    double vol = 1.0;
+    for (int d = 0; d < DIM; ++d)
+    {
+        ig_lower[d] = ilower[d] - q_gcw[d];
+        ig_upper[d] = iupper[d] + q_gcw[d];
+        stride[d] = depth_stride;
+        depth_stride *= ig_upper[d] - ig_lower[d] + 1;
+        vol *= dx[d];
+    }
+    double w[DIM][W];
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        const int s = local_indices[l];
+        int offset;
+        compute_stencil<Kernel, DIM>(
+            offset, w, &X_data[DIM * s], &periodic_shifts[DIM * l], x_lower, dx, ilower, ig_lower, ig_upper, stride);
+        const double* const V = &Q_data[q_depth * s];
+        for (int k = 0; k < q_depth; ++k)
+        {
+            TensorProductStencil<W, DIM - 1>::spread(&q_data[k * depth_stride + offset], w, stride, V[k] / vol);
+        }
+    }
+    return;
+}
+} // namespace LEInteractorKernels
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifndef included_IBTK_LEInteractorKernels
@@ -67,9 +67,14 @@ public:
 
     /*!
      * \brief Update the cached indexing data.
+     *
+     * If \em use_morton_ordering is true, the cached indices are ordered by
+     * the position of their cells along a Morton curve through the ghost box
+     * instead of by insertion order.
      */
     void cacheLocalIndices(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift);
+                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                           bool use_morton_ordering = false);
 
     /*!
      * \return A constant reference to the set of Lagrangian data indices that
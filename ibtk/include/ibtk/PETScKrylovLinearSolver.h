@@ -22,6 +22,7 @@
 
 #include "ibtk/KrylovLinearSolver.h"
 #include "ibtk/LinearSolver.h"
+#include "ibtk/SAMRAIFischerGuess.h"
 
 #include "IntVector.h"
 #include "MultiblockDataTranslator.h"
@@ -38,6 +39,7 @@
 #include <mpi.h>
 
 #include <iosfwd>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -98,8 +100,26 @@ namespace IBTK
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
  enable_logging = FALSE        // see setLoggingEnabled()
+ num_fischer_vectors = 0       // number of previous solves used to compute initial guesses
  \endverbatim
  *
+ * When num_fischer_vectors is positive, the solutions and right-hand sides of
+ * previous solves are stored and used to compute an initial guess for each new
+ * solve by projecting the new right-hand side onto the span of the stored
+ * ones; see SAMRAIFischerGuess. This is worthwhile when the same system is
+ * solved with slowly varying right-hand sides (e.g., at successive time
+ * steps). The computed guess replaces the contents of the solution vector, so
+ * it is only used when initial_guess_nonzero is set to FALSE; initial
+ * guesses provided by the caller are never overwritten. The stored vectors are
+ * discarded whenever the solver state is deallocated or the operator is reset.
+ *
+ * The pipelined Krylov methods provided by PETSc (e.g., ksp_type = "pipecg",
+ * "pgmres", or "pipefgmres") may also be used. These methods overlap their
+ * global reductions with the application of the operator and the
+ * preconditioner by using the split-phase reductions provided by
+ * PETScSAMRAIVectorReal. Note that removing a null space from the solution
+ * requires additional blocking reductions.
+ *
  * PETSc is developed in the Mathematics and Computer Science (MCS) Division at
  * Argonne National Laboratory (ANL).  For more information about PETSc, see <A
  * HREF="http://www.mcs.anl.gov/petsc">http://www.mcs.anl.gov/petsc</A>.
@@ -402,6 +422,11 @@ private:
     Vec d_petsc_nullspace_constant_vec = nullptr;
     std::vector<Vec> d_petsc_nullspace_basis_vecs;
     bool d_solver_has_attached_nullspace = false;
+
+    /*
+     * Initial guesses computed from previous solves.
+     */
+    std::unique_ptr<SAMRAIFischerGuess> d_fischer_guess;
 };
 } // namespace IBTK
 
@@ -53,6 +53,14 @@ namespace IBTK
  * through the static member functions that create and destroy PETSc vector
  * objects.
  *
+ * The vector operations that compute inner products and norms are also
+ * provided in a local form that does not perform any communication. PETSc uses
+ * these operations to implement split-phase reductions (e.g., VecDotBegin() and
+ * VecDotEnd(), VecNormBegin() and VecNormEnd(), and VecMDotBegin() and
+ * VecMDotEnd()) with nonblocking collective communication, so that pipelined
+ * Krylov methods such as KSPPIPECG, KSPPGMRES, and KSPPIPEFGMRES can overlap
+ * their reductions with other work.
+ *
  * Finally, we remark that PETSc allows vectors with complex-valued entries.
  * This class and the class SAMRAI::solv::SAMRAIVectorReal assume real-values
  * vectors, i.e., data of type \p double or \p float.  The (currently
@@ -247,6 +255,12 @@ private:
 
     static PetscErrorCode VecDotNorm2_SAMRAI(Vec s, Vec t, PetscScalar* dp, PetscScalar* nm);
 
+    /*
+     * Compute the local parts of the inner products of x with each y[i], using
+     * a single pass over x when the vector data supports it.
+     */
+    static void computeLocalMDot(Vec x, PetscInt nv, const Vec* y, PetscScalar* val);
+
     /*
      * Vector data is maintained in the SAMRAI vector structure.
      */
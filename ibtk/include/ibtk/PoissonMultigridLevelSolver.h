@@ -0,0 +1,222 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_PoissonMultigridLevelSolver
+#define included_IBTK_PoissonMultigridLevelSolver
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "ibtk/LinearSolver.h"
+#include "ibtk/PoissonSolver.h"
+#include "ibtk/ibtk_utilities.h"
+
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "SAMRAIVectorReal.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+#include <string>
+
+namespace IBTK
+{
+class PoissonFACPreconditioner;
+} // namespace IBTK
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PoissonMultigridLevelSolver is a concrete LinearSolver for
+ * solving cell-centered or side-centered Poisson problems on a single level
+ * of the patch hierarchy that covers the entire physical domain (typically
+ * level 0) by geometric multigrid.
+ *
+ * This class is intended to be used as the coarse level solver of the FAC
+ * preconditioners (e.g., by setting <code>coarse_solver_type =
+ * "MULTIGRID_LEVEL_SOLVER"</code>). It builds a separate patch hierarchy whose
+ * finest level has the same patches (and the same parallel distribution) as
+ * the level on which the problem is posed and whose coarser levels are
+ * obtained by repeatedly coarsening the physical domain by a factor of two
+ * until the coarsest level is small. A PoissonFACPreconditioner (using
+ * CCPoissonPointRelaxationFACOperator or SCPoissonPointRelaxationFACOperator,
+ * depending on the data centering) is then used on that hierarchy, so the
+ * usual smoothers and prolongation and restriction operators are used on the
+ * additional levels.
+ *
+ * Once a coarse level has fewer than <code>cells_per_processor</code> cells
+ * per MPI process, its patches are assigned to fewer processes (and, on the
+ * coarsest levels, to a single process) to avoid communication among many
+ * processes that each own very little data.
+ *
+ * Like FACPreconditioner, each call to solveSystem() applies a single
+ * multigrid cycle with a zero initial guess. Only constant coefficient
+ * problems are supported.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+
+ enable_logging = FALSE           // see setLoggingEnabled()
+ max_coarse_levels = 20           // maximum number of levels added below the level
+ coarsest_level_max_cells = 512   // stop coarsening once a level has at most this many cells
+ cells_per_processor = 4096       // minimum number of cells per process on the added levels
+ coarse_patch_size = 32           // largest patch size (in each direction) on the added levels
+ fac_db { ... }                   // input database for the FAC preconditioner and operator
+ \endverbatim
+ */
+class PoissonMultigridLevelSolver : public LinearSolver, public PoissonSolver
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    PoissonMultigridLevelSolver(const std::string& object_name,
+                                SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                                const std::string& default_options_prefix);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PoissonMultigridLevelSolver();
+
+    /*!
+     * \brief Static function to construct a PoissonMultigridLevelSolver.
+     */
+    static SAMRAI::tbox::Pointer<PoissonSolver> allocate_solver(const std::string& object_name,
+                                                                SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                                                                const std::string& default_options_prefix)
+    {
+        return new PoissonMultigridLevelSolver(object_name, input_db, default_options_prefix);
+    } // allocate_solver
+
+    /*!
+     * \name Linear solver functionality.
+     */
+    //\{
+
+    /*!
+     * \brief Solve the linear system of equations \f$Ax=b\f$ for \f$x\f$ by
+     * applying a single multigrid cycle.
+     *
+     * \note The vector arguments must be defined on a single level of the
+     * patch hierarchy that covers the entire physical domain.
+     *
+     * \return \p true if the solver converged to the specified tolerances, \p
+     * false otherwise
+     */
+    bool solveSystem(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                     SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b) override;
+
+    /*!
+     * \brief Compute hierarchy dependent data required for solving \f$Ax=b\f$.
+     *
+     * This function constructs the coarsened patch hierarchy and initializes
+     * the FAC preconditioner used on it.
+     *
+     * \param x solution vector
+     * \param b right-hand-side vector
+     */
+    void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                               const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b) override;
+
+    /*!
+     * \brief Remove all hierarchy dependent data allocated by
+     * initializeSolverState().
+     *
+     * \note It is safe to call deallocateSolverState() when the solver state
+     * is already deallocated.
+     */
+    void deallocateSolverState() override;
+
+    //\}
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    PoissonMultigridLevelSolver() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PoissonMultigridLevelSolver(const PoissonMultigridLevelSolver& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PoissonMultigridLevelSolver& operator=(const PoissonMultigridLevelSolver& that) = delete;
+
+    /*!
+     * \brief Construct the patch hierarchy used by the multigrid solver.
+     */
+    void buildMultigridHierarchy();
+
+    /*!
+     * \brief Copy the data of a vector defined on the solver level to or from
+     * the finest level of the multigrid hierarchy.
+     */
+    void copyVectorData(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& src_vec,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > src_level,
+                        const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& dst_vec,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > dst_level);
+
+    /*!
+     * \name Solver configuration.
+     */
+    //\{
+    std::string d_default_options_prefix;
+    int d_max_coarse_levels = 20;
+    int d_coarsest_level_max_cells = 512;
+    int d_cells_per_processor = 4096;
+    int d_coarse_patch_size = 32;
+    SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> d_fac_db;
+    //\}
+
+    /*!
+     * \name Hierarchy data.
+     */
+    //\{
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
+    int d_level_num = IBTK::invalid_level_number;
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_mg_hierarchy;
+    int d_mg_finest_ln = IBTK::invalid_level_number;
+    SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_mg_x, d_mg_b;
+    //\}
+
+    /*!
+     * \brief The FAC preconditioner used on the multigrid hierarchy.
+     */
+    SAMRAI::tbox::Pointer<PoissonFACPreconditioner> d_fac_pc;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifndef included_IBTK_PoissonMultigridLevelSolver
@@ -0,0 +1,123 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_SAMRAIFischerGuess
+#define included_IBTK_SAMRAIFischerGuess
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "SAMRAIVectorReal.h"
+#include "tbox/Pointer.h"
+
+IBTK_DISABLE_EXTRA_WARNINGS
+#include <Eigen/Core>
+IBTK_ENABLE_EXTRA_WARNINGS
+
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class SAMRAIFischerGuess is the counterpart of FischerGuess for
+ * vectors defined on a patch hierarchy.
+ *
+ * Pairs of solution and right-hand side vectors from solving the same linear
+ * system several times (e.g., at successive time steps) are stored and used to
+ * compute an initial guess for a new right-hand side by projecting it onto the
+ * span of the stored right-hand sides. See FischerGuess for a description of
+ * the algorithm.
+ *
+ * The stored vectors are clones of the submitted vectors and are only valid for
+ * a fixed hierarchy configuration: clear() must be called when the hierarchy
+ * changes (e.g., after regridding) or when the linear operator changes.
+ */
+class SAMRAIFischerGuess
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * @param n_vectors The number of stored vectors.
+     */
+    SAMRAIFischerGuess(int n_vectors = 5);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~SAMRAIFischerGuess();
+
+    /*!
+     * \brief Add a new solution and RHS pair to the stored collection. If the
+     * collection is full then the oldest vectors are removed.
+     */
+    void submit(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& solution,
+                const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& rhs);
+
+    /*!
+     * \brief Given a RHS vector, use the stored collection of vectors to
+     * compute an estimate of its corresponding solution vector.
+     *
+     * @return Whether or not a guess was computed. If no vectors are stored,
+     * the solution vector is not modified.
+     */
+    bool guess(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& solution,
+               const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& rhs) const;
+
+    /*!
+     * \brief Remove all stored vectors and free their patch data.
+     */
+    void clear();
+
+    /*!
+     * \brief Get the number of currently stored vectors.
+     */
+    int getNumberOfStoredVectors() const;
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    SAMRAIFischerGuess(const SAMRAIFischerGuess& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     */
+    SAMRAIFischerGuess& operator=(const SAMRAIFischerGuess& that) = delete;
+
+    int d_n_max_vectors = 5;
+
+    int d_n_stored_vectors = 0;
+
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> d_correlation_matrix;
+
+    /*
+     * Stored vectors, oldest first. Once the collection is full, the storage of
+     * the oldest pair is reused for the newest one.
+     */
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_solutions, d_rhs;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifndef included_IBTK_SAMRAIFischerGuess
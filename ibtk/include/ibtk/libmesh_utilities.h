@@ -53,7 +53,10 @@ IBTK_DISABLE_EXTRA_WARNINGS
 IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <array>
+#include <string>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 /////////////////////////////// FUNCTION DEFINITIONS /////////////////////////
 
@@ -370,10 +373,16 @@ batch_vec_assembly(const std::vector<std::vector<libMesh::PetscVector<double>*>
     }
 }
 
+/**
+ * Start updating the ghost values of several vectors at once. The update must
+ * be completed with batch_vec_ghost_update_end(), called with the same
+ * arguments. The locally owned values of the vectors may be read in the
+ * meantime, e.g., with FEDataManager::LOCAL_ELEMS.
+ */
 inline void
-batch_vec_ghost_update(const std::vector<libMesh::PetscVector<double>*>& vecs,
-                       const InsertMode insert_mode,
-                       const ScatterMode scatter_mode)
+batch_vec_ghost_update_begin(const std::vector<libMesh::PetscVector<double>*>& vecs,
+                             const InsertMode insert_mode,
+                             const ScatterMode scatter_mode)
 {
     for (const auto& v : vecs)
     {
@@ -381,6 +390,16 @@ batch_vec_ghost_update(const std::vector<libMesh::PetscVector<double>*>& vecs,
         int ierr = VecGhostUpdateBegin(v->vec(), insert_mode, scatter_mode);
         IBTK_CHKERRQ(ierr);
     }
+}
+
+/**
+ * Complete a ghost value update started by batch_vec_ghost_update_begin().
+ */
+inline void
+batch_vec_ghost_update_end(const std::vector<libMesh::PetscVector<double>*>& vecs,
+                           const InsertMode insert_mode,
+                           const ScatterMode scatter_mode)
+{
     for (const auto& v : vecs)
     {
         if (!v) continue;
@@ -390,30 +409,45 @@ batch_vec_ghost_update(const std::vector<libMesh::PetscVector<double>*>& vecs,
 }
 
 inline void
-batch_vec_ghost_update(const std::vector<std::vector<libMesh::PetscVector<double>*> >& vecs,
-                       const InsertMode insert_mode,
-                       const ScatterMode scatter_mode)
+batch_vec_ghost_update_begin(const std::vector<std::vector<libMesh::PetscVector<double>*> >& vecs,
+                             const InsertMode insert_mode,
+                             const ScatterMode scatter_mode)
 {
     for (unsigned int n = 0; n < vecs.size(); ++n)
     {
-        for (const auto& v : vecs[n])
-        {
-            if (!v) continue;
-            int ierr = VecGhostUpdateBegin(v->vec(), insert_mode, scatter_mode);
-            IBTK_CHKERRQ(ierr);
-        }
+        batch_vec_ghost_update_begin(vecs[n], insert_mode, scatter_mode);
     }
+}
+
+inline void
+batch_vec_ghost_update_end(const std::vector<std::vector<libMesh::PetscVector<double>*> >& vecs,
+                           const InsertMode insert_mode,
+                           const ScatterMode scatter_mode)
+{
     for (unsigned int n = 0; n < vecs.size(); ++n)
     {
-        for (const auto& v : vecs[n])
-        {
-            if (!v) continue;
-            int ierr = VecGhostUpdateEnd(v->vec(), insert_mode, scatter_mode);
-            IBTK_CHKERRQ(ierr);
-        }
+        batch_vec_ghost_update_end(vecs[n], insert_mode, scatter_mode);
     }
 }
 
+inline void
+batch_vec_ghost_update(const std::vector<libMesh::PetscVector<double>*>& vecs,
+                       const InsertMode insert_mode,
+                       const ScatterMode scatter_mode)
+{
+    batch_vec_ghost_update_begin(vecs, insert_mode, scatter_mode);
+    batch_vec_ghost_update_end(vecs, insert_mode, scatter_mode);
+}
+
+inline void
+batch_vec_ghost_update(const std::vector<std::vector<libMesh::PetscVector<double>*> >& vecs,
+                       const InsertMode insert_mode,
+                       const ScatterMode scatter_mode)
+{
+    batch_vec_ghost_update_begin(vecs, insert_mode, scatter_mode);
+    batch_vec_ghost_update_end(vecs, insert_mode, scatter_mode);
+}
+
 /**
  * Convenience function that calls setup_system_vector for all specified systems
  * and vector names. This function is aware of System::rhs and will reset it
@@ -1622,6 +1656,39 @@ get_global_element_bounding_boxes(const libMesh::MeshBase& mesh,
  */
 std::vector<libMeshWrappers::BoundingBox> get_global_element_bounding_boxes(const libMesh::MeshBase& mesh,
                                                                             const libMesh::System& X_system);
+
+/**
+ * Collect the values of all vectors of all systems in @p equation_systems in
+ * files which can be read by read_equation_systems_data(). The data of each
+ * group of @p ranks_per_writer consecutive ranks is gathered on the first rank
+ * of the group, so that only one file is written per group.
+ *
+ * The files are not written by this function: it returns the names and
+ * contents of the files this rank should write (i.e., nothing on ranks which
+ * are not the first rank of their group), which allows the caller to write
+ * them in the background. The file names are @p file_name followed by
+ * <code>.data.</code> and the group number.
+ *
+ * @note The nodes and elements are identified by their ids, so the data can
+ * be read with any number of processors and any partitioning of the mesh.
+ * Only the vector data is stored: the systems themselves (and the mesh) must
+ * be set up independently, e.g., with libMesh::EquationSystems::write() and
+ * libMesh::EquationSystems::read().
+ */
+std::vector<std::pair<std::string, std::vector<char> > >
+collect_equation_systems_data(const libMesh::EquationSystems& equation_systems,
+                              const std::string& file_name,
+                              int ranks_per_writer);
+
+/**
+ * Read the vector data written with collect_equation_systems_data() into the
+ * systems of @p equation_systems. Each file is read by one rank, which sends
+ * every rank the values of the degrees of freedom it owns. The values of
+ * nodes and elements which are not known on the reading rank (e.g., with a
+ * distributed mesh) are sent to all ranks. Systems and vectors which are
+ * present in the files but not in @p equation_systems are ignored.
+ */
+void read_equation_systems_data(libMesh::EquationSystems& equation_systems, const std::string& file_name);
 } // namespace IBTK
 
 //////////////////////////////////////////////////////////////////////////////
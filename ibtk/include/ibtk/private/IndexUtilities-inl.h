@@ -23,6 +23,7 @@
 #include "ibtk/IndexUtilities.h"
 
 #include <cmath>
+#include <cstdint>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -208,6 +209,25 @@ IndexUtilities::getSideCenter(const SAMRAI::tbox::Pointer<SAMRAI::geom::Cartesia
     return getSideCenter<VectorNd>(grid_geom, ratio, side_idx);
 } // getSideCenter
 
+inline std::uint64_t
+IndexUtilities::getMortonIndex(const SAMRAI::hier::Index<NDIM>& i, const SAMRAI::hier::Index<NDIM>& lower)
+{
+    constexpr unsigned int num_bits = 64 / NDIM;
+    std::uint64_t key = 0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+#if !defined(NDEBUG)
+        TBOX_ASSERT(i(d) >= lower(d));
+#endif
+        const auto offset = static_cast<std::uint64_t>(i(d) - lower(d));
+        for (unsigned int bit = 0; bit < num_bits; ++bit)
+        {
+            key |= ((offset >> bit) & std::uint64_t(1)) << (NDIM * bit + d);
+        }
+    }
+    return key;
+} // getMortonIndex
+
 template <class DoubleArray>
 inline SAMRAI::hier::Index<NDIM>
 IndexUtilities::getCellIndex(const DoubleArray& X,
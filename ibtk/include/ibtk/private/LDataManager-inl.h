@@ -36,6 +36,32 @@ LDataManager::getGhostCellWidth() const
     return d_ghost_width;
 } // getGhostCellWidth
 
+inline void
+LDataManager::setUseMortonOrdering(const bool use_morton_ordering)
+{
+    d_use_morton_ordering = use_morton_ordering;
+    return;
+} // setUseMortonOrdering
+
+inline bool
+LDataManager::getUseMortonOrdering() const
+{
+    return d_use_morton_ordering;
+} // getUseMortonOrdering
+
+inline void
+LDataManager::setUseIncrementalRedistribution(const bool use_incremental_redistribution)
+{
+    d_use_incremental_redistribution = use_incremental_redistribution;
+    return;
+} // setUseIncrementalRedistribution
+
+inline bool
+LDataManager::getUseIncrementalRedistribution() const
+{
+    return d_use_incremental_redistribution;
+} // getUseIncrementalRedistribution
+
 inline const std::string&
 LDataManager::getDefaultInterpKernelFunction() const
 {
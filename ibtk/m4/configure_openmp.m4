@@ -0,0 +1,53 @@
+## ---------------------------------------------------------------------
+##
+## Copyright (c) 2026 - 2026 by the IBAMR developers
+## All rights reserved.
+##
+## This file is part of IBAMR.
+##
+## IBAMR is free software and is distributed under the 3-clause BSD
+## license. The full text of the license can be found in the file
+## COPYRIGHT at the top level directory of IBAMR.
+##
+## ---------------------------------------------------------------------
+
+dnl OpenMP is disabled by default, as in the CMake build. When it is enabled
+dnl both the C++ and the Fortran compilers must support it since the Fortran
+dnl kernels are called from threaded regions.
+AC_DEFUN([CONFIGURE_OPENMP],[
+echo
+echo "=================================="
+echo "Configuring optional package OpenMP"
+echo "=================================="
+AC_ARG_ENABLE([openmp],
+  AS_HELP_STRING([--enable-openmp],[compile with OpenMP support @<:@default=no@:>@]),
+  [case "$enableval" in
+     yes)  OPENMP_ENABLED=yes ;;
+     no)   OPENMP_ENABLED=no ;;
+     *)    AC_MSG_ERROR([--enable-openmp=$enableval is not a valid option]) ;;
+   esac],[OPENMP_ENABLED=no])
+AC_MSG_CHECKING([whether to compile with OpenMP support])
+AC_MSG_RESULT([$OPENMP_ENABLED])
+IBAMR_HAVE_OPENMP=FALSE
+if test "$OPENMP_ENABLED" = yes; then
+  AC_LANG_PUSH([C++])
+  AC_OPENMP
+  AC_LANG_POP([C++])
+  if test "$ac_cv_prog_cxx_openmp" = unsupported ; then
+    AC_MSG_ERROR([OpenMP support was requested but the C++ compiler does not support OpenMP])
+  fi
+  AC_LANG_PUSH([Fortran])
+  AC_OPENMP
+  AC_LANG_POP([Fortran])
+  if test "$ac_cv_prog_fc_openmp" = unsupported ; then
+    AC_MSG_ERROR([OpenMP support was requested but the Fortran compiler does not support OpenMP])
+  fi
+  CXXFLAGS_APPEND($OPENMP_CXXFLAGS)
+  FCFLAGS_APPEND($OPENMP_FCFLAGS)
+  LDFLAGS_APPEND($OPENMP_CXXFLAGS)
+  FFLAGS="$FCFLAGS"
+  AC_DEFINE([HAVE_OPENMP],1,[Define if compiling with OpenMP support])
+  IBAMR_HAVE_OPENMP=TRUE
+fi
+AC_SUBST(IBAMR_HAVE_OPENMP)
+])
@@ -309,6 +309,7 @@ FEDataInterpolation::init()
             if (d_eval_dphi[fe_type_idx]) update_flags |= update_dphi;
 
             fe = FEValuesBase::build(d_dim, NDIM, d_qrule, d_fe_types[fe_type_idx], update_flags);
+            fe->setGeometryCache(d_fe_data->getGeometryCache());
 
             if (d_eval_q_point && !d_q_point) d_q_point = &fe->getQuadraturePoints();
             if (d_eval_JxW && !d_JxW) d_JxW = &fe->getJxW();
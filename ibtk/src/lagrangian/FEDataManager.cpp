@@ -106,16 +106,22 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <functional>
 #include <iomanip>
 #include <limits>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <set>
 #include <string>
 #include <tuple>
 #include <utility>
 #include <vector>
 
+#ifdef IBTK_HAVE_OPENMP
+#include <omp.h>
+#endif
+
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
 namespace libMesh
@@ -142,6 +148,7 @@ namespace
 {
 // Timers.
 static Timer* t_reinit_element_mappings;
+static Timer* t_update_element_mappings;
 static Timer* t_build_ghosted_solution_vector;
 static Timer* t_build_ghosted_vector;
 static Timer* t_spread;
@@ -194,41 +201,90 @@ collect_subdomain_ids(const libMesh::MeshBase& mesh)
     return subdomain_ids;
 }
 
+/*
+ * Return the number of the calling thread inside an OpenMP parallel region, or
+ * zero if IBAMR was compiled without OpenMP.
+ */
+inline int
+get_thread_num()
+{
+#ifdef IBTK_HAVE_OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
 /**
  * A difficulty with FEDataManager is that it needs to work with both volumetric
  * and surface meshes, even though for performance reasons we template FEMapping
  * on the current topological dimension of the mesh. Fortunately we do not need
  * the contravariants or other topological dimension-dependent values: we just
  * need the JxW values. Hence this little helper function lets one get the
- * correct JxW values from the correct mapping object based on the runtime
- * dimensionality of the mesh.
- *
- * We need to return a reference to a temporary from this function - this is OK
- * (the temporary lives in a map) but the compiler doesn't know that, so silence
- * the warning about temporaries.
+ * correct JxW values from the correct mapping object (exactly one of which is
+ * not nullptr) based on the runtime dimensionality of the mesh.
  */
-IBTK_DISABLE_EXTRA_WARNINGS
-const std::vector<double>&
-get_JxW(quadrature_key_type key,
-        const Elem* elem,
-        const bool is_volume_mesh,
-        FEMappingCache<NDIM, NDIM>& volume_mapping_cache,
-        FEMappingCache<NDIM - 1, NDIM>& surface_mapping_cache)
+inline const std::vector<double>&
+get_JxW(const Elem* elem,
+        FEMapping<NDIM, NDIM>* const volume_mapping,
+        FEMapping<NDIM - 1, NDIM>* const surface_mapping)
 {
-    if (is_volume_mesh)
+    if (volume_mapping)
     {
-        auto& mapping = volume_mapping_cache[key];
-        mapping.reinit(elem);
-        return mapping.getJxW();
+        volume_mapping->reinit(elem);
+        return volume_mapping->getJxW();
     }
     else
     {
-        auto& mapping = surface_mapping_cache[key];
-        mapping.reinit(elem);
-        return mapping.getJxW();
+        surface_mapping->reinit(elem);
+        return surface_mapping->getJxW();
     }
 }
-IBTK_ENABLE_EXTRA_WARNINGS
+
+/*
+ * Sort the elements of a patch by their quadrature keys and split the sorted
+ * elements into batches of at most max_batch_size elements which share the
+ * same key. With adaptive quadrature neighboring elements frequently use
+ * different rules: processing the elements batch by batch lets us look up the
+ * FE and mapping objects once per batch instead of once per element.
+ *
+ * On return elem_order contains the indices of the elements sorted by key and
+ * each batch is a half-open range of positions in elem_order.
+ */
+void
+batch_elems_by_quadrature_key(const std::vector<quadrature_key_type>& quad_keys,
+                              const unsigned int max_batch_size,
+                              std::vector<unsigned int>& elem_order,
+                              std::vector<std::pair<unsigned int, unsigned int> >& batches)
+{
+    const auto n_elems = static_cast<unsigned int>(quad_keys.size());
+    elem_order.resize(n_elems);
+    std::iota(elem_order.begin(), elem_order.end(), 0u);
+    // Without adaptive quadrature every key is usually the same, so avoid
+    // sorting already sorted keys.
+    if (!std::is_sorted(quad_keys.begin(), quad_keys.end()))
+    {
+        std::stable_sort(elem_order.begin(),
+                         elem_order.end(),
+                         [&](const unsigned int a, const unsigned int b) { return quad_keys[a] < quad_keys[b]; });
+    }
+
+    batches.clear();
+    unsigned int batch_begin = 0;
+    while (batch_begin < n_elems)
+    {
+        const quadrature_key_type& key = quad_keys[elem_order[batch_begin]];
+        unsigned int batch_end = batch_begin + 1;
+        while (batch_end < n_elems && batch_end - batch_begin < max_batch_size &&
+               quad_keys[elem_order[batch_end]] == key)
+        {
+            ++batch_end;
+        }
+        batches.emplace_back(batch_begin, batch_end);
+        batch_begin = batch_end;
+    }
+    return;
+}
 
 #if LIBMESH_VERSION_LESS_THAN(1, 6, 0)
 // libMesh's box intersection code is slow and not in a header (i.e., cannot be
@@ -271,6 +327,120 @@ bbox_intersects(const libMeshWrappers::BoundingBox& a, const libMeshWrappers::Bo
     return true;
 }
 #endif
+
+// Get the bounding box of a patch grown by the given number of ghost cells.
+inline libMeshWrappers::BoundingBox
+get_patch_bbox(const Pointer<Patch<NDIM> >& patch, const IntVector<NDIM>& ghost_width)
+{
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    libMeshWrappers::BoundingBox patch_bbox;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        patch_bbox.first(d) = pgeom->getXLower()[d] - dx[d] * ghost_width(d);
+        patch_bbox.second(d) = pgeom->getXUpper()[d] + dx[d] * ghost_width(d);
+    }
+    for (unsigned int d = NDIM; d < LIBMESH_DIM; ++d)
+    {
+        patch_bbox.first(d) = 0.0;
+        patch_bbox.second(d) = 0.0;
+    }
+    return patch_bbox;
+} // get_patch_bbox
+
+// Determine whether or not an element bounding box intersects a patch bounding box.
+inline bool
+elem_bbox_intersects_patch_bbox(const libMeshWrappers::BoundingBox& elem_bbox,
+                                const libMeshWrappers::BoundingBox& patch_bbox)
+{
+#if LIBMESH_VERSION_LESS_THAN(1, 6, 0)
+    return bbox_intersects(elem_bbox, patch_bbox);
+#else
+    // New versions of libMesh have this function's performance problems fixed
+    return elem_bbox.intersects(patch_bbox);
+#endif
+} // elem_bbox_intersects_patch_bbox
+
+// Get the bounding boxes of all elements used to associate elements with the
+// patches of a level. These are the unions of the bounding boxes of the nodes
+// and of the quadrature points of each element.
+std::vector<libMeshWrappers::BoundingBox>
+get_association_bboxes(const MeshBase& mesh,
+                       const System& X_system,
+                       const FEDataManager::InterpSpec& interp_spec,
+                       const Pointer<PatchLevel<NDIM> >& level)
+{
+    double dx_0 = std::numeric_limits<double>::max();
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+        dx_0 = std::min(dx_0, *std::min_element(pgeom->getDx(), pgeom->getDx() + NDIM));
+    }
+    dx_0 = IBTK_MPI::minReduction(dx_0);
+    TBOX_ASSERT(dx_0 != std::numeric_limits<double>::max());
+
+    // be a bit paranoid by computing bounding boxes for elements as the union
+    // of the bounding box of the nodes and the bounding box of the quadrature
+    // points:
+    const std::vector<libMeshWrappers::BoundingBox> local_nodal_bboxes =
+        get_local_element_bounding_boxes(mesh, X_system);
+    const std::vector<libMeshWrappers::BoundingBox> local_qp_bboxes =
+        get_local_element_bounding_boxes(mesh,
+                                         X_system,
+                                         interp_spec.quad_type,
+                                         interp_spec.quad_order,
+                                         interp_spec.use_adaptive_quadrature,
+                                         interp_spec.point_density,
+                                         interp_spec.allow_rules_with_negative_weights,
+                                         dx_0);
+    TBOX_ASSERT(local_nodal_bboxes.size() == local_qp_bboxes.size());
+    std::vector<libMeshWrappers::BoundingBox> local_bboxes;
+    for (std::size_t box_n = 0; box_n < local_nodal_bboxes.size(); ++box_n)
+    {
+        local_bboxes.emplace_back(local_nodal_bboxes[box_n]);
+#if LIBMESH_VERSION_LESS_THAN(1, 2, 0)
+        // no BoundingBox::union_with in libMesh 1.1
+        auto& box = local_bboxes.back();
+        auto& other_box = local_qp_bboxes[box_n];
+        for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+        {
+            box.first(d) = std::min(box.first(d), other_box.first(d));
+            box.second(d) = std::max(box.second(d), other_box.second(d));
+        }
+#else
+        local_bboxes.back().union_with(local_qp_bboxes[box_n]);
+#endif
+    }
+    return get_global_element_bounding_boxes(mesh, local_bboxes);
+} // get_association_bboxes
+
+// Collect the elements of @p elems whose DoFs in all of the given systems are
+// (if @p local is true) or are not (otherwise) owned by the current processor.
+void
+collect_elems_by_dof_ownership(std::vector<Elem*>& subset_elems,
+                               const std::vector<Elem*>& elems,
+                               const bool local,
+                               const std::vector<std::pair<FEData::SystemDofMapCache*, const DofMap*> >& dof_maps)
+{
+    subset_elems.clear();
+    for (Elem* const elem : elems)
+    {
+        bool elem_is_local = true;
+        for (const auto& dof_map_pair : dof_maps)
+        {
+            const dof_id_type first_dof = dof_map_pair.second->first_dof();
+            const dof_id_type end_dof = dof_map_pair.second->end_dof();
+            const boost::multi_array<dof_id_type, 2>& dof_indices = dof_map_pair.first->dof_indices(elem);
+            elem_is_local = std::all_of(dof_indices.data(),
+                                        dof_indices.data() + dof_indices.num_elements(),
+                                        [&](const dof_id_type dof) { return first_dof <= dof && dof < end_dof; });
+            if (!elem_is_local) break;
+        }
+        if (elem_is_local == local) subset_elems.push_back(elem);
+    }
+    return;
+} // collect_elems_by_dof_ownership
 } // namespace
 
 FEData::FEData(std::string object_name, EquationSystems& equation_systems, const bool register_for_restart)
@@ -368,6 +538,27 @@ FEData::clearPatchHierarchyDependentData()
     d_quadrature_cache.clear();
 }
 
+void
+FEData::setUseGeometryCache(const bool use_geometry_cache)
+{
+    if (!use_geometry_cache)
+    {
+        d_geometry_cache.reset();
+        return;
+    }
+    TBOX_ASSERT(d_es);
+    const MeshBase& mesh = d_es->get_mesh();
+    d_geometry_cache = std::make_unique<FEGeometryCache>(mesh.mesh_dimension(), NDIM);
+    d_geometry_cache->reinit(mesh);
+    return;
+} // setUseGeometryCache
+
+const FEGeometryCache*
+FEData::getGeometryCache() const
+{
+    return d_geometry_cache.get();
+} // getGeometryCache
+
 SubdomainToPatchLevelTranslation::SubdomainToPatchLevelTranslation(
     const int max_level_number,
     const std::set<libMesh::subdomain_id_type>& subdomain_ids,
@@ -507,6 +698,8 @@ FEDataManager::setPatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy)
 {
     // Reset the hierarchy.
     TBOX_ASSERT(hierarchy);
+    // Element associations made with a different hierarchy cannot be updated.
+    if (d_hierarchy != hierarchy) d_active_elem_index_boxes.clear();
     d_hierarchy = hierarchy;
     if (!d_eulerian_data_cache)
     {
@@ -598,6 +791,8 @@ FEDataManager::reinitElementMappings()
     d_active_patch_node_map.resize(d_max_level_number + 1);
     d_active_patch_ghost_dofs.clear();
     d_active_elems.clear();
+    d_active_elem_index_boxes.clear();
+    d_active_elem_index_boxes.resize(d_hierarchy->getFinestLevelNumber() + 1);
     d_system_ghost_vec.clear();
     d_system_ib_ghost_vec.clear();
 
@@ -605,7 +800,7 @@ FEDataManager::reinitElementMappings()
     // elements.
     for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
     {
-        collectActivePatchElements(d_active_patch_elem_map[ln], ln, ln, ln);
+        collectActivePatchElements(d_active_patch_elem_map[ln], ln, ln, ln, &d_active_elem_index_boxes[ln]);
         collectActivePatchNodes(d_active_patch_node_map[ln], d_active_patch_elem_map[ln]);
     }
 
@@ -619,125 +814,122 @@ FEDataManager::reinitElementMappings()
     }
     d_active_elems.assign(elem_set.begin(), elem_set.end());
 
-    // If we are not regridding in the usual way (i.e., if
-    // IBHierarchyIntegrator::d_regrid_cfl_interval > 1) then it is possible
-    // that an element has traveled outside of it's assigned patch level. If
-    // this happens then IBFE won't work - we cannot correctly interpolate
-    // velocity at that point. Hence try to detect it by checking that all nodes
-    // are on the interior of some patch (or outside the domain) at the moment.
+    checkActivePatchNodes();
+
+    IBTK_TIMER_STOP(t_reinit_element_mappings);
+    return;
+} // reinitElementMappings
+
+void
+FEDataManager::updateElementMappings()
+{
+    // We can only update the mappings if elements have already been associated
+    // with the patches of the current hierarchy.
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    int can_update = static_cast<int>(d_active_elem_index_boxes.size()) == finest_ln + 1 &&
+                     static_cast<int>(d_active_patch_elem_map.size()) > finest_ln;
+    for (int ln = 0; can_update && ln <= finest_ln; ++ln)
     {
-        const Pointer<CartesianGridGeometry<NDIM> > hier_geom = d_hierarchy->getGridGeometry();
-        // TODO - we only support single box geometries right now
-        TBOX_ASSERT(hier_geom);
-        const double* const hier_x_lower = hier_geom->getXLower();
-        const double* const hier_x_upper = hier_geom->getXUpper();
-        const int rank = IBTK_MPI::getRank();
-        const int n_procs = IBTK_MPI::getNodes();
-        const MeshBase& mesh = getEquationSystems()->get_mesh();
-        std::unique_ptr<PetscVector<double> > X_petsc_vec = buildIBGhostedVector(getCurrentCoordinatesSystemName());
-        *X_petsc_vec = *getCoordsVector();
-        X_petsc_vec->close();
-        const double* const X_local_soln = X_petsc_vec->get_array_read();
-        const DofMap& X_dof_map = d_fe_data->d_es->get_system(getCurrentCoordinatesSystemName()).get_dof_map();
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        can_update = static_cast<int>(d_active_patch_elem_map[ln].size()) ==
+                     level->getProcessorMapping().getNumberOfLocalIndices();
+    }
+    if (IBTK_MPI::minReduction(can_update) == 0)
+    {
+        reinitElementMappings();
+        return;
+    }
 
-        std::vector<int> node_ranks(mesh.parallel_n_nodes());
-        std::vector<dof_id_type> X_idxs;
-        for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    IBTK_TIMER_START(t_update_element_mappings);
+
+    MeshBase& mesh = d_fe_data->d_es->get_mesh();
+    System& X_system = d_fe_data->d_es->get_system(getCurrentCoordinatesSystemName());
+    int num_changed_elems = 0;
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        if (!d_level_lookup.levelHasElements(ln)) continue;
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
+        const IntVector<NDIM>& ratio = level->getRatio();
+
+        // Use the same bounding boxes as collectActivePatchElements() so that
+        // the updated mappings are the same as the reinitialized ones.
+        const std::vector<libMeshWrappers::BoundingBox> global_bboxes =
+            get_association_bboxes(mesh, X_system, d_default_interp_spec, level);
+        std::vector<Box<NDIM> >& elem_index_boxes = d_active_elem_index_boxes[ln];
+        TBOX_ASSERT(elem_index_boxes.size() == global_bboxes.size());
+
+        std::vector<libMeshWrappers::BoundingBox> patch_bboxes;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
-            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-            int local_patch_num = 0;
-            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
-            {
-                const Pointer<Patch<NDIM> > patch = level->getPatch(p());
-                const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-                const double* const patch_x_lower = patch_geom->getXLower();
-                const double* const patch_x_upper = patch_geom->getXUpper();
+            patch_bboxes.push_back(get_patch_bbox(level->getPatch(p()), d_associated_elem_ghost_width));
+        }
 
-                for (const Node* n : d_active_patch_node_map[ln][local_patch_num])
+        // Reassociate the elements that have moved into different cells. The
+        // element vectors of each patch are kept sorted in the same order as
+        // those computed by collectActivePatchElements().
+        std::vector<std::vector<Elem*> >& active_patch_elems = d_active_patch_elem_map[ln];
+        bool level_changed = false;
+        auto el_it = mesh.elements_begin();
+        for (std::size_t k = 0; k < global_bboxes.size(); ++k, ++el_it)
+        {
+            Elem* const elem = *el_it;
+            if (!elem->active() || getPatchLevel(elem) != ln) continue;
+            const Box<NDIM> index_box(IndexUtilities::getCellIndex(global_bboxes[k].first, grid_geom, ratio),
+                                      IndexUtilities::getCellIndex(global_bboxes[k].second, grid_geom, ratio));
+            if (index_box == elem_index_boxes[k]) continue;
+            elem_index_boxes[k] = index_box;
+            ++num_changed_elems;
+
+            for (std::size_t patch_num = 0; patch_num < active_patch_elems.size(); ++patch_num)
+            {
+                std::vector<Elem*>& elems = active_patch_elems[patch_num];
+                const auto it = std::lower_bound(elems.begin(), elems.end(), elem, std::less<Elem*>());
+                const bool was_associated = it != elems.end() && *it == elem;
+                const bool is_associated = elem_bbox_intersects_patch_bbox(global_bboxes[k], patch_bboxes[patch_num]);
+                if (was_associated && !is_associated)
                 {
-                    IBTK::Point X;
-                    bool inside_patch = true;
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        IBTK::get_nodal_dof_indices(X_dof_map, n, d, X_idxs);
-                        X[d] = X_local_soln[X_petsc_vec->map_global_to_local_index(X_idxs[0])];
-                        // Due to how SAMRAI computes patch boundaries, even if the
-                        // patch's domain is [0, 1]^2 the patches on the boundary
-                        // may not actually end at 1.0. Hence allow a small
-                        // tolerance here to account for the case where two patches
-                        // are adjacent to each-other but their patch boundaries
-                        // don't quite line up:
-                        const double x_lower = patch_x_lower[d] - std::max(1.0, std::abs(patch_x_lower[d])) * 1e-14;
-                        const double x_upper = patch_x_upper[d] + std::max(1.0, std::abs(patch_x_upper[d])) * 1e-14;
-                        inside_patch = inside_patch && (x_lower <= X[d] && X[d] <= x_upper);
-                    }
-                    if (inside_patch)
-                    {
-                        node_ranks[n->id()] = rank + 1;
-                    }
-                    else
-                    {
-                        // Points are allowed to be outside the domain - they simply
-                        // are no longer used for IB calculations.
-                        bool inside_hier = true;
-                        for (unsigned int d = 0; d < NDIM; ++d)
-                        {
-                            // Like above - permit points very close to the boundary
-                            // to pass the check and treat them as being outside
-                            const double x_lower = hier_x_lower[d] + std::max(1.0, std::abs(hier_x_lower[d])) * 1e-14;
-                            const double x_upper = hier_x_upper[d] - std::max(1.0, std::abs(hier_x_upper[d])) * 1e-14;
-                            inside_hier = inside_hier && (x_lower <= X[d] && X[d] <= x_upper);
-                        }
-                        if (!inside_hier)
-                        {
-                            node_ranks[n->id()] = n_procs + 1;
-                        }
-                    }
+                    elems.erase(it);
+                    level_changed = true;
+                }
+                else if (!was_associated && is_associated)
+                {
+                    elems.insert(it, elem);
+                    level_changed = true;
                 }
             }
         }
-        X_petsc_vec->restore_array();
+        if (level_changed) collectActivePatchNodes(d_active_patch_node_map[ln], active_patch_elems);
+    }
+
+    // Elements that moved within the cells they already covered cannot have
+    // changed their patch associations, so if no element changed cells then
+    // there is nothing else to do.
+    if (IBTK_MPI::sumReduction(num_changed_elems) > 0)
+    {
+        // The partitioning is unchanged so the cached DoF and quadrature data
+        // are still valid, but the ghost data may not be.
+        d_L2_proj_matrix_diag_ghost.clear();
+        d_active_patch_ghost_dofs.clear();
+        d_system_ghost_vec.clear();
+        d_system_ib_ghost_vec.clear();
 
-        // send everything to rank 0 instead of doing an all-to-all:
-        IBTK_MPI::allToOneSumReduction(node_ranks.data(), node_ranks.size());
-        if (rank == 0)
+        std::set<Elem*> elem_set;
+        for (const std::vector<std::vector<Elem*> >& level_elems : d_active_patch_elem_map)
         {
-            const std::string message =
-                "At least one node in the current mesh is inside the fluid domain and not associated with any "
-                "patch. This class currently assumes that all elements are on the finest level and will not "
-                "work correctly if this assumption does not hold. This usually happens when you use multiple "
-                "patch levels and set the regrid CFL interval to a value larger than one. To change this check "
-                "set node_outside_patch_check to a different value in the input database: see the documentation "
-                "of FEDataManager for more information.";
-            for (const int node_rank : node_ranks)
+            for (const std::vector<Elem*>& patch_elems : level_elems)
             {
-                if (node_rank == 0)
-                {
-                    switch (d_node_patch_check)
-                    {
-                    case NODE_OUTSIDE_PERMIT:
-                        break;
-                    case NODE_OUTSIDE_WARN:
-                        TBOX_WARNING(message);
-                        break;
-                    case NODE_OUTSIDE_ERROR:
-                        TBOX_ERROR(message);
-                        break;
-                    default:
-                        // we shouldn't get here
-                        TBOX_ERROR("unrecognized value for d_node_patch_check");
-                        break;
-                    }
-                    // no need to check more nodes if we already found one outside
-                    break;
-                }
+                elem_set.insert(patch_elems.begin(), patch_elems.end());
             }
         }
+        d_active_elems.assign(elem_set.begin(), elem_set.end());
+
+        checkActivePatchNodes();
     }
 
-    IBTK_TIMER_STOP(t_reinit_element_mappings);
+    IBTK_TIMER_STOP(t_update_element_mappings);
     return;
-} // reinitElementMappings
+} // updateElementMappings
 
 NumericVector<double>*
 FEDataManager::getSolutionVector(const std::string& system_name) const
@@ -976,7 +1168,8 @@ FEDataManager::spread(const int f_data_idx,
                       NumericVector<double>& F_vec,
                       NumericVector<double>& X_vec,
                       const std::string& system_name,
-                      const FEDataManager::SpreadSpec& spread_spec)
+                      const FEDataManager::SpreadSpec& spread_spec,
+                      const FEDataManager::ElementSubset elem_subset)
 {
     IBTK_TIMER_START(t_spread);
 
@@ -1026,6 +1219,10 @@ FEDataManager::spread(const int f_data_idx,
     FEMappingCache<NDIM, NDIM> volume_mapping_cache(FEUpdateFlags::update_JxW);
     FEMappingCache<NDIM - 1, NDIM> surface_mapping_cache(FEUpdateFlags::update_JxW);
     const bool is_volume_mesh = dim == NDIM;
+    // The shape function values only depend on the quadrature rule, so FE
+    // objects are shared by all elements of a batch. As in FECache, the values
+    // of subdivision elements must always be recomputed.
+    const bool fe_needs_reinit = F_fe_type.family == SUBDIVISION || X_fe_type.family == SUBDIVISION;
 
     // Check to see if we are using nodal quadrature.
     const bool use_nodal_quadrature = spread_spec.use_nodal_quadrature;
@@ -1040,7 +1237,7 @@ FEDataManager::spread(const int f_data_idx,
     TBOX_ASSERT(std::find(fe_family_whitelist.begin(), fe_family_whitelist.end(), X_fe_type.family) !=
                 fe_family_whitelist.end());
 
-    if (use_nodal_quadrature)
+    if (use_nodal_quadrature && elem_subset != LOCAL_ELEMS)
     {
         // Multiply by the nodal volume fractions (to convert densities into
         // values).
@@ -1136,7 +1333,7 @@ FEDataManager::spread(const int f_data_idx,
         F_x_dX_petsc_vec->restore_array();
         X_petsc_vec->restore_array();
     }
-    else
+    else if (!use_nodal_quadrature)
     {
         // Extract local form vectors.
         auto F_petsc_vec = static_cast<PetscVector<double>*>(&F_vec);
@@ -1145,11 +1342,19 @@ FEDataManager::spread(const int f_data_idx,
         auto X_petsc_vec = static_cast<PetscVector<double>*>(&X_vec);
         const double* const X_local_soln = X_petsc_vec->get_array_read();
 
+        // Elements are local if both their F and X DoFs are locally owned.
+        const std::vector<std::pair<FEData::SystemDofMapCache*, const DofMap*> > subset_dof_maps{
+            { &F_dof_map_cache, &F_dof_map }, { &X_dof_map_cache, &X_dof_map }
+        };
+        std::vector<Elem*> patch_elems_subset;
+
         // Loop over the patches to interpolate nodal values on the FE mesh to
         // the element quadrature points, then spread those values onto the
         // Eulerian grid.
         boost::multi_array<double, 2> F_node;
         std::vector<double> F_JxW_qp, X_qp;
+        std::vector<unsigned int> elem_order;
+        std::vector<std::pair<unsigned int, unsigned int> > elem_batches;
         for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
         {
             Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -1158,7 +1363,13 @@ FEDataManager::spread(const int f_data_idx,
             for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
             {
                 // The relevant collection of elements.
-                const std::vector<Elem*>& patch_elems = d_active_patch_elem_map[ln][local_patch_num];
+                const std::vector<Elem*>& all_patch_elems = d_active_patch_elem_map[ln][local_patch_num];
+                if (elem_subset != ALL_ELEMS)
+                {
+                    collect_elems_by_dof_ownership(
+                        patch_elems_subset, all_patch_elems, elem_subset == LOCAL_ELEMS, subset_dof_maps);
+                }
+                const std::vector<Elem*>& patch_elems = elem_subset == ALL_ELEMS ? all_patch_elems : patch_elems_subset;
                 const size_t num_active_patch_elems = patch_elems.size();
                 if (!num_active_patch_elems) continue;
 
@@ -1201,39 +1412,57 @@ FEDataManager::spread(const int f_data_idx,
                 F_JxW_qp.resize(n_vars * n_qp_patch);
                 X_qp.resize(NDIM * n_qp_patch);
 
-                // Loop over the elements and compute the values to be spread and
-                // the positions of the quadrature points.
+                // Loop over the elements, in batches of elements sharing the
+                // same quadrature rule, and compute the values to be spread
+                // and the positions of the quadrature points. The values of
+                // each batch are stored contiguously.
+                batch_elems_by_quadrature_key(
+                    quad_keys, std::numeric_limits<unsigned int>::max(), elem_order, elem_batches);
                 int qp_offset = 0;
-                for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+                for (const auto& batch : elem_batches)
                 {
-                    Elem* const elem = patch_elems[e_idx];
-                    const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
-                    get_values_for_interpolation(F_node, *F_petsc_vec, F_local_soln, F_dof_indices);
-                    const quad_key_type& key = quad_keys[e_idx];
-                    const FEBase& X_fe = X_fe_cache(key, elem);
-                    const FEBase& F_fe = F_fe_cache(key, elem);
+                    const quad_key_type& key = quad_keys[elem_order[batch.first]];
+                    Elem* const first_elem = patch_elems[elem_order[batch.first]];
+                    FEBase& X_fe = X_fe_cache(key, first_elem);
+                    FEBase& F_fe = F_fe_cache(key, first_elem);
                     const QBase& qrule = d_fe_data->d_quadrature_cache[key];
-
-                    // JxW depends on the element
-                    const std::vector<double>& JxW_F =
-                        get_JxW(key, elem, is_volume_mesh, volume_mapping_cache, surface_mapping_cache);
+                    FEMapping<NDIM, NDIM>* const volume_mapping =
+                        is_volume_mesh ? &volume_mapping_cache[key] : nullptr;
+                    FEMapping<NDIM - 1, NDIM>* const surface_mapping =
+                        is_volume_mesh ? nullptr : &surface_mapping_cache[key];
                     const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
                     const std::vector<std::vector<double> >& phi_X = X_fe.get_phi();
-
                     const unsigned int n_qp = qrule.n_points();
-                    TBOX_ASSERT(n_qp == phi_F[0].size());
-                    TBOX_ASSERT(n_qp == phi_X[0].size());
-                    TBOX_ASSERT(n_qp == JxW_F.size());
-                    double* F_begin = &F_JxW_qp[n_vars * qp_offset];
-                    double* X_begin = &X_qp[NDIM * qp_offset];
-                    std::fill(F_begin, F_begin + n_vars * n_qp, 0.0);
-                    std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
-
-                    sum_weighted_elem_solution</*weights_are_unity*/ false>(
-                        n_vars, F_dof_indices[0].size(), qp_offset, phi_F, JxW_F, F_node, F_JxW_qp);
-                    sum_weighted_elem_solution</*weights_are_unity*/ true>(
-                        NDIM, phi_X.size(), qp_offset, phi_X, {}, X_nodes[e_idx], X_qp);
-                    qp_offset += n_qp;
+
+                    for (unsigned int k = batch.first; k < batch.second; ++k)
+                    {
+                        const unsigned int e_idx = elem_order[k];
+                        Elem* const elem = patch_elems[e_idx];
+                        if (k != batch.first && fe_needs_reinit)
+                        {
+                            X_fe.reinit(elem);
+                            F_fe.reinit(elem);
+                        }
+                        const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
+                        get_values_for_interpolation(F_node, *F_petsc_vec, F_local_soln, F_dof_indices);
+
+                        // JxW depends on the element
+                        const std::vector<double>& JxW_F = get_JxW(elem, volume_mapping, surface_mapping);
+
+                        TBOX_ASSERT(n_qp == phi_F[0].size());
+                        TBOX_ASSERT(n_qp == phi_X[0].size());
+                        TBOX_ASSERT(n_qp == JxW_F.size());
+                        double* F_begin = &F_JxW_qp[n_vars * qp_offset];
+                        double* X_begin = &X_qp[NDIM * qp_offset];
+                        std::fill(F_begin, F_begin + n_vars * n_qp, 0.0);
+                        std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
+
+                        sum_weighted_elem_solution</*weights_are_unity*/ false>(
+                            n_vars, F_dof_indices[0].size(), qp_offset, phi_F, JxW_F, F_node, F_JxW_qp);
+                        sum_weighted_elem_solution</*weights_are_unity*/ true>(
+                            NDIM, phi_X.size(), qp_offset, phi_X, {}, X_nodes[e_idx], X_qp);
+                        qp_offset += n_qp;
+                    }
                 }
 
                 zeroExteriorValues(*patch_geom, X_qp, F_JxW_qp, n_vars);
@@ -1724,7 +1953,8 @@ FEDataManager::interpWeighted(const int f_data_idx,
                               const std::vector<Pointer<RefineSchedule<NDIM> > >& f_refine_scheds,
                               const double fill_data_time,
                               const bool close_F,
-                              const bool close_X)
+                              const bool close_X,
+                              const FEDataManager::ElementSubset elem_subset)
 {
     IBTK_TIMER_START(t_interp_weighted);
 
@@ -1768,11 +1998,26 @@ FEDataManager::interpWeighted(const int f_data_idx,
 
     // convenience alias for the quadrature key type used by FECache and FEMappingCache
     using quad_key_type = quadrature_key_type;
-    FECache F_fe_cache(dim, F_fe_type, FEUpdateFlags::update_phi);
-    FECache X_fe_cache(dim, X_fe_type, FEUpdateFlags::update_phi);
-    FEMappingCache<NDIM, NDIM> volume_mapping_cache(FEUpdateFlags::update_JxW);
-    FEMappingCache<NDIM - 1, NDIM> surface_mapping_cache(FEUpdateFlags::update_JxW);
+    // The cached FE objects are reinitialized on every access, so each thread
+    // needs its own caches.
+    const int num_threads = LEInteractor::getUseThreadedInterpolation() ? LEInteractor::getNumThreads() : 1;
+    std::vector<std::unique_ptr<FECache> > F_fe_caches(num_threads), X_fe_caches(num_threads);
+    std::vector<std::unique_ptr<FEMappingCache<NDIM, NDIM> > > volume_mapping_caches(num_threads);
+    std::vector<std::unique_ptr<FEMappingCache<NDIM - 1, NDIM> > > surface_mapping_caches(num_threads);
+    for (int thread_num = 0; thread_num < num_threads; ++thread_num)
+    {
+        F_fe_caches[thread_num] = std::make_unique<FECache>(dim, F_fe_type, FEUpdateFlags::update_phi);
+        X_fe_caches[thread_num] = std::make_unique<FECache>(dim, X_fe_type, FEUpdateFlags::update_phi);
+        volume_mapping_caches[thread_num] =
+            std::make_unique<FEMappingCache<NDIM, NDIM> >(FEUpdateFlags::update_JxW);
+        surface_mapping_caches[thread_num] =
+            std::make_unique<FEMappingCache<NDIM - 1, NDIM> >(FEUpdateFlags::update_JxW);
+    }
     const bool is_volume_mesh = dim == NDIM;
+    // The shape function values only depend on the quadrature rule, so FE
+    // objects are shared by all elements of a batch. As in FECache, the values
+    // of subdivision elements must always be recomputed.
+    const bool fe_needs_reinit = F_fe_type.family == SUBDIVISION || X_fe_type.family == SUBDIVISION;
 
     // Communicate any unsynchronized ghost data.
     for (const auto& f_refine_sched : f_refine_scheds)
@@ -1802,7 +2047,7 @@ FEDataManager::interpWeighted(const int f_data_idx,
     // Since we do a lot of assembly in this routine into off-processor
     // entries we will directly insert into the ghost values (and then
     // scatter in the calling function with the usual batch function).
-    F_vec.zero();
+    if (elem_subset != NONLOCAL_ELEMS) F_vec.zero();
     auto F_petsc_vec = dynamic_cast<PetscVector<double>*>(&F_vec);
     Vec F_local_form = nullptr;
     double* F_local_soln = nullptr;
@@ -1819,7 +2064,7 @@ FEDataManager::interpWeighted(const int f_data_idx,
         IBTK_CHKERRQ(ierr);
     }
 
-    if (use_nodal_quadrature)
+    if (use_nodal_quadrature && elem_subset != LOCAL_ELEMS)
     {
         // Extract local form vectors.
         PetscVector<double>* dX_vec = buildIBGhostedDiagonalL2MassMatrix(system_name);
@@ -1932,16 +2177,28 @@ FEDataManager::interpWeighted(const int f_data_idx,
         // Restore local form vectors.
         dX_vec->restore_array();
     }
-    else
+    else if (!use_nodal_quadrature)
     {
+        // Only the X DoFs are read, so elements are local if their X DoFs are
+        // locally owned.
+        const std::vector<std::pair<FEData::SystemDofMapCache*, const DofMap*> > subset_dof_maps{
+            { &X_dof_map_cache, &X_dof_map }
+        };
+        std::vector<Elem*> patch_elems_subset;
+
         // Loop over the patches to interpolate values to the element quadrature
         // points from the grid, then use these values to compute the projection
         // of the interpolated velocity field onto the FE basis functions.
         DenseVector<double> F_rhs;
-        // Assemble F_rhs_e's vectors in an interleaved format (see the implementation):
-        std::vector<double> F_rhs_concatenated;
+        // Assemble F_rhs_e's vectors in an interleaved format (see the
+        // implementation). Each thread gets its own scratch vector.
+        std::vector<std::vector<double> > F_rhs_concatenated(num_threads);
+        std::vector<double> F_rhs_patch;
         std::vector<double> F_qp, X_qp;
         std::vector<libMesh::dof_id_type> dof_id_scratch;
+        std::vector<unsigned int> elem_order;
+        std::vector<std::pair<unsigned int, unsigned int> > elem_batches;
+        const unsigned int max_batch_size = num_threads > 1 ? 64 : std::numeric_limits<unsigned int>::max();
         for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
         {
             Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -1949,7 +2206,13 @@ FEDataManager::interpWeighted(const int f_data_idx,
             for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
             {
                 // The relevant collection of elements.
-                const std::vector<Elem*>& patch_elems = d_active_patch_elem_map[ln][local_patch_num];
+                const std::vector<Elem*>& all_patch_elems = d_active_patch_elem_map[ln][local_patch_num];
+                if (elem_subset != ALL_ELEMS)
+                {
+                    collect_elems_by_dof_ownership(
+                        patch_elems_subset, all_patch_elems, elem_subset == LOCAL_ELEMS, subset_dof_maps);
+                }
+                const std::vector<Elem*>& patch_elems = elem_subset == ALL_ELEMS ? all_patch_elems : patch_elems_subset;
                 const size_t num_active_patch_elems = patch_elems.size();
                 if (!num_active_patch_elems) continue;
 
@@ -1966,8 +2229,12 @@ FEDataManager::interpWeighted(const int f_data_idx,
                 std::vector<boost::multi_array<double, 2> > X_nodes(num_active_patch_elems);
 
                 // Setup vectors to store the values of F and X at the quadrature
-                // points.
-                unsigned int n_qp_patch = 0;
+                // points. The offsets of each element's values in the patch
+                // arrays are computed up front so that the element loops below
+                // may be run concurrently. This loop also populates the
+                // (non-thread-safe) quadrature rule and DoF caches.
+                std::vector<int> qp_offsets(num_active_patch_elems + 1, 0);
+                std::vector<int> rhs_offsets(num_active_patch_elems + 1, 0);
                 for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
                 {
                     Elem* const elem = patch_elems[e_idx];
@@ -1982,33 +2249,51 @@ FEDataManager::interpWeighted(const int f_data_idx,
                                                                X_nodes[e_idx],
                                                                patch_dx_min);
                     QBase& qrule = d_fe_data->d_quadrature_cache[key];
-                    n_qp_patch += qrule.n_points();
+                    qp_offsets[e_idx + 1] = qp_offsets[e_idx] + qrule.n_points();
                     quad_keys[e_idx] = key;
+                    const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
+                    rhs_offsets[e_idx + 1] = rhs_offsets[e_idx] + n_vars * F_dof_indices[0].size();
                 }
+                const unsigned int n_qp_patch = qp_offsets[num_active_patch_elems];
                 if (!n_qp_patch) continue;
                 F_qp.resize(n_vars * n_qp_patch);
                 X_qp.resize(NDIM * n_qp_patch);
                 std::fill(F_qp.begin(), F_qp.end(), 0.0);
 
+                // Group the elements into batches sharing the same quadrature
+                // rule. Batches are also the units of work of the threaded
+                // loops below, so their size is limited to keep the work
+                // balanced.
+                batch_elems_by_quadrature_key(quad_keys, max_batch_size, elem_order, elem_batches);
+                const int n_batches = static_cast<int>(elem_batches.size());
+
                 // Loop over the elements and compute the positions of the
                 // quadrature points.
-                int qp_offset = 0;
-                for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+#ifdef IBTK_HAVE_OPENMP
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+#endif
+                for (int batch_num = 0; batch_num < n_batches; ++batch_num)
                 {
-                    Elem* const elem = patch_elems[e_idx];
-                    TBOX_ASSERT(elem->active());
-                    const quad_key_type& key = quad_keys[e_idx];
-                    const QBase& qrule = d_fe_data->d_quadrature_cache[key];
-                    const FEBase& X_fe = X_fe_cache(key, elem);
+                    const int thread_num = get_thread_num();
+                    const auto& batch = elem_batches[batch_num];
+                    const quad_key_type& key = quad_keys[elem_order[batch.first]];
+                    FEBase& X_fe = (*X_fe_caches[thread_num])(key, patch_elems[elem_order[batch.first]]);
                     const std::vector<std::vector<double> >& phi_X = X_fe.get_phi();
-
-                    const unsigned int n_node = elem->n_nodes();
-                    const unsigned int n_qp = qrule.n_points();
-                    TBOX_ASSERT(n_qp == phi_X[0].size());
-                    double* X_begin = &X_qp[NDIM * qp_offset];
-                    std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
-                    sum_weighted_elem_solution<true>(NDIM, n_node, qp_offset, phi_X, {}, X_nodes[e_idx], X_qp);
-                    qp_offset += n_qp;
+                    for (unsigned int k = batch.first; k < batch.second; ++k)
+                    {
+                        const unsigned int e_idx = elem_order[k];
+                        Elem* const elem = patch_elems[e_idx];
+                        TBOX_ASSERT(elem->active());
+                        if (k != batch.first && fe_needs_reinit) X_fe.reinit(elem);
+
+                        const unsigned int n_node = elem->n_nodes();
+                        const int qp_offset = qp_offsets[e_idx];
+                        const unsigned int n_qp = qp_offsets[e_idx + 1] - qp_offset;
+                        TBOX_ASSERT(n_qp == phi_X[0].size());
+                        double* X_begin = &X_qp[NDIM * qp_offset];
+                        std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
+                        sum_weighted_elem_solution<true>(NDIM, n_node, qp_offset, phi_X, {}, X_nodes[e_idx], X_qp);
+                    }
                 }
 
                 // Interpolate values from the Cartesian grid patch to the
@@ -2031,8 +2316,47 @@ FEDataManager::interpWeighted(const int f_data_idx,
                         F_qp, n_vars, X_qp, NDIM, f_sc_data, patch, interp_box, interp_spec.kernel_fcn);
                 }
 
+                // Loop over the elements and compute the right-hand-side
+                // values. Neighboring elements share DoFs, so these are
+                // accumulated into the global vector in a separate loop.
+                F_rhs_patch.resize(rhs_offsets[num_active_patch_elems]);
+#ifdef IBTK_HAVE_OPENMP
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+#endif
+                for (int batch_num = 0; batch_num < n_batches; ++batch_num)
+                {
+                    const int thread_num = get_thread_num();
+                    const auto& batch = elem_batches[batch_num];
+                    const quad_key_type& key = quad_keys[elem_order[batch.first]];
+                    FEBase& F_fe = (*F_fe_caches[thread_num])(key, patch_elems[elem_order[batch.first]]);
+                    FEMapping<NDIM, NDIM>* const volume_mapping =
+                        is_volume_mesh ? &(*volume_mapping_caches[thread_num])[key] : nullptr;
+                    FEMapping<NDIM - 1, NDIM>* const surface_mapping =
+                        is_volume_mesh ? nullptr : &(*surface_mapping_caches[thread_num])[key];
+                    const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
+                    std::vector<double>& F_rhs_elem = F_rhs_concatenated[thread_num];
+                    for (unsigned int k = batch.first; k < batch.second; ++k)
+                    {
+                        const unsigned int e_idx = elem_order[k];
+                        Elem* const elem = patch_elems[e_idx];
+                        if (k != batch.first && fe_needs_reinit) F_fe.reinit(elem);
+                        const size_t n_basis = (rhs_offsets[e_idx + 1] - rhs_offsets[e_idx]) / n_vars;
+                        F_rhs_elem.resize(n_vars * n_basis);
+                        std::fill(F_rhs_elem.begin(), F_rhs_elem.end(), 0.0);
+
+                        // JxW depends on the element
+                        const std::vector<double>& JxW_F = get_JxW(elem, volume_mapping, surface_mapping);
+
+                        const int qp_offset = qp_offsets[e_idx];
+                        const unsigned int n_qp = qp_offsets[e_idx + 1] - qp_offset;
+                        TBOX_ASSERT(n_qp == phi_F[0].size());
+                        TBOX_ASSERT(n_qp == JxW_F.size());
+                        integrate_elem_rhs(n_vars, n_basis, qp_offset, phi_F, JxW_F, F_qp, F_rhs_elem);
+                        std::copy(F_rhs_elem.begin(), F_rhs_elem.end(), F_rhs_patch.begin() + rhs_offsets[e_idx]);
+                    }
+                }
+
                 // Loop over the elements and accumulate the right-hand-side values.
-                qp_offset = 0;
                 for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
                 {
                     Elem* const elem = patch_elems[e_idx];
@@ -2044,28 +2368,13 @@ FEDataManager::interpWeighted(const int f_data_idx,
                         TBOX_ASSERT(F_dof_indices[i].size() == F_dof_indices[0].size());
                     }
 #endif
-                    F_rhs_concatenated.resize(n_vars * F_dof_indices[0].size());
-                    std::fill(F_rhs_concatenated.begin(), F_rhs_concatenated.end(), 0.0);
-                    const quad_key_type& key = quad_keys[e_idx];
-                    const FEBase& F_fe = F_fe_cache(key, elem);
-                    const QBase& qrule = d_fe_data->d_quadrature_cache[key];
-
-                    // JxW depends on the element
-                    const std::vector<double>& JxW_F =
-                        get_JxW(key, elem, is_volume_mesh, volume_mapping_cache, surface_mapping_cache);
-                    const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
-
-                    const unsigned int n_qp = qrule.n_points();
-                    TBOX_ASSERT(n_qp == phi_F[0].size());
-                    TBOX_ASSERT(n_qp == JxW_F.size());
                     const size_t n_basis = F_dof_indices[0].size();
-                    integrate_elem_rhs(n_vars, n_basis, qp_offset, phi_F, JxW_F, F_qp, F_rhs_concatenated);
-
+                    const auto F_rhs_elem_begin = F_rhs_patch.begin() + rhs_offsets[e_idx];
                     for (unsigned int var_n = 0; var_n < n_vars; ++var_n)
                     {
                         F_rhs.resize(F_dof_indices[var_n].size());
-                        std::copy(F_rhs_concatenated.begin() + var_n * n_basis,
-                                  F_rhs_concatenated.begin() + (var_n + 1) * n_basis,
+                        std::copy(F_rhs_elem_begin + var_n * n_basis,
+                                  F_rhs_elem_begin + (var_n + 1) * n_basis,
                                   F_rhs.get_values().begin());
 
                         // We do *not* apply constraints here. See the note in the
@@ -2088,7 +2397,6 @@ FEDataManager::interpWeighted(const int f_data_idx,
                             F_vec.add_vector(F_rhs, dof_id_scratch);
                         }
                     }
-                    qp_offset += n_qp;
                 }
             }
         }
@@ -2887,6 +3195,8 @@ FEDataManager::FEDataManager(std::string object_name,
     IBTK_DO_ONCE(
         t_reinit_element_mappings =
             TimerManager::getManager()->getTimer("IBTK::FEDataManager::reinitElementMappings()");
+        t_update_element_mappings =
+            TimerManager::getManager()->getTimer("IBTK::FEDataManager::updateElementMappings()");
         t_build_ghosted_solution_vector =
             TimerManager::getManager()->getTimer("IBTK::FEDataManager::buildGhostedSolutionVector()");
         t_build_ghosted_vector = TimerManager::getManager()->getTimer("IBTK::FEDataManager::buildGhostedVector()");
@@ -3093,7 +3403,8 @@ void
 FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& active_patch_elems,
                                           const int level_number,
                                           const int coarsest_elem_ln,
-                                          const int finest_elem_ln)
+                                          const int finest_elem_ln,
+                                          std::vector<Box<NDIM> >* const elem_index_boxes)
 {
     // Get the necessary FE data.
     //
@@ -3109,6 +3420,7 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
     const int num_local_patches = level->getProcessorMapping().getNumberOfLocalIndices();
     std::vector<std::set<Elem*> > local_patch_elems(num_local_patches);
     active_patch_elems.resize(num_local_patches);
+    if (elem_index_boxes) elem_index_boxes->clear();
 
     // Try to exit quickly if no patches will actually have elements (i.e., if
     // there are no elements assigned to the range of levels we are working
@@ -3124,70 +3436,26 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
     // bounding box (which is computed based on the bounds of quadrature
     // points) intersects the patch interior grown by
     // d_associated_elem_ghost_width (which is presently assumed to be 1).
-    double dx_0 = std::numeric_limits<double>::max();
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-    {
-        Pointer<Patch<NDIM> > patch = level->getPatch(p());
-        const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-        dx_0 = std::min(dx_0, *std::min_element(pgeom->getDx(), pgeom->getDx() + NDIM));
-    }
-    dx_0 = IBTK_MPI::minReduction(dx_0);
-    TBOX_ASSERT(dx_0 != std::numeric_limits<double>::max());
-
-    // be a bit paranoid by computing bounding boxes for elements as the union
-    // of the bounding box of the nodes and the bounding box of the quadrature
-    // points:
-    const std::vector<libMeshWrappers::BoundingBox> local_nodal_bboxes =
-        get_local_element_bounding_boxes(mesh, X_system);
-    const std::vector<libMeshWrappers::BoundingBox> local_qp_bboxes =
-        get_local_element_bounding_boxes(mesh,
-                                         X_system,
-                                         d_default_interp_spec.quad_type,
-                                         d_default_interp_spec.quad_order,
-                                         d_default_interp_spec.use_adaptive_quadrature,
-                                         d_default_interp_spec.point_density,
-                                         d_default_interp_spec.allow_rules_with_negative_weights,
-                                         dx_0);
-    TBOX_ASSERT(local_nodal_bboxes.size() == local_qp_bboxes.size());
-    std::vector<libMeshWrappers::BoundingBox> local_bboxes;
-    for (std::size_t box_n = 0; box_n < local_nodal_bboxes.size(); ++box_n)
+    const std::vector<libMeshWrappers::BoundingBox> global_bboxes =
+        get_association_bboxes(mesh, X_system, d_default_interp_spec, level);
+    if (elem_index_boxes)
     {
-        local_bboxes.emplace_back(local_nodal_bboxes[box_n]);
-#if LIBMESH_VERSION_LESS_THAN(1, 2, 0)
-        // no BoundingBox::union_with in libMesh 1.1
-        auto& box = local_bboxes.back();
-        auto& other_box = local_qp_bboxes[box_n];
-        for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+        const IntVector<NDIM>& ratio = level->getRatio();
+        elem_index_boxes->reserve(global_bboxes.size());
+        for (const libMeshWrappers::BoundingBox& bbox : global_bboxes)
         {
-            box.first(d) = std::min(box.first(d), other_box.first(d));
-            box.second(d) = std::max(box.second(d), other_box.second(d));
+            elem_index_boxes->emplace_back(IndexUtilities::getCellIndex(bbox.first, grid_geom, ratio),
+                                           IndexUtilities::getCellIndex(bbox.second, grid_geom, ratio));
         }
-#else
-        local_bboxes.back().union_with(local_qp_bboxes[box_n]);
-#endif
     }
-    const std::vector<libMeshWrappers::BoundingBox> global_bboxes =
-        get_global_element_bounding_boxes(mesh, local_bboxes);
 
     int local_patch_num = 0;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
     {
         std::set<Elem*>& elems = local_patch_elems[local_patch_num];
         Pointer<Patch<NDIM> > patch = level->getPatch(p());
-        const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-        const double* const dx = pgeom->getDx();
         // TODO: reimplement this with an rtree description of SAMRAI's patches
-        libMeshWrappers::BoundingBox patch_bbox;
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            patch_bbox.first(d) = pgeom->getXLower()[d] - dx[d] * d_associated_elem_ghost_width(d);
-            patch_bbox.second(d) = pgeom->getXUpper()[d] + dx[d] * d_associated_elem_ghost_width(d);
-        }
-        for (unsigned int d = NDIM; d < LIBMESH_DIM; ++d)
-        {
-            patch_bbox.first(d) = 0.0;
-            patch_bbox.second(d) = 0.0;
-        }
+        const libMeshWrappers::BoundingBox patch_bbox = get_patch_bbox(patch, d_associated_elem_ghost_width);
 
         auto el_it = mesh.elements_begin();
         for (const libMeshWrappers::BoundingBox& bbox : global_bboxes)
@@ -3197,13 +3465,7 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
                 const int elem_ln = getPatchLevel(*el_it);
                 if (coarsest_elem_ln <= elem_ln && elem_ln <= finest_elem_ln)
                 {
-#if LIBMESH_VERSION_LESS_THAN(1, 6, 0)
-                    if (bbox_intersects(bbox, patch_bbox)) elems.insert(*el_it);
-#else
-                    // New versions of libMesh have this function's performance
-                    // problems fixed
-                    if (bbox.intersects(patch_bbox)) elems.insert(*el_it);
-#endif
+                    if (elem_bbox_intersects_patch_bbox(bbox, patch_bbox)) elems.insert(*el_it);
                 }
             }
             ++el_it;
@@ -3249,6 +3511,125 @@ FEDataManager::collectActivePatchNodes(std::vector<std::vector<Node*> >& active_
     return;
 }
 
+void
+FEDataManager::checkActivePatchNodes()
+{
+    // If we are not regridding in the usual way (i.e., if
+    // IBHierarchyIntegrator::d_regrid_cfl_interval > 1) then it is possible
+    // that an element has traveled outside of it's assigned patch level. If
+    // this happens then IBFE won't work - we cannot correctly interpolate
+    // velocity at that point. Hence try to detect it by checking that all nodes
+    // are on the interior of some patch (or outside the domain) at the moment.
+    const Pointer<CartesianGridGeometry<NDIM> > hier_geom = d_hierarchy->getGridGeometry();
+    // TODO - we only support single box geometries right now
+    TBOX_ASSERT(hier_geom);
+    const double* const hier_x_lower = hier_geom->getXLower();
+    const double* const hier_x_upper = hier_geom->getXUpper();
+    const int rank = IBTK_MPI::getRank();
+    const int n_procs = IBTK_MPI::getNodes();
+    const MeshBase& mesh = getEquationSystems()->get_mesh();
+    std::unique_ptr<PetscVector<double> > X_petsc_vec = buildIBGhostedVector(getCurrentCoordinatesSystemName());
+    *X_petsc_vec = *getCoordsVector();
+    X_petsc_vec->close();
+    const double* const X_local_soln = X_petsc_vec->get_array_read();
+    const DofMap& X_dof_map = d_fe_data->d_es->get_system(getCurrentCoordinatesSystemName()).get_dof_map();
+
+    std::vector<int> node_ranks(mesh.parallel_n_nodes());
+    std::vector<dof_id_type> X_idxs;
+    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        int local_patch_num = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+        {
+            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+            const double* const patch_x_lower = patch_geom->getXLower();
+            const double* const patch_x_upper = patch_geom->getXUpper();
+
+            for (const Node* n : d_active_patch_node_map[ln][local_patch_num])
+            {
+                IBTK::Point X;
+                bool inside_patch = true;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    IBTK::get_nodal_dof_indices(X_dof_map, n, d, X_idxs);
+                    X[d] = X_local_soln[X_petsc_vec->map_global_to_local_index(X_idxs[0])];
+                    // Due to how SAMRAI computes patch boundaries, even if the
+                    // patch's domain is [0, 1]^2 the patches on the boundary
+                    // may not actually end at 1.0. Hence allow a small
+                    // tolerance here to account for the case where two patches
+                    // are adjacent to each-other but their patch boundaries
+                    // don't quite line up:
+                    const double x_lower = patch_x_lower[d] - std::max(1.0, std::abs(patch_x_lower[d])) * 1e-14;
+                    const double x_upper = patch_x_upper[d] + std::max(1.0, std::abs(patch_x_upper[d])) * 1e-14;
+                    inside_patch = inside_patch && (x_lower <= X[d] && X[d] <= x_upper);
+                }
+                if (inside_patch)
+                {
+                    node_ranks[n->id()] = rank + 1;
+                }
+                else
+                {
+                    // Points are allowed to be outside the domain - they simply
+                    // are no longer used for IB calculations.
+                    bool inside_hier = true;
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        // Like above - permit points very close to the boundary
+                        // to pass the check and treat them as being outside
+                        const double x_lower = hier_x_lower[d] + std::max(1.0, std::abs(hier_x_lower[d])) * 1e-14;
+                        const double x_upper = hier_x_upper[d] - std::max(1.0, std::abs(hier_x_upper[d])) * 1e-14;
+                        inside_hier = inside_hier && (x_lower <= X[d] && X[d] <= x_upper);
+                    }
+                    if (!inside_hier)
+                    {
+                        node_ranks[n->id()] = n_procs + 1;
+                    }
+                }
+            }
+        }
+    }
+    X_petsc_vec->restore_array();
+
+    // send everything to rank 0 instead of doing an all-to-all:
+    IBTK_MPI::allToOneSumReduction(node_ranks.data(), node_ranks.size());
+    if (rank == 0)
+    {
+        const std::string message =
+            "At least one node in the current mesh is inside the fluid domain and not associated with any "
+            "patch. This class currently assumes that all elements are on the finest level and will not "
+            "work correctly if this assumption does not hold. This usually happens when you use multiple "
+            "patch levels and set the regrid CFL interval to a value larger than one. To change this check "
+            "set node_outside_patch_check to a different value in the input database: see the documentation "
+            "of FEDataManager for more information.";
+        for (const int node_rank : node_ranks)
+        {
+            if (node_rank == 0)
+            {
+                switch (d_node_patch_check)
+                {
+                case NODE_OUTSIDE_PERMIT:
+                    break;
+                case NODE_OUTSIDE_WARN:
+                    TBOX_WARNING(message);
+                    break;
+                case NODE_OUTSIDE_ERROR:
+                    TBOX_ERROR(message);
+                    break;
+                default:
+                    // we shouldn't get here
+                    TBOX_ERROR("unrecognized value for d_node_patch_check");
+                    break;
+                }
+                // no need to check more nodes if we already found one outside
+                break;
+            }
+        }
+    }
+    return;
+} // checkActivePatchNodes
+
 int
 FEDataManager::getPatchLevel(const Elem* elem) const
 {
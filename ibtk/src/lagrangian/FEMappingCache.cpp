@@ -0,0 +1,225 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/FEMappingCache.h>
+
+#include <tbox/Utilities.h>
+
+#include <libmesh/elem.h>
+#include <libmesh/enum_elem_type.h>
+#include <libmesh/mesh_base.h>
+#include <libmesh/point.h>
+
+#include <Eigen/Dense>
+
+#include <cmath>
+#include <vector>
+
+#include <ibtk/namespaces.h> // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+namespace
+{
+template <int dim, int spacedim>
+inline Eigen::Matrix<double, spacedim, dim>
+getCovariant(const Eigen::Matrix<double, spacedim, dim>& contravariant)
+{
+    return contravariant * (contravariant.transpose() * contravariant).inverse();
+}
+
+template <int dim>
+inline Eigen::Matrix<double, dim, dim>
+getCovariant(const Eigen::Matrix<double, dim, dim>& contravariant)
+{
+    return contravariant.inverse().transpose();
+}
+
+// Compute the affine map of an element and store it in entry (see the
+// documentation of FEGeometryCache for the layout). Returns false if the
+// element is not of a supported type or is not affine.
+template <int dim, int spacedim>
+bool
+compute_affine_map(const libMesh::Elem* const elem, double* const entry)
+{
+    // Reference coordinates of the nodes of the supported element types and
+    // the nodes adjacent to node 0 along each reference coordinate axis.
+    static const double tri3_nodes[3][3] = { { 0, 0, 0 }, { 1, 0, 0 }, { 0, 1, 0 } };
+    static const double tet4_nodes[4][3] = { { 0, 0, 0 }, { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+    static const double quad4_nodes[4][3] = { { -1, -1, 0 }, { 1, -1, 0 }, { 1, 1, 0 }, { -1, 1, 0 } };
+    static const double hex8_nodes[8][3] = { { -1, -1, -1 }, { 1, -1, -1 }, { 1, 1, -1 }, { -1, 1, -1 },
+                                             { -1, -1, 1 },  { 1, -1, 1 },  { 1, 1, 1 },  { -1, 1, 1 } };
+    static const unsigned int simplex_axis_nodes[3] = { 1, 2, 3 };
+    static const unsigned int tensor_axis_nodes[3] = { 1, 3, 4 };
+    const double(*ref_nodes)[3] = nullptr;
+    const unsigned int* axis_nodes = nullptr;
+    switch (elem->type())
+    {
+    case libMesh::TRI3:
+        ref_nodes = tri3_nodes;
+        axis_nodes = simplex_axis_nodes;
+        break;
+    case libMesh::TET4:
+        ref_nodes = tet4_nodes;
+        axis_nodes = simplex_axis_nodes;
+        break;
+    case libMesh::QUAD4:
+        ref_nodes = quad4_nodes;
+        axis_nodes = tensor_axis_nodes;
+        break;
+    case libMesh::HEX8:
+        ref_nodes = hex8_nodes;
+        axis_nodes = tensor_axis_nodes;
+        break;
+    default:
+        return false;
+    }
+
+    // Determine the affine map from node 0 and its neighbors:
+    const libMesh::Point& node_0 = elem->point(0);
+    Eigen::Matrix<double, spacedim, dim> contravariant;
+    for (int d = 0; d < dim; ++d)
+    {
+        const libMesh::Point& node = elem->point(axis_nodes[d]);
+        const double ref_length = ref_nodes[axis_nodes[d]][d] - ref_nodes[0][d];
+        for (int i = 0; i < spacedim; ++i) contravariant(i, d) = (node(i) - node_0(i)) / ref_length;
+    }
+    Eigen::Matrix<double, spacedim, 1> x_0;
+    for (int i = 0; i < spacedim; ++i)
+    {
+        x_0(i) = node_0(i);
+        for (int d = 0; d < dim; ++d) x_0(i) -= contravariant(i, d) * ref_nodes[0][d];
+    }
+
+    // The element is affine if the map reproduces all of its nodes.
+    const double tol = 1e-12 * elem->hmax();
+    for (unsigned int n = 0; n < elem->n_nodes(); ++n)
+    {
+        const libMesh::Point& node = elem->point(n);
+        for (int i = 0; i < spacedim; ++i)
+        {
+            double x = x_0(i);
+            for (int d = 0; d < dim; ++d) x += contravariant(i, d) * ref_nodes[n][d];
+            if (std::abs(x - node(i)) > tol) return false;
+        }
+    }
+
+    double jacobian = 0.0;
+    if (dim == spacedim)
+    {
+        jacobian = contravariant.determinant();
+    }
+    else
+    {
+        const Eigen::Matrix<double, dim, dim> Jac = contravariant.transpose() * contravariant;
+        jacobian = std::sqrt(Jac.determinant());
+    }
+    // Let the mapping classes report inverted elements.
+    if (!(jacobian > 0.0)) return false;
+
+    const Eigen::Matrix<double, spacedim, dim> covariant = getCovariant(contravariant);
+    double* ptr = entry;
+    for (int i = 0; i < spacedim; ++i) *ptr++ = x_0(i);
+    for (int d = 0; d < dim; ++d)
+    {
+        for (int i = 0; i < spacedim; ++i) *ptr++ = contravariant(i, d);
+    }
+    for (int d = 0; d < dim; ++d)
+    {
+        for (int i = 0; i < spacedim; ++i) *ptr++ = covariant(i, d);
+    }
+    *ptr = jacobian;
+    return true;
+} // compute_affine_map
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+FEGeometryCache::FEGeometryCache(const int dim, const int spacedim)
+    : d_dim(dim), d_spacedim(spacedim), d_entry_size(spacedim + 2 * spacedim * dim + 1)
+{
+    TBOX_ASSERT(1 <= d_dim && d_dim <= d_spacedim && d_spacedim <= 3);
+} // FEGeometryCache
+
+void
+FEGeometryCache::reinit(const libMesh::MeshBase& mesh)
+{
+    clear();
+    const std::size_t n_elems = mesh.n_active_local_elem();
+    d_offsets.reserve(n_elems);
+    d_data.reserve(n_elems * d_entry_size);
+    const auto el_begin = mesh.active_local_elements_begin();
+    const auto el_end = mesh.active_local_elements_end();
+    for (auto el_it = el_begin; el_it != el_end; ++el_it)
+    {
+        addElement(*el_it);
+    }
+    return;
+} // reinit
+
+bool
+FEGeometryCache::addElement(const libMesh::Elem* const elem)
+{
+    if (static_cast<int>(elem->dim()) != d_dim || elem->p_level() != 0) return false;
+    if (d_offsets.count(elem->id())) return true;
+
+    const std::size_t offset = d_data.size();
+    d_data.resize(offset + d_entry_size);
+    bool is_affine = false;
+    if (d_dim == 2 && d_spacedim == 2)
+        is_affine = compute_affine_map<2, 2>(elem, &d_data[offset]);
+    else if (d_dim == 2 && d_spacedim == 3)
+        is_affine = compute_affine_map<2, 3>(elem, &d_data[offset]);
+    else if (d_dim == 3 && d_spacedim == 3)
+        is_affine = compute_affine_map<3, 3>(elem, &d_data[offset]);
+
+    if (is_affine)
+    {
+        d_offsets[elem->id()] = offset;
+    }
+    else
+    {
+        d_data.resize(offset);
+    }
+    return is_affine;
+} // addElement
+
+const double*
+FEGeometryCache::getAffineMapData(const libMesh::Elem* const elem) const
+{
+    const auto it = d_offsets.find(elem->id());
+    return it == d_offsets.end() ? nullptr : &d_data[it->second];
+} // getAffineMapData
+
+void
+FEGeometryCache::clear()
+{
+    d_offsets.clear();
+    d_data.clear();
+    return;
+} // clear
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -16,6 +16,7 @@
 #include "ibtk/IBTK_MPI.h"
 #include <ibtk/FECache.h>
 #include <ibtk/FEMapping.h>
+#include <ibtk/FEMappingCache.h>
 #include <ibtk/FEValues.h>
 
 #include <tbox/PIO.h>
@@ -163,26 +164,71 @@ FEValues<dim, spacedim>::reinit(const libMesh::Elem* elem)
     //
     // update mapping quantities:
     //
-    auto map_iter = d_mappings.find(elem_type);
-    if (map_iter == d_mappings.end())
+    // Affine elements stored in the geometry cache do not need their
+    // mappings to be recomputed. Since their covariants are constant we only
+    // store one.
+    const double* const affine_map_data = d_geometry_cache ? d_geometry_cache->getAffineMapData(elem) : nullptr;
+    Eigen::Matrix<double, spacedim, dim> affine_covariant;
+    const Eigen::Matrix<double, spacedim, dim>* covariants = nullptr;
+    unsigned int covariant_stride = 1;
+    if (affine_map_data)
     {
-        typename decltype(d_mappings)::value_type new_entry{ elem_type, nullptr };
-        map_iter = d_mappings.insert(map_iter, std::move(new_entry));
-        const quadrature_key_type key{
-            elem_type, d_qrule->type(), d_qrule->get_order(), d_qrule->allow_rules_with_negative_weights
-        };
-        map_iter->second = FEMapping<dim, spacedim>::build(key, d_update_flags);
-    }
-    FEMapping<dim, spacedim>& mapping = *map_iter->second;
-    mapping.reinit(elem);
-
-    if (d_update_flags & update_JxW)
-    {
-        d_JxW = mapping.getJxW();
+        TBOX_ASSERT(d_geometry_cache->getDimension() == dim && d_geometry_cache->getSpatialDimension() == spacedim);
+        const Eigen::Map<const Eigen::Matrix<double, spacedim, 1> > x_0(affine_map_data);
+        const Eigen::Map<const Eigen::Matrix<double, spacedim, dim> > contravariant(affine_map_data + spacedim);
+        affine_covariant =
+            Eigen::Map<const Eigen::Matrix<double, spacedim, dim> >(affine_map_data + spacedim + spacedim * dim);
+        const double jacobian = affine_map_data[spacedim + 2 * spacedim * dim];
+        covariants = &affine_covariant;
+        covariant_stride = 0;
+
+        if (d_update_flags & update_JxW)
+        {
+            const std::vector<libMesh::Real>& weights = d_qrule->get_weights();
+            d_JxW.resize(weights.size());
+            for (unsigned int q = 0; q < weights.size(); ++q) d_JxW[q] = weights[q] * jacobian;
+        }
+        if (d_update_flags & update_quadrature_points)
+        {
+            const std::vector<libMesh::Point>& ref_points = d_qrule->get_points();
+            d_quadrature_points.resize(ref_points.size());
+            for (unsigned int q = 0; q < ref_points.size(); ++q)
+            {
+                Eigen::Matrix<double, dim, 1> ref_point;
+                for (unsigned int d = 0; d < dim; ++d) ref_point(d) = ref_points[q](d);
+                const Eigen::Matrix<double, spacedim, 1> x = x_0 + contravariant * ref_point;
+                d_quadrature_points[q] = libMesh::Point();
+                for (unsigned int d = 0; d < spacedim; ++d) d_quadrature_points[q](d) = x(d);
+            }
+        }
     }
-    if (d_update_flags & update_quadrature_points)
+    else
     {
-        d_quadrature_points = mapping.getQuadraturePoints();
+        auto map_iter = d_mappings.find(elem_type);
+        if (map_iter == d_mappings.end())
+        {
+            typename decltype(d_mappings)::value_type new_entry{ elem_type, nullptr };
+            map_iter = d_mappings.insert(map_iter, std::move(new_entry));
+            const quadrature_key_type key{
+                elem_type, d_qrule->type(), d_qrule->get_order(), d_qrule->allow_rules_with_negative_weights
+            };
+            map_iter->second = FEMapping<dim, spacedim>::build(key, d_update_flags);
+        }
+        FEMapping<dim, spacedim>& mapping = *map_iter->second;
+        mapping.reinit(elem);
+
+        if (d_update_flags & update_JxW)
+        {
+            d_JxW = mapping.getJxW();
+        }
+        if (d_update_flags & update_quadrature_points)
+        {
+            d_quadrature_points = mapping.getQuadraturePoints();
+        }
+        if (d_update_flags & update_dphi)
+        {
+            covariants = mapping.getCovariants().data();
+        }
     }
 
     //
@@ -215,7 +261,6 @@ FEValues<dim, spacedim>::reinit(const libMesh::Elem* elem)
             ref_values.d_reference_shape_gradients;
         d_shape_gradients.resize(ref_shape_gradients.shape()[0]);
 
-        const std::vector<Eigen::Matrix<double, spacedim, dim> >& covariants = mapping.getCovariants();
         for (unsigned int i = 0; i < d_shape_gradients.size(); ++i)
         {
             d_shape_gradients[i].resize(ref_shape_gradients.shape()[1]);
@@ -228,7 +273,7 @@ FEValues<dim, spacedim>::reinit(const libMesh::Elem* elem)
                     ref_shape_grad_(d, 0) = ref_shape_grad(d);
                 }
 
-                Eigen::Matrix<double, spacedim, 1> shape_grad_ = covariants[q] * ref_shape_grad_;
+                Eigen::Matrix<double, spacedim, 1> shape_grad_ = covariants[q * covariant_stride] * ref_shape_grad_;
                 for (unsigned int d = 0; d < spacedim; ++d)
                 {
                     d_shape_gradients[i][q](d) = shape_grad_(d, 0);
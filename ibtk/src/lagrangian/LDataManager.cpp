@@ -106,6 +106,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <map>
 #include <memory>
@@ -811,6 +812,197 @@ LDataManager::interp(const int f_data_idx,
     return;
 } // interp
 
+void
+LDataManager::spread(const std::vector<std::pair<int, std::vector<Pointer<LData> > > >& f_F_data,
+                     std::vector<Pointer<LData> >& X_data,
+                     const std::vector<RobinPhysBdryPatchStrategy*>& f_phys_bdry_ops,
+                     const std::vector<std::vector<Pointer<RefineSchedule<NDIM> > > >& f_prolongation_scheds,
+                     const double fill_data_time,
+                     const bool F_data_ghost_node_update,
+                     const bool X_data_ghost_node_update,
+                     const int coarsest_ln_in,
+                     const int finest_ln_in)
+{
+    const int num_fields = static_cast<int>(f_F_data.size());
+#if !defined(NDEBUG)
+    TBOX_ASSERT(f_phys_bdry_ops.empty() || static_cast<int>(f_phys_bdry_ops.size()) == num_fields);
+    TBOX_ASSERT(f_prolongation_scheds.empty() || static_cast<int>(f_prolongation_scheds.size()) == num_fields);
+#endif
+    if (num_fields == 0) return;
+
+    IBTK_TIMER_START(t_spread);
+
+    const int coarsest_ln = (coarsest_ln_in == invalid_level_number ? 0 : coarsest_ln_in);
+    const int finest_ln = (finest_ln_in == invalid_level_number ? d_hierarchy->getFinestLevelNumber() : finest_ln_in);
+
+    // Zero inactivated components.
+    for (const auto& f_F : f_F_data)
+    {
+        for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+        {
+            zeroInactivatedComponents(f_F.second[ln], ln);
+        }
+    }
+
+    // Make copies of the Eulerian data.
+    auto var_db = VariableDatabase<NDIM>::getDatabase();
+    // The cached indices are returned to the cache when they go out of scope,
+    // so they must be kept until the data has been accumulated: otherwise
+    // fields with the same kind of data would share a copy.
+    std::vector<SAMRAIDataCache::CachedPatchDataIndex> f_copy_data_idxs;
+    f_copy_data_idxs.reserve(num_fields);
+    std::vector<Pointer<HierarchyDataOpsReal<NDIM, double> > > f_data_ops(num_fields);
+    for (int k = 0; k < num_fields; ++k)
+    {
+        const int f_data_idx = f_F_data[k].first;
+        Pointer<Variable<NDIM> > f_var;
+        var_db->mapIndexToVariable(f_data_idx, f_var);
+        f_copy_data_idxs.push_back(d_cached_eulerian_data.getCachedPatchDataIndex(f_data_idx));
+        f_data_ops[k] = HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
+        f_data_ops[k]->swapData(f_copy_data_idxs[k], f_data_idx);
+        f_data_ops[k]->setToScalar(f_data_idx, 0.0, /*interior_only*/ false);
+    }
+
+    // Start filling Lagrangian ghost node values.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!levelContainsLagrangianData(ln)) continue;
+
+        if (F_data_ghost_node_update)
+        {
+            for (const auto& f_F : f_F_data) f_F.second[ln]->beginGhostUpdate();
+        }
+        if (X_data_ghost_node_update) X_data[ln]->beginGhostUpdate();
+    }
+
+    // Spread data from the Lagrangian mesh to the Eulerian grid.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        // If there are coarser levels in the patch hierarchy, prolong data from
+        // the coarser levels before spreading data on this level.
+        if (ln > coarsest_ln)
+        {
+            for (const auto& scheds : f_prolongation_scheds)
+            {
+                if (ln < static_cast<int>(scheds.size()) && scheds[ln]) scheds[ln]->fillData(fill_data_time);
+            }
+        }
+
+        if (!levelContainsLagrangianData(ln)) continue;
+
+        // Spread data onto the grid.
+        if (F_data_ghost_node_update)
+        {
+            for (const auto& f_F : f_F_data) f_F.second[ln]->endGhostUpdate();
+        }
+        if (X_data_ghost_node_update) X_data[ln]->endGhostUpdate();
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+        std::vector<std::pair<Pointer<PatchData<NDIM> >, Pointer<LData> > > f_F_patch_data(num_fields);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            for (int k = 0; k < num_fields; ++k)
+            {
+                f_F_patch_data[k] = std::make_pair(patch->getPatchData(f_F_data[k].first), f_F_data[k].second[ln]);
+            }
+            Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+            const Box<NDIM>& box = idx_data->getGhostBox();
+            LEInteractor::spread(
+                f_F_patch_data, X_data[ln], idx_data, patch, box, periodic_shift, d_default_spread_kernel_fcn);
+            for (int k = 0; k < static_cast<int>(f_phys_bdry_ops.size()); ++k)
+            {
+                if (!f_phys_bdry_ops[k]) continue;
+                f_phys_bdry_ops[k]->setPatchDataIndex(f_F_data[k].first);
+                f_phys_bdry_ops[k]->accumulateFromPhysicalBoundaryData(
+                    *patch, fill_data_time, f_F_patch_data[k].first->getGhostCellWidth());
+            }
+        }
+    }
+
+    // Accumulate data.
+    for (int k = 0; k < num_fields; ++k)
+    {
+        const int f_data_idx = f_F_data[k].first;
+        f_data_ops[k]->swapData(f_copy_data_idxs[k], f_data_idx);
+        f_data_ops[k]->add(f_data_idx, f_data_idx, f_copy_data_idxs[k]);
+    }
+
+    IBTK_TIMER_STOP(t_spread);
+    return;
+} // spread
+
+void
+LDataManager::interp(const std::vector<std::pair<int, std::vector<Pointer<LData> > > >& f_F_data,
+                     std::vector<Pointer<LData> >& X_data,
+                     const std::vector<std::vector<Pointer<CoarsenSchedule<NDIM> > > >& f_synch_scheds,
+                     const std::vector<std::vector<Pointer<RefineSchedule<NDIM> > > >& f_ghost_fill_scheds,
+                     const double fill_data_time,
+                     const int coarsest_ln_in,
+                     const int finest_ln_in)
+{
+    const int num_fields = static_cast<int>(f_F_data.size());
+#if !defined(NDEBUG)
+    TBOX_ASSERT(f_synch_scheds.empty() || static_cast<int>(f_synch_scheds.size()) == num_fields);
+    TBOX_ASSERT(f_ghost_fill_scheds.empty() || static_cast<int>(f_ghost_fill_scheds.size()) == num_fields);
+#endif
+    if (num_fields == 0) return;
+
+    IBTK_TIMER_START(t_interp);
+
+    const int coarsest_ln = (coarsest_ln_in == invalid_level_number ? 0 : coarsest_ln_in);
+    const int finest_ln = (finest_ln_in == invalid_level_number ? d_hierarchy->getFinestLevelNumber() : finest_ln_in);
+
+    // Synchronize Eulerian values.
+    for (const auto& scheds : f_synch_scheds)
+    {
+        for (int ln = finest_ln; ln > coarsest_ln; --ln)
+        {
+            if (ln < static_cast<int>(scheds.size()) && scheds[ln]) scheds[ln]->coarsenData();
+        }
+    }
+
+    // Interpolate data from the Eulerian grid to the Lagrangian mesh.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!levelContainsLagrangianData(ln)) continue;
+
+        for (const auto& scheds : f_ghost_fill_scheds)
+        {
+            if (ln < static_cast<int>(scheds.size()) && scheds[ln]) scheds[ln]->fillData(fill_data_time);
+        }
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+        std::vector<std::pair<Pointer<PatchData<NDIM> >, Pointer<LData> > > f_F_patch_data(num_fields);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            for (int k = 0; k < num_fields; ++k)
+            {
+                f_F_patch_data[k] = std::make_pair(patch->getPatchData(f_F_data[k].first), f_F_data[k].second[ln]);
+            }
+            Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+            const Box<NDIM>& box = idx_data->getBox();
+            LEInteractor::interpolate(
+                f_F_patch_data, X_data[ln], idx_data, patch, box, periodic_shift, d_default_interp_kernel_fcn);
+        }
+    }
+
+    // Zero inactivated components.
+    for (const auto& f_F : f_F_data)
+    {
+        for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+        {
+            zeroInactivatedComponents(f_F.second[ln], ln);
+        }
+    }
+
+    IBTK_TIMER_STOP(t_interp);
+    return;
+} // interp
+
 void
 LDataManager::registerLInitStrategy(Pointer<LInitStrategy> lag_init)
 {
@@ -1539,6 +1731,20 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         }
     }
 
+    // The local indices of the Lagrangian nodes are about to change, so
+    // release the delta function weights cached for the old distribution.
+    LEInteractor::clearWeightCache();
+
+    // Determine which levels may be redistributed incrementally.  Levels with
+    // displaced structures always use a full redistribution.
+    std::vector<bool> preserve_ordering(finest_ln + 1, false);
+    for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
+    {
+        preserve_ordering[level_number] = d_use_incremental_redistribution &&
+                                          d_level_contains_lag_data[level_number] && d_ao[level_number] &&
+                                          d_displaced_strct_ids[level_number].empty();
+    }
+
     // Update parallel data structures to account for any displaced nodes.
     for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
     {
@@ -1677,6 +1883,14 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         level->deallocatePatchData(d_scratch_data);
     }
 
+    // Fall back to a full redistribution on levels where any node has changed
+    // processors.
+    for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
+    {
+        if (!preserve_ordering[level_number]) continue;
+        preserve_ordering[level_number] = computeNumberOfMigratedNodes(level_number) == 0;
+    }
+
     // Define the PETSc data needed to communicate the LData from its
     // old configuration to its new configuration.
     int ierr;
@@ -1735,6 +1949,8 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         //
         // NOTE: This process updates the local PETSc indices of the LNodeSet
         // objects contained in the current patch.
+        const std::vector<int> old_nonlocal_petsc_indices =
+            preserve_ordering[level_number] ? d_nonlocal_petsc_indices[level_number] : std::vector<int>();
         computeNodeDistribution(new_ao[level_number],
                                 d_local_lag_indices[level_number],
                                 d_nonlocal_lag_indices[level_number],
@@ -1742,10 +1958,43 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
                                 d_nonlocal_petsc_indices[level_number],
                                 d_num_nodes[level_number],
                                 d_node_offset[level_number],
-                                level_number);
+                                level_number,
+                                preserve_ordering[level_number]);
         num_local_nodes[level_number] = static_cast<int>(d_local_lag_indices[level_number].size());
         num_nonlocal_nodes[level_number] = static_cast<int>(d_nonlocal_lag_indices[level_number].size());
 
+        // If the AO has been reused, no node has changed processors and the
+        // local values are already in place.  New Vec objects are needed only
+        // if the ghost nodes have changed, in which case the local values are
+        // copied directly rather than scattered.
+        if (new_ao[level_number] == d_ao[level_number])
+        {
+            const bool ghost_nodes_changed =
+                IBTK_MPI::maxReduction(static_cast<int>(d_nonlocal_petsc_indices[level_number] !=
+                                                        old_nonlocal_petsc_indices)) == 1;
+            if (!ghost_nodes_changed) continue;
+            std::map<std::string, Pointer<LData> >::iterator it;
+            int i;
+            for (it = level_data.begin(), i = 0; it != level_data.end(); ++it, ++i)
+            {
+                Pointer<LData> data = it->second;
+                const int depth = data->getDepth();
+                src_vec[level_number][i] = data->getVec();
+                ierr = VecCreateGhostBlock(
+                    PETSC_COMM_WORLD,
+                    depth,
+                    depth * num_local_nodes[level_number],
+                    PETSC_DECIDE,
+                    num_nonlocal_nodes[level_number],
+                    num_nonlocal_nodes[level_number] > 0 ? &d_nonlocal_petsc_indices[level_number][0] : nullptr,
+                    &dst_vec[level_number][i]);
+                IBTK_CHKERRQ(ierr);
+                ierr = VecCopy(src_vec[level_number][i], dst_vec[level_number][i]);
+                IBTK_CHKERRQ(ierr);
+            }
+            continue;
+        }
+
         // Setup src indices.
         std::vector<int> src_inds(num_local_nodes[level_number]);
         for (int k = 0; k < num_local_nodes[level_number]; ++k)
@@ -1862,7 +2111,7 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-            idx_data->cacheLocalIndices(patch, periodic_shift);
+            idx_data->cacheLocalIndices(patch, periodic_shift, d_use_morton_ordering);
             const Box<NDIM>& ghost_box = idx_data->getGhostBox();
             for (LNodeSetData::DataIterator it = idx_data->data_begin(ghost_box); it != idx_data->data_end(); ++it)
             {
@@ -1904,14 +2153,18 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         int i;
         for (it = level_data.begin(), i = 0; it != level_data.end(); ++it, ++i)
         {
-            ierr = VecScatterEnd(scatter[level_number][i],
-                                 src_vec[level_number][i],
-                                 dst_vec[level_number][i],
-                                 INSERT_VALUES,
-                                 SCATTER_FORWARD);
-            IBTK_CHKERRQ(ierr);
-            ierr = VecScatterDestroy(&scatter[level_number][i]);
-            IBTK_CHKERRQ(ierr);
+            if (scatter[level_number][i])
+            {
+                ierr = VecScatterEnd(scatter[level_number][i],
+                                     src_vec[level_number][i],
+                                     dst_vec[level_number][i],
+                                     INSERT_VALUES,
+                                     SCATTER_FORWARD);
+                IBTK_CHKERRQ(ierr);
+                ierr = VecScatterDestroy(&scatter[level_number][i]);
+                IBTK_CHKERRQ(ierr);
+            }
+            if (!dst_vec[level_number][i]) continue;
             Pointer<LData> data = it->second;
             data->resetData(dst_vec[level_number][i], d_nonlocal_petsc_indices[level_number]);
         }
@@ -1927,7 +2180,7 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
     {
         d_needs_synch[level_number] = false;
 
-        if (d_ao[level_number])
+        if (d_ao[level_number] && d_ao[level_number] != new_ao[level_number])
         {
             ierr = AODestroy(&d_ao[level_number]);
             IBTK_CHKERRQ(ierr);
@@ -2265,7 +2518,7 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
 
             node_count_data->fillAll(0.0);
 
-            idx_data->cacheLocalIndices(patch, periodic_shift);
+            idx_data->cacheLocalIndices(patch, periodic_shift, d_use_morton_ordering);
             for (LNodeSetData::SetIterator it(*idx_data); it; it++)
             {
                 const CellIndex<NDIM>& i = it.getIndex();
@@ -2862,7 +3115,8 @@ LDataManager::computeNodeDistribution(AO& ao,
                                       std::vector<int>& nonlocal_petsc_indices,
                                       unsigned int& num_nodes,
                                       unsigned int& node_offset,
-                                      const int level_number)
+                                      const int level_number,
+                                      const bool preserve_ordering)
 {
     IBTK_TIMER_START(t_compute_node_distribution);
 
@@ -2870,6 +3124,23 @@ LDataManager::computeNodeDistribution(AO& ao,
     TBOX_ASSERT(level_number >= d_coarsest_ln && level_number <= d_finest_ln);
 #endif
 
+    // When preserving the ordering, record the positions of the nodes in the
+    // previous distribution before the index vectors are reset.
+    std::vector<int> old_local_lag_indices;
+    std::map<int, int> old_local_positions, old_nonlocal_positions;
+    if (preserve_ordering)
+    {
+        old_local_lag_indices = local_lag_indices;
+        for (unsigned int k = 0; k < local_lag_indices.size(); ++k)
+        {
+            old_local_positions[local_lag_indices[k]] = k;
+        }
+        for (unsigned int k = 0; k < nonlocal_lag_indices.size(); ++k)
+        {
+            old_nonlocal_positions[nonlocal_lag_indices[k]] = k;
+        }
+    }
+
     local_lag_indices.clear();
     nonlocal_lag_indices.clear();
     local_petsc_indices.clear();
@@ -2894,20 +3165,60 @@ LDataManager::computeNodeDistribution(AO& ao,
     unsigned int local_offset = 0;
     std::map<int, int> lag_idx_to_petsc_idx;
 #if 1
+    std::vector<std::pair<std::uint64_t, LNode*> > patch_nodes, level_nodes;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         const Pointer<Patch<NDIM> > patch = level->getPatch(p());
         const Box<NDIM>& patch_box = patch->getBox();
         const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+
+        // Optionally number the nodes along a Morton curve through the cells
+        // of the patch so that nodes which are close in space are also close
+        // in memory. The curve starts at the lower corner of the ghost box so
+        // that the ordering matches the one used by cacheLocalIndices().
+        patch_nodes.clear();
+        const hier::Index<NDIM>& ghost_lower = idx_data->getGhostBox().lower();
         for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box); it != idx_data->data_end(); ++it)
         {
-            LNode* const node_idx = *it;
-            const int lag_idx = node_idx->getLagrangianIndex();
-            local_lag_indices.push_back(lag_idx);
-            const int petsc_idx = local_offset++;
-            node_idx->setLocalPETScIndex(petsc_idx);
-            lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
+            const std::uint64_t key =
+                d_use_morton_ordering ? IndexUtilities::getMortonIndex(it.getCellIndex(), ghost_lower) : 0;
+            patch_nodes.emplace_back(key, *it);
         }
+        if (d_use_morton_ordering)
+        {
+            std::stable_sort(patch_nodes.begin(),
+                             patch_nodes.end(),
+                             [](const std::pair<std::uint64_t, LNode*>& a, const std::pair<std::uint64_t, LNode*>& b) {
+                                 return a.first < b.first;
+                             });
+        }
+        level_nodes.insert(level_nodes.end(), patch_nodes.begin(), patch_nodes.end());
+    }
+
+    // The ordering is only preserved when no node has changed processors, in
+    // which case the local nodes keep their previous order.
+    if (preserve_ordering)
+    {
+        const auto num_old_local_nodes = static_cast<std::uint64_t>(old_local_positions.size());
+        for (auto& key_node : level_nodes)
+        {
+            const auto pos_it = old_local_positions.find(key_node.second->getLagrangianIndex());
+            key_node.first = pos_it != old_local_positions.end() ? pos_it->second : num_old_local_nodes;
+        }
+        std::stable_sort(level_nodes.begin(),
+                         level_nodes.end(),
+                         [](const std::pair<std::uint64_t, LNode*>& a, const std::pair<std::uint64_t, LNode*>& b) {
+                             return a.first < b.first;
+                         });
+    }
+    for (const auto& key_node : level_nodes)
+    {
+        LNode* const node_idx = key_node.second;
+        const int lag_idx = node_idx->getLagrangianIndex();
+        local_lag_indices.push_back(lag_idx);
+        const int petsc_idx = local_offset++;
+        node_idx->setLocalPETScIndex(petsc_idx);
+        lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
     }
 #else
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
@@ -2965,6 +3276,43 @@ LDataManager::computeNodeDistribution(AO& ao,
         }
     }
 
+    // When preserving the ordering, nonlocal nodes that were already ghosted
+    // on this processor also keep their previous relative order, so that the
+    // ghost index set changes only where nodes have entered or left the ghost
+    // cell regions.
+    if (preserve_ordering && !nonlocal_lag_indices.empty())
+    {
+        const auto num_old_nonlocal_nodes = static_cast<int>(old_nonlocal_positions.size());
+        std::vector<std::pair<int, int> > keyed_lag_indices;
+        keyed_lag_indices.reserve(nonlocal_lag_indices.size());
+        for (const int lag_idx : nonlocal_lag_indices)
+        {
+            const auto pos_it = old_nonlocal_positions.find(lag_idx);
+            keyed_lag_indices.emplace_back(
+                pos_it != old_nonlocal_positions.end() ? pos_it->second : num_old_nonlocal_nodes, lag_idx);
+        }
+        std::stable_sort(keyed_lag_indices.begin(),
+                         keyed_lag_indices.end(),
+                         [](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; });
+        const auto num_local_nodes = static_cast<int>(local_lag_indices.size());
+        for (unsigned int k = 0; k < keyed_lag_indices.size(); ++k)
+        {
+            nonlocal_lag_indices[k] = keyed_lag_indices[k].second;
+            lag_idx_to_petsc_idx[nonlocal_lag_indices[k]] = num_local_nodes + static_cast<int>(k);
+        }
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+            const Box<NDIM>& ghost_box = idx_data->getGhostBox();
+            for (LNodeSetData::DataIterator it = idx_data->data_begin(ghost_box); it != idx_data->data_end(); ++it)
+            {
+                LNode* const node_idx = *it;
+                node_idx->setLocalPETScIndex(lag_idx_to_petsc_idx[node_idx->getLagrangianIndex()]);
+            }
+        }
+    }
+
     // Compute the new PETSc global ordering and initialize the AO object.
     int ierr;
 
@@ -2997,18 +3345,35 @@ LDataManager::computeNodeDistribution(AO& ao,
         local_petsc_indices[k] = node_offset + k;
     }
 
-    if (ao)
+    // If no processor's set of local nodes has changed, the ordering is the
+    // same as in the previous distribution and the existing AO can be reused.
+    const bool reuse_ao =
+        preserve_ordering && d_ao[level_number] &&
+        IBTK_MPI::minReduction(static_cast<int>(local_lag_indices == old_local_lag_indices)) == 1;
+    if (reuse_ao)
     {
-        ierr = AODestroy(&ao);
-        IBTK_CHKERRQ(ierr);
+        if (ao && ao != d_ao[level_number])
+        {
+            ierr = AODestroy(&ao);
+            IBTK_CHKERRQ(ierr);
+        }
+        ao = d_ao[level_number];
     }
+    else
+    {
+        if (ao)
+        {
+            ierr = AODestroy(&ao);
+            IBTK_CHKERRQ(ierr);
+        }
 
-    ierr = AOCreateMapping(PETSC_COMM_WORLD,
-                           num_local_nodes,
-                           num_local_nodes > 0 ? &node_indices[0] : nullptr,
-                           num_local_nodes > 0 ? &local_petsc_indices[0] : nullptr,
-                           &ao);
-    IBTK_CHKERRQ(ierr);
+        ierr = AOCreateMapping(PETSC_COMM_WORLD,
+                               num_local_nodes,
+                               num_local_nodes > 0 ? &node_indices[0] : nullptr,
+                               num_local_nodes > 0 ? &local_petsc_indices[0] : nullptr,
+                               &ao);
+        IBTK_CHKERRQ(ierr);
+    }
 
     // Determine the PETSc local to global mapping (including PETSc Vec ghost
     // indices).
@@ -3045,6 +3410,36 @@ LDataManager::computeNodeDistribution(AO& ao,
     return;
 } // computeNodeDistribution
 
+int
+LDataManager::computeNumberOfMigratedNodes(const int level_number) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(level_number >= d_coarsest_ln && level_number <= d_finest_ln);
+#endif
+
+    // A node has migrated if it is now in the interior of a patch owned by this
+    // processor but was not previously a local node.  Each migrated node is
+    // counted only by the processor that now owns it.
+    const std::set<int> old_local_lag_indices(d_local_lag_indices[level_number].begin(),
+                                              d_local_lag_indices[level_number].end());
+    int num_migrated_nodes = 0;
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+        for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box); it != idx_data->data_end(); ++it)
+        {
+            if (old_local_lag_indices.find((*it)->getLagrangianIndex()) == old_local_lag_indices.end())
+            {
+                ++num_migrated_nodes;
+            }
+        }
+    }
+    return IBTK_MPI::sumReduction(num_migrated_nodes);
+} // computeNumberOfMigratedNodes
+
 void
 LDataManager::computeNodeOffsets(unsigned int& num_nodes, unsigned int& node_offset, const unsigned int num_local_nodes)
 {
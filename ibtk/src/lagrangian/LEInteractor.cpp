@@ -16,6 +16,7 @@
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LData.h"
 #include "ibtk/LEInteractor.h"
+#include "ibtk/LEInteractorKernels.h"
 #include "ibtk/LIndexSetData.h"
 #include "ibtk/LSet.h"
 #include "ibtk/ibtk_utilities.h"
@@ -30,6 +31,7 @@
 #include "NodeData.h"
 #include "NodeGeometry.h"
 #include "Patch.h"
+#include "PatchData.h"
 #include "SideData.h"
 #include "SideGeometry.h"
 #include "tbox/Database.h"
@@ -48,11 +50,22 @@ IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cmath>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <numeric>
 #include <ostream>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
+#ifdef IBTK_HAVE_OPENMP
+#include <omp.h>
+#endif
+
 // FORTRAN ROUTINES
 #if (NDIM == 2)
 #define LAGRANGIAN_PIECEWISE_CONSTANT_INTERP_FC                                                                        \
@@ -1718,15 +1731,605 @@ string_to_kernel(const std::string& kernel_fcn)
     TBOX_ERROR("Unknown kernel function " << kernel_fcn << std::endl);
     return INVALID;
 }
+
+// Number of colors required to ensure that no two tiles of the same color are
+// adjacent (i.e., a checkerboard coloring in each coordinate direction).
+constexpr int NUM_TILE_COLORS = 1 << NDIM;
+
+// Sort the provided points into cubic tiles of tile_width cells and group the
+// tiles by color. On output, the points of tile t are stored in the range
+// [tile_offsets[t], tile_offsets[t + 1]) of tile_local_indices (and,
+// correspondingly, tile_periodic_shifts) and the tiles of color c are
+// [color_offsets[c], color_offsets[c + 1]). Points retain their relative order
+// within each tile so that the result does not depend on the number of
+// threads.
+void
+sort_into_colored_tiles(std::vector<int>& tile_local_indices,
+                        std::vector<double>& tile_periodic_shifts,
+                        std::vector<int>& tile_offsets,
+                        std::array<int, NUM_TILE_COLORS + 1>& color_offsets,
+                        const std::vector<int>& local_indices,
+                        const std::vector<double>& periodic_shifts,
+                        const double* const X_data,
+                        const double* const x_lower,
+                        const double* const dx,
+                        const int tile_width)
+{
+    // Keys are (color, tile index) so that sorting them groups points first by
+    // color and then by tile.
+    using TileKey = std::array<int, NDIM + 1>;
+    const int num_points = static_cast<int>(local_indices.size());
+    std::vector<std::pair<TileKey, int> > keys(num_points);
+    for (int l = 0; l < num_points; ++l)
+    {
+        const int s = local_indices[l];
+        TileKey& key = keys[l].first;
+        key[0] = 0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const int cell = static_cast<int>(
+                std::floor((X_data[s * NDIM + d] + periodic_shifts[l * NDIM + d] - x_lower[d]) / dx[d]));
+            const int tile = cell >= 0 ? cell / tile_width : -((tile_width - 1 - cell) / tile_width);
+            key[0] += (tile & 1) << d;
+            key[d + 1] = tile;
+        }
+        keys[l].second = l;
+    }
+    std::stable_sort(keys.begin(),
+                     keys.end(),
+                     [](const std::pair<TileKey, int>& a, const std::pair<TileKey, int>& b)
+                     { return a.first < b.first; });
+
+    tile_local_indices.resize(num_points);
+    tile_periodic_shifts.resize(NDIM * num_points);
+    tile_offsets.clear();
+    color_offsets.fill(0);
+    for (int k = 0; k < num_points; ++k)
+    {
+        const int l = keys[k].second;
+        tile_local_indices[k] = local_indices[l];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            tile_periodic_shifts[k * NDIM + d] = periodic_shifts[l * NDIM + d];
+        }
+        if (k == 0 || keys[k].first != keys[k - 1].first)
+        {
+            tile_offsets.push_back(k);
+            ++color_offsets[keys[k].first[0] + 1];
+        }
+    }
+    tile_offsets.push_back(num_points);
+    std::partial_sum(color_offsets.begin(), color_offsets.end(), color_offsets.begin());
+    return;
+} // sort_into_colored_tiles
+
+// Delta function weights cached for the Lagrangian points of one patch. Slots
+// are identified by the local index of a point together with its periodic
+// shift; the slots of a given local index form a linked list starting at
+// first_slot. A slot is current only if the stored position matches the
+// position at which it is used, so modified positions are recomputed
+// automatically.
+struct WeightCacheEntry
+{
+    int stencil_size = 0;
+    std::vector<int> first_slot, next_slot;
+    std::vector<double> X, X_shift;
+    std::vector<int> stencil_lower;
+    std::vector<double> weights;
+};
+
+// Cache entries are keyed on the Lagrangian position data, the kernel, and the
+// index and physical coordinates of the lower corner and the grid spacing of
+// the Eulerian data.
+using WeightCacheKey =
+    std::tuple<const double*, int, std::array<int, NDIM>, std::array<double, NDIM>, std::array<double, NDIM> >;
+std::map<WeightCacheKey, WeightCacheEntry> weight_cache;
+
+// The numbers of point evaluations that reused cached weights and that had to
+// compute them since the cache was last cleared.
+std::atomic<std::size_t> num_weight_cache_hits(0), num_weight_cache_misses(0);
+
+// Return the stencil width of kernels whose one-dimensional weights may be
+// cached, or zero if the kernel is not supported by the weight cache.
+inline int
+get_cached_stencil_size(const KernelType kernel)
+{
+    switch (kernel)
+    {
+    case PIECEWISE_LINEAR:
+        return LEInteractorKernels::PiecewiseLinearKernel::width;
+    case IB_3:
+        return LEInteractorKernels::IB3Kernel::width;
+    case IB_4:
+        return LEInteractorKernels::IB4Kernel::width;
+    case IB_5:
+        return LEInteractorKernels::IB5Kernel::width;
+    case IB_6:
+        return LEInteractorKernels::IB6Kernel::width;
+    case BSPLINE_3:
+        return LEInteractorKernels::BSplineKernel<3>::width;
+    case BSPLINE_4:
+        return LEInteractorKernels::BSplineKernel<4>::width;
+    case BSPLINE_5:
+        return LEInteractorKernels::BSplineKernel<5>::width;
+    case BSPLINE_6:
+        return LEInteractorKernels::BSplineKernel<6>::width;
+    default:
+        return 0;
+    }
+}
+
+WeightCacheEntry&
+get_weight_cache_entry(const double* const X_data,
+                       const KernelType kernel,
+                       const Box<NDIM>& q_data_box,
+                       const double* const x_lower,
+                       const double* const dx)
+{
+    WeightCacheKey key;
+    std::get<0>(key) = X_data;
+    std::get<1>(key) = static_cast<int>(kernel);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        std::get<2>(key)[d] = q_data_box.lower()(d);
+        std::get<3>(key)[d] = x_lower[d];
+        std::get<4>(key)[d] = dx[d];
+    }
+    WeightCacheEntry& entry = weight_cache[key];
+    entry.stencil_size = get_cached_stencil_size(kernel);
+    return entry;
+}
+
+// Determine the cache slot of each of the provided points, allocating new
+// (invalid) slots as needed. This is not thread-safe.
+void
+get_weight_cache_slots(std::vector<int>& slots,
+                       WeightCacheEntry& entry,
+                       const std::vector<int>& local_indices,
+                       const std::vector<double>& periodic_shifts)
+{
+    const int num_points = static_cast<int>(local_indices.size());
+    const int stencil_size = entry.stencil_size;
+    slots.resize(num_points);
+    for (int l = 0; l < num_points; ++l)
+    {
+        const int s = local_indices[l];
+        const double* const X_shift = &periodic_shifts[NDIM * l];
+        if (s >= static_cast<int>(entry.first_slot.size())) entry.first_slot.resize(s + 1, -1);
+        int prev_slot = -1;
+        int slot = entry.first_slot[s];
+        while (slot != -1 && !std::equal(X_shift, X_shift + NDIM, &entry.X_shift[NDIM * slot]))
+        {
+            prev_slot = slot;
+            slot = entry.next_slot[slot];
+        }
+        if (slot == -1)
+        {
+            slot = static_cast<int>(entry.next_slot.size());
+            if (prev_slot == -1)
+                entry.first_slot[s] = slot;
+            else
+                entry.next_slot[prev_slot] = slot;
+            entry.next_slot.push_back(-1);
+            entry.X.resize(NDIM * (slot + 1), std::numeric_limits<double>::quiet_NaN());
+            entry.X_shift.insert(entry.X_shift.end(), X_shift, X_shift + NDIM);
+            entry.stencil_lower.resize(NDIM * (slot + 1));
+            entry.weights.resize(NDIM * stencil_size * (slot + 1));
+        }
+        slots[l] = slot;
+    }
+    return;
+} // get_weight_cache_slots
+
+// Compute the lower index of the (unclipped) stencil and the one-dimensional
+// weights for the position X + X_shift along one coordinate direction.
+void
+compute_cached_weights(int& stencil_lower,
+                       double* const w,
+                       const KernelType kernel,
+                       const double X,
+                       const double X_shift,
+                       const double x_lower,
+                       const int ilower,
+                       const double dx)
+{
+    using namespace LEInteractorKernels;
+    switch (kernel)
+    {
+    case PIECEWISE_LINEAR:
+        PiecewiseLinearKernel::weights(stencil_lower, w, X, X_shift, x_lower, ilower, dx);
+        break;
+    case IB_3:
+        IB3Kernel::weights(stencil_lower, w, X, X_shift, x_lower, ilower, dx);
+        break;
+    case IB_4:
+        IB4Kernel::weights(stencil_lower, w, X, X_shift, x_lower, ilower, dx);
+        break;
+    case IB_5:
+        IB5Kernel::weights(stencil_lower, w, X, X_shift, x_lower, ilower, dx);
+        break;
+    case IB_6:
+        IB6Kernel::weights(stencil_lower, w, X, X_shift, x_lower, ilower, dx);
+        break;
+    case BSPLINE_3:
+        BSplineKernel<3>::weights(stencil_lower, w, X, X_shift, x_lower, ilower, dx);
+        break;
+    case BSPLINE_4:
+        BSplineKernel<4>::weights(stencil_lower, w, X, X_shift, x_lower, ilower, dx);
+        break;
+    case BSPLINE_5:
+        BSplineKernel<5>::weights(stencil_lower, w, X, X_shift, x_lower, ilower, dx);
+        break;
+    case BSPLINE_6:
+        BSplineKernel<6>::weights(stencil_lower, w, X, X_shift, x_lower, ilower, dx);
+        break;
+    default:
+        TBOX_ERROR("LEInteractor: kernel is not supported by the weight cache.\n");
+    }
+    return;
+} // compute_cached_weights
+
+// Recompute the cached weights of the provided points if their positions have
+// changed since the weights were last computed. Distinct points must use
+// distinct slots, in which case this may be called concurrently.
+void
+update_cached_weights(WeightCacheEntry& entry,
+                      const int* const slots,
+                      const int* const local_indices,
+                      const int num_points,
+                      const double* const X_data,
+                      const KernelType kernel,
+                      const Box<NDIM>& q_data_box,
+                      const double* const x_lower,
+                      const double* const dx)
+{
+    const int stencil_size = entry.stencil_size;
+    std::size_t num_misses = 0;
+    for (int l = 0; l < num_points; ++l)
+    {
+        const int slot = slots[l];
+        const double* const X = &X_data[NDIM * local_indices[l]];
+        double* const X_cached = &entry.X[NDIM * slot];
+        if (std::equal(X, X + NDIM, X_cached)) continue;
+        ++num_misses;
+        std::copy(X, X + NDIM, X_cached);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            compute_cached_weights(entry.stencil_lower[NDIM * slot + d],
+                                   &entry.weights[(NDIM * slot + d) * stencil_size],
+                                   kernel,
+                                   X[d],
+                                   entry.X_shift[NDIM * slot + d],
+                                   x_lower[d],
+                                   q_data_box.lower()(d),
+                                   dx[d]);
+        }
+    }
+    num_weight_cache_hits += num_points - num_misses;
+    num_weight_cache_misses += num_misses;
+    return;
+} // update_cached_weights
+
+// Determine the range of the stencil of a cached point which lies within the
+// ghost box of the Eulerian data.
+inline void
+get_clipped_stencil_range(std::array<int, NDIM>& istart,
+                          std::array<int, NDIM>& istop,
+                          const int* const stencil_lower,
+                          const int stencil_size,
+                          const Box<NDIM>& q_data_box,
+                          const IntVector<NDIM>& q_gcw)
+{
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const int ig_lower = q_data_box.lower()(d) - q_gcw(d);
+        const int ig_upper = q_data_box.upper()(d) + q_gcw(d);
+        istart[d] = std::max(ig_lower - stencil_lower[d], 0);
+        istop[d] = stencil_size - 1 - std::max(stencil_lower[d] + stencil_size - 1 - ig_upper, 0);
+    }
+    return;
+} // get_clipped_stencil_range
+
+// Interpolate using cached weights. The Eulerian data are stored in SAMRAI's
+// (Fortran) ordering on the ghost box.
+void
+interpolate_cached(double* const Q_data,
+                   const double* const q_data,
+                   const Box<NDIM>& q_data_box,
+                   const IntVector<NDIM>& q_gcw,
+                   const int q_depth,
+                   const WeightCacheEntry& entry,
+                   const int* const slots,
+                   const int* const local_indices,
+                   const int num_points)
+{
+    const int stencil_size = entry.stencil_size;
+    const Box<NDIM> ghost_box = Box<NDIM>::grow(q_data_box, q_gcw);
+    const IntVector<NDIM> ghost_dims = ghost_box.numberCells();
+    const int depth_stride = static_cast<int>(ghost_box.size());
+    std::array<int, NDIM> istart, istop;
+    for (int l = 0; l < num_points; ++l)
+    {
+        const int slot = slots[l];
+        const int* const ic_lower = &entry.stencil_lower[NDIM * slot];
+        const double* const w0 = &entry.weights[NDIM * stencil_size * slot];
+        const double* const w1 = w0 + stencil_size;
+#if (NDIM == 3)
+        const double* const w2 = w1 + stencil_size;
+#endif
+        get_clipped_stencil_range(istart, istop, ic_lower, stencil_size, q_data_box, q_gcw);
+        double* const V = &Q_data[q_depth * local_indices[l]];
+        for (int d = 0; d < q_depth; ++d)
+        {
+            const double* const u = &q_data[d * depth_stride];
+            double V_d = 0.0;
+#if (NDIM == 2)
+            for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+            {
+                const double* const u_row =
+                    &u[(ic_lower[1] + i1 - ghost_box.lower()(1)) * ghost_dims(0) + ic_lower[0] - ghost_box.lower()(0)];
+                for (int i0 = istart[0]; i0 <= istop[0]; ++i0)
+                {
+                    V_d += w0[i0] * w1[i1] * u_row[i0];
+                }
+            }
+#endif
+#if (NDIM == 3)
+            for (int i2 = istart[2]; i2 <= istop[2]; ++i2)
+            {
+                for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+                {
+                    const double wyz = w1[i1] * w2[i2];
+                    const double* const u_row =
+                        &u[((ic_lower[2] + i2 - ghost_box.lower()(2)) * ghost_dims(1) + ic_lower[1] + i1 -
+                            ghost_box.lower()(1)) *
+                               ghost_dims(0) +
+                           ic_lower[0] - ghost_box.lower()(0)];
+                    for (int i0 = istart[0]; i0 <= istop[0]; ++i0)
+                    {
+                        V_d += w0[i0] * wyz * u_row[i0];
+                    }
+                }
+            }
+#endif
+            V[d] = V_d;
+        }
+    }
+    return;
+} // interpolate_cached
+
+// Spread using cached weights. The Eulerian data are stored in SAMRAI's
+// (Fortran) ordering on the ghost box.
+void
+spread_cached(double* const q_data,
+              const Box<NDIM>& q_data_box,
+              const IntVector<NDIM>& q_gcw,
+              const int q_depth,
+              const double* const Q_data,
+              const double* const dx,
+              const WeightCacheEntry& entry,
+              const int* const slots,
+              const int* const local_indices,
+              const int num_points)
+{
+    const int stencil_size = entry.stencil_size;
+    const Box<NDIM> ghost_box = Box<NDIM>::grow(q_data_box, q_gcw);
+    const IntVector<NDIM> ghost_dims = ghost_box.numberCells();
+    const int depth_stride = static_cast<int>(ghost_box.size());
+    double vol = 1.0;
+    for (unsigned int d = 0; d < NDIM; ++d) vol *= dx[d];
+    std::array<int, NDIM> istart, istop;
+    for (int l = 0; l < num_points; ++l)
+    {
+        const int slot = slots[l];
+        const int* const ic_lower = &entry.stencil_lower[NDIM * slot];
+        const double* const w0 = &entry.weights[NDIM * stencil_size * slot];
+        const double* const w1 = w0 + stencil_size;
+#if (NDIM == 3)
+        const double* const w2 = w1 + stencil_size;
+#endif
+        get_clipped_stencil_range(istart, istop, ic_lower, stencil_size, q_data_box, q_gcw);
+        const double* const V = &Q_data[q_depth * local_indices[l]];
+        for (int d = 0; d < q_depth; ++d)
+        {
+            double* const u = &q_data[d * depth_stride];
+#if (NDIM == 2)
+            for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+            {
+                const double wy = w1[i1] / vol;
+                double* const u_row =
+                    &u[(ic_lower[1] + i1 - ghost_box.lower()(1)) * ghost_dims(0) + ic_lower[0] - ghost_box.lower()(0)];
+                for (int i0 = istart[0]; i0 <= istop[0]; ++i0)
+                {
+                    u_row[i0] += w0[i0] * wy * V[d];
+                }
+            }
+#endif
+#if (NDIM == 3)
+            for (int i2 = istart[2]; i2 <= istop[2]; ++i2)
+            {
+                const double wz = w2[i2] / vol;
+                for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+                {
+                    const double wyz = w1[i1] * wz;
+                    double* const u_row =
+                        &u[((ic_lower[2] + i2 - ghost_box.lower()(2)) * ghost_dims(1) + ic_lower[1] + i1 -
+                            ghost_box.lower()(1)) *
+                               ghost_dims(0) +
+                           ic_lower[0] - ghost_box.lower()(0)];
+                    for (int i0 = istart[0]; i0 <= istop[0]; ++i0)
+                    {
+                        u_row[i0] += w0[i0] * wyz * V[d];
+                    }
+                }
+            }
+#endif
+        }
+    }
+    return;
+} // spread_cached
+
+// Apply the templated C++ implementation of the interpolation kernel, if there
+// is one. Returns false if the kernel is only implemented in Fortran.
+template <int Q_DEPTH>
+bool
+interpolate_templated(const KernelType kernel,
+                      double* const Q_data,
+                      const double* const X_data,
+                      const double* const q_data,
+                      const int q_depth,
+                      const int* const ilower,
+                      const int* const iupper,
+                      const int* const q_gcw,
+                      const double* const x_lower,
+                      const double* const dx,
+                      const int* const local_indices,
+                      const double* const periodic_shifts,
+                      const int num_local_indices)
+{
+    using namespace LEInteractorKernels;
+#define IBTK_INTERPOLATE_TEMPLATED(KERNEL)                                                                             \
+    interpolate<KERNEL, NDIM, Q_DEPTH>(Q_data,                                                                         \
+                                       X_data,                                                                         \
+                                       q_data,                                                                         \
+                                       q_depth,                                                                        \
+                                       ilower,                                                                         \
+                                       iupper,                                                                         \
+                                       q_gcw,                                                                          \
+                                       x_lower,                                                                        \
+                                       dx,                                                                             \
+                                       local_indices,                                                                  \
+                                       periodic_shifts,                                                                \
+                                       num_local_indices)
+    switch (kernel)
+    {
+    case PIECEWISE_LINEAR:
+        IBTK_INTERPOLATE_TEMPLATED(PiecewiseLinearKernel);
+        return true;
+    case IB_3:
+        IBTK_INTERPOLATE_TEMPLATED(IB3Kernel);
+        return true;
+    case IB_4:
+        IBTK_INTERPOLATE_TEMPLATED(IB4Kernel);
+        return true;
+    case IB_5:
+        IBTK_INTERPOLATE_TEMPLATED(IB5Kernel);
+        return true;
+    case IB_6:
+        IBTK_INTERPOLATE_TEMPLATED(IB6Kernel);
+        return true;
+    case BSPLINE_3:
+        IBTK_INTERPOLATE_TEMPLATED(BSplineKernel<3>);
+        return true;
+    case BSPLINE_4:
+        IBTK_INTERPOLATE_TEMPLATED(BSplineKernel<4>);
+        return true;
+    case BSPLINE_5:
+        IBTK_INTERPOLATE_TEMPLATED(BSplineKernel<5>);
+        return true;
+    case BSPLINE_6:
+        IBTK_INTERPOLATE_TEMPLATED(BSplineKernel<6>);
+        return true;
+    default:
+        return false;
+    }
+#undef IBTK_INTERPOLATE_TEMPLATED
+} // interpolate_templated
+
+// Apply the templated C++ implementation of the spreading kernel, if there is
+// one. Returns false if the kernel is only implemented in Fortran.
+template <int Q_DEPTH>
+bool
+spread_templated(const KernelType kernel,
+                 double* const q_data,
+                 const double* const Q_data,
+                 const double* const X_data,
+                 const int q_depth,
+                 const int* const ilower,
+                 const int* const iupper,
+                 const int* const q_gcw,
+                 const double* const x_lower,
+                 const double* const dx,
+                 const int* const local_indices,
+                 const double* const periodic_shifts,
+                 const int num_local_indices)
+{
+    using namespace LEInteractorKernels;
+#define IBTK_SPREAD_TEMPLATED(KERNEL)                                                                                  \
+    spread<KERNEL, NDIM, Q_DEPTH>(q_data,                                                                              \
+                                  Q_data,                                                                              \
+                                  X_data,                                                                              \
+                                  q_depth,                                                                             \
+                                  ilower,                                                                              \
+                                  iupper,                                                                              \
+                                  q_gcw,                                                                               \
+                                  x_lower,                                                                             \
+                                  dx,                                                                                  \
+                                  local_indices,                                                                       \
+                                  periodic_shifts,                                                                     \
+                                  num_local_indices)
+    switch (kernel)
+    {
+    case PIECEWISE_LINEAR:
+        IBTK_SPREAD_TEMPLATED(PiecewiseLinearKernel);
+        return true;
+    case IB_3:
+        IBTK_SPREAD_TEMPLATED(IB3Kernel);
+        return true;
+    case IB_4:
+        IBTK_SPREAD_TEMPLATED(IB4Kernel);
+        return true;
+    case IB_5:
+        IBTK_SPREAD_TEMPLATED(IB5Kernel);
+        return true;
+    case IB_6:
+        IBTK_SPREAD_TEMPLATED(IB6Kernel);
+        return true;
+    case BSPLINE_3:
+        IBTK_SPREAD_TEMPLATED(BSplineKernel<3>);
+        return true;
+    case BSPLINE_4:
+        IBTK_SPREAD_TEMPLATED(BSplineKernel<4>);
+        return true;
+    case BSPLINE_5:
+        IBTK_SPREAD_TEMPLATED(BSplineKernel<5>);
+        return true;
+    case BSPLINE_6:
+        IBTK_SPREAD_TEMPLATED(BSplineKernel<6>);
+        return true;
+    default:
+        return false;
+    }
+#undef IBTK_SPREAD_TEMPLATED
+} // spread_templated
 } // namespace
 
 double (*LEInteractor::s_kernel_fcn)(double r) = &ib4_kernel_fcn;
 int LEInteractor::s_kernel_fcn_stencil_size = 4;
+int LEInteractor::s_num_threads = 0;
+bool LEInteractor::s_use_threaded_spreading = false;
+bool LEInteractor::s_use_threaded_interpolation = false;
+bool LEInteractor::s_use_weight_cache = false;
+bool LEInteractor::s_use_templated_kernels = false;
 
 void
-LEInteractor::setFromDatabase(Pointer<Database> /*db*/)
+LEInteractor::setFromDatabase(Pointer<Database> db)
 {
-    // intentionally blank
+    if (!db) return;
+    if (db->keyExists("num_threads")) s_num_threads = db->getInteger("num_threads");
+    if (db->keyExists("use_threaded_spreading")) s_use_threaded_spreading = db->getBool("use_threaded_spreading");
+    if (db->keyExists("use_threaded_interpolation"))
+        s_use_threaded_interpolation = db->getBool("use_threaded_interpolation");
+    if (db->keyExists("use_weight_cache")) s_use_weight_cache = db->getBool("use_weight_cache");
+    if (db->keyExists("use_templated_kernels")) s_use_templated_kernels = db->getBool("use_templated_kernels");
+#ifndef IBTK_HAVE_OPENMP
+    if (s_use_threaded_spreading || s_use_threaded_interpolation)
+    {
+        TBOX_WARNING("LEInteractor::setFromDatabase():\n"
+                     << "  IBAMR was compiled without OpenMP: threaded spreading and interpolation will use a single "
+                        "thread.\n");
+    }
+#endif
     return;
 }
 
@@ -1734,9 +2337,51 @@ void
 LEInteractor::printClassData(std::ostream& os)
 {
     os << "LEInteractor::printClassData():\n";
+    os << "  s_num_threads = " << s_num_threads << "\n";
+    os << "  s_use_threaded_spreading = " << s_use_threaded_spreading << "\n";
+    os << "  s_use_threaded_interpolation = " << s_use_threaded_interpolation << "\n";
+    os << "  s_use_weight_cache = " << s_use_weight_cache << "\n";
+    os << "  s_use_templated_kernels = " << s_use_templated_kernels << "\n";
+    return;
+}
+
+int
+LEInteractor::getNumThreads()
+{
+#ifdef IBTK_HAVE_OPENMP
+    return s_num_threads > 0 ? s_num_threads : omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+bool
+LEInteractor::getUseThreadedInterpolation()
+{
+    return s_use_threaded_interpolation;
+}
+
+void
+LEInteractor::clearWeightCache()
+{
+    weight_cache.clear();
+    num_weight_cache_hits = 0;
+    num_weight_cache_misses = 0;
     return;
 }
 
+std::size_t
+LEInteractor::getNumberOfWeightCacheHits()
+{
+    return num_weight_cache_hits;
+}
+
+std::size_t
+LEInteractor::getNumberOfWeightCacheMisses()
+{
+    return num_weight_cache_misses;
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 bool
@@ -1959,6 +2604,56 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
     return;
 }
 
+template <class T>
+void
+LEInteractor::interpolate(const std::vector<std::pair<Pointer<PatchData<NDIM> >, Pointer<LData> > >& q_Q_data,
+                          const Pointer<LData> X_data,
+                          const Pointer<LIndexSetData<T> > idx_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const IntVector<NDIM>& periodic_shift,
+                          const std::string& interp_fcn)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(X_data);
+    TBOX_ASSERT(idx_data);
+    TBOX_ASSERT(patch);
+    TBOX_ASSERT(X_data->getDepth() == NDIM);
+    for (const auto& q_Q : q_Q_data)
+    {
+        TBOX_ASSERT(q_Q.first);
+        TBOX_ASSERT(q_Q.second);
+    }
+#endif
+    // Generate a list of local indices which lie in the specified box.
+    std::vector<int> local_indices;
+    std::vector<double> periodic_shifts;
+    buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
+
+    // Interpolate each quantity.  The weights are computed only once per data
+    // centering: if the weight cache is disabled, it is used only for the
+    // duration of this call.
+    const bool use_weight_cache = s_use_weight_cache || q_Q_data.size() > 1;
+    const double* const X = X_data->getGhostedLocalFormVecArray()->data();
+    for (const auto& q_Q : q_Q_data)
+    {
+        Pointer<LData> Q_data = q_Q.second;
+        interpolateField(Q_data->getGhostedLocalFormVecArray()->data(),
+                         Q_data->getDepth(),
+                         X,
+                         q_Q.first,
+                         patch,
+                         local_indices,
+                         periodic_shifts,
+                         interp_fcn,
+                         use_weight_cache);
+        Q_data->restoreArrays();
+    }
+    X_data->restoreArrays();
+    if (!s_use_weight_cache) weight_cache.clear();
+    return;
+}
+
 template <class T>
 void
 LEInteractor::interpolate(double* const Q_data,
@@ -1981,45 +2676,14 @@ LEInteractor::interpolate(double* const Q_data,
 #else
     NULL_USE(X_depth);
 #endif
-    // Determine the patch geometry.
-    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-    const double* const x_lower = pgeom->getXLower();
-    const double* const x_upper = pgeom->getXUpper();
-    const double* const dx = pgeom->getDx();
-    std::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
-    std::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        static const int lower = 0;
-        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
-        static const int upper = 1;
-        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
-    }
-
     // Generate a list of local indices which lie in the specified box.
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
     buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
 
     // Interpolate.
-    if (!local_indices.empty())
-    {
-        interpolate(Q_data,
-                    Q_depth,
-                    X_data,
-                    q_data->getPointer(),
-                    q_data->getBox(),
-                    q_data->getGhostCellWidth(),
-                    q_data->getDepth(),
-                    x_lower,
-                    x_upper,
-                    dx,
-                    patch_touches_lower_physical_bdry,
-                    patch_touches_upper_physical_bdry,
-                    local_indices,
-                    periodic_shifts,
-                    interp_fcn);
-    }
+    interpolateField(
+        Q_data, Q_depth, X_data, q_data, patch, local_indices, periodic_shifts, interp_fcn, s_use_weight_cache);
     return;
 }
 
@@ -2045,51 +2709,14 @@ LEInteractor::interpolate(double* const Q_data,
 #else
     NULL_USE(X_depth);
 #endif
-    // Determine the patch geometry.
-    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-    const double* const x_lower = pgeom->getXLower();
-    const double* const x_upper = pgeom->getXUpper();
-    const double* const dx = pgeom->getDx();
-    std::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
-    std::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        static const int lower = 0;
-        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
-        static const int upper = 1;
-        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
-    }
-
     // Generate a list of local indices which lie in the specified box.
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
     buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
 
     // Interpolate.
-    if (!local_indices.empty())
-    {
-        std::array<double, NDIM> x_lower_node, x_upper_node;
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            x_lower_node[d] = x_lower[d] - 0.5 * dx[d];
-            x_upper_node[d] = x_upper[d] + 0.5 * dx[d];
-        }
-        interpolate(Q_data,
-                    Q_depth,
-                    X_data,
-                    q_data->getPointer(),
-                    NodeGeometry<NDIM>::toNodeBox(q_data->getBox()),
-                    q_data->getGhostCellWidth(),
-                    q_data->getDepth(),
-                    x_lower_node.data(),
-                    x_upper_node.data(),
-                    dx,
-                    patch_touches_lower_physical_bdry,
-                    patch_touches_upper_physical_bdry,
-                    local_indices,
-                    periodic_shifts,
-                    interp_fcn);
-    }
+    interpolateField(
+        Q_data, Q_depth, X_data, q_data, patch, local_indices, periodic_shifts, interp_fcn, s_use_weight_cache);
     return;
 }
 
@@ -2116,69 +2743,14 @@ LEInteractor::interpolate(double* const Q_data,
 #else
     NULL_USE(X_depth);
 #endif
-    if (Q_depth != NDIM || q_data->getDepth() != 1)
-    {
-        TBOX_ERROR("LEInteractor::interpolate():\n"
-                   << "  side-centered interpolation requires vector-valued data.\n");
-    }
-
-    // Determine the patch geometry.
-    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-    const double* const x_lower = pgeom->getXLower();
-    const double* const x_upper = pgeom->getXUpper();
-    const double* const dx = pgeom->getDx();
-    std::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
-    std::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        static const int lower = 0;
-        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
-        static const int upper = 1;
-        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
-    }
-
     // Generate a list of local indices which lie in the specified box.
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
     buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
 
     // Interpolate.
-    if (!local_indices.empty())
-    {
-        std::array<double, NDIM> x_lower_axis, x_upper_axis;
-        const int local_sz = (*std::max_element(local_indices.begin(), local_indices.end())) + 1;
-        std::vector<double> Q_data_axis(local_sz);
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                x_lower_axis[d] = x_lower[d];
-                x_upper_axis[d] = x_upper[d];
-            }
-            x_lower_axis[axis] -= 0.5 * dx[axis];
-            x_upper_axis[axis] += 0.5 * dx[axis];
-            interpolate(&Q_data_axis[0],
-                        /*Q_depth*/ 1,
-                        X_data,
-                        q_data->getPointer(axis),
-                        SideGeometry<NDIM>::toSideBox(q_data->getBox(), axis),
-                        q_data->getGhostCellWidth(),
-                        /*q_depth*/ 1,
-                        x_lower_axis.data(),
-                        x_upper_axis.data(),
-                        dx,
-                        patch_touches_lower_physical_bdry,
-                        patch_touches_upper_physical_bdry,
-                        local_indices,
-                        periodic_shifts,
-                        interp_fcn,
-                        axis);
-            for (const auto& local_index : local_indices)
-            {
-                Q_data[NDIM * local_index + axis] = Q_data_axis[local_index];
-            }
-        }
-    }
+    interpolateField(
+        Q_data, Q_depth, X_data, q_data, patch, local_indices, periodic_shifts, interp_fcn, s_use_weight_cache);
     return;
 }
 
@@ -2205,72 +2777,14 @@ LEInteractor::interpolate(double* const Q_data,
 #else
     NULL_USE(X_depth);
 #endif
-    if (NDIM != 3 || Q_depth != NDIM || q_data->getDepth() != 1)
-    {
-        TBOX_ERROR("LEInteractor::interpolate():\n"
-                   << "  edge-centered interpolation requires 3D vector-valued data.\n");
-    }
-
-    // Determine the patch geometry.
-    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-    const double* const x_lower = pgeom->getXLower();
-    const double* const x_upper = pgeom->getXUpper();
-    const double* const dx = pgeom->getDx();
-    std::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
-    std::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        static const int lower = 0;
-        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
-        static const int upper = 1;
-        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
-    }
-
     // Generate a list of local indices which lie in the specified box.
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
     buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
 
     // Interpolate.
-    if (!local_indices.empty())
-    {
-        std::array<double, NDIM> x_lower_axis, x_upper_axis;
-        const int local_sz = (*std::max_element(local_indices.begin(), local_indices.end())) + 1;
-        std::vector<double> Q_data_axis(local_sz);
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                x_lower_axis[d] = x_lower[d];
-                x_upper_axis[d] = x_upper[d];
-                if (d != axis)
-                {
-                    x_lower_axis[d] -= 0.5 * dx[d];
-                    x_upper_axis[d] += 0.5 * dx[d];
-                }
-            }
-            interpolate(&Q_data_axis[0],
-                        /*Q_depth*/ 1,
-                        X_data,
-                        q_data->getPointer(axis),
-                        EdgeGeometry<NDIM>::toEdgeBox(q_data->getBox(), axis),
-                        q_data->getGhostCellWidth(),
-                        /*q_depth*/ 1,
-                        x_lower_axis.data(),
-                        x_upper_axis.data(),
-                        dx,
-                        patch_touches_lower_physical_bdry,
-                        patch_touches_upper_physical_bdry,
-                        local_indices,
-                        periodic_shifts,
-                        interp_fcn,
-                        axis);
-            for (const auto& local_index : local_indices)
-            {
-                Q_data[NDIM * local_index + axis] = Q_data_axis[local_index];
-            }
-        }
-    }
+    interpolateField(
+        Q_data, Q_depth, X_data, q_data, patch, local_indices, periodic_shifts, interp_fcn, s_use_weight_cache);
     return;
 }
 
@@ -3123,6 +3637,56 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
     return;
 }
 
+template <class T>
+void
+LEInteractor::spread(const std::vector<std::pair<Pointer<PatchData<NDIM> >, Pointer<LData> > >& q_Q_data,
+                     const Pointer<LData> X_data,
+                     const Pointer<LIndexSetData<T> > idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const std::string& spread_fcn)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(X_data);
+    TBOX_ASSERT(idx_data);
+    TBOX_ASSERT(patch);
+    TBOX_ASSERT(X_data->getDepth() == NDIM);
+    for (const auto& q_Q : q_Q_data)
+    {
+        TBOX_ASSERT(q_Q.first);
+        TBOX_ASSERT(q_Q.second);
+    }
+#endif
+    // Generate a list of local indices which lie in the specified box.
+    std::vector<int> local_indices;
+    std::vector<double> periodic_shifts;
+    buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
+
+    // Spread each quantity.  The weights are computed only once per data
+    // centering: if the weight cache is disabled, it is used only for the
+    // duration of this call.
+    const bool use_weight_cache = s_use_weight_cache || q_Q_data.size() > 1;
+    const double* const X = X_data->getGhostedLocalFormVecArray()->data();
+    for (const auto& q_Q : q_Q_data)
+    {
+        Pointer<LData> Q_data = q_Q.second;
+        spreadField(q_Q.first,
+                    Q_data->getGhostedLocalFormVecArray()->data(),
+                    Q_data->getDepth(),
+                    X,
+                    patch,
+                    local_indices,
+                    periodic_shifts,
+                    spread_fcn,
+                    use_weight_cache);
+        Q_data->restoreArrays();
+    }
+    X_data->restoreArrays();
+    if (!s_use_weight_cache) weight_cache.clear();
+    return;
+}
+
 template <class T>
 void
 LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
@@ -3145,45 +3709,14 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
 #else
     NULL_USE(X_depth);
 #endif
-    // Determine the patch geometry.
-    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-    const double* const x_lower = pgeom->getXLower();
-    const double* const x_upper = pgeom->getXUpper();
-    const double* const dx = pgeom->getDx();
-    std::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
-    std::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        static const int lower = 0;
-        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
-        static const int upper = 1;
-        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
-    }
-
     // Generate a list of local indices which lie in the specified box.
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
     buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
 
     // Spread.
-    if (!local_indices.empty())
-    {
-        spread(q_data->getPointer(),
-               q_data->getBox(),
-               q_data->getGhostCellWidth(),
-               q_data->getDepth(),
-               Q_data,
-               Q_depth,
-               X_data,
-               x_lower,
-               x_upper,
-               dx,
-               patch_touches_lower_physical_bdry,
-               patch_touches_upper_physical_bdry,
-               local_indices,
-               periodic_shifts,
-               spread_fcn);
-    }
+    spreadField(
+        q_data, Q_data, Q_depth, X_data, patch, local_indices, periodic_shifts, spread_fcn, s_use_weight_cache);
     return;
 }
 
@@ -3209,51 +3742,14 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
 #else
     NULL_USE(X_depth);
 #endif
-    // Determine the patch geometry.
-    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-    const double* const x_lower = pgeom->getXLower();
-    const double* const x_upper = pgeom->getXUpper();
-    const double* const dx = pgeom->getDx();
-    std::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
-    std::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        static const int lower = 0;
-        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
-        static const int upper = 1;
-        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
-    }
-
     // Generate a list of local indices which lie in the specified box.
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
     buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
 
     // Spread.
-    if (!local_indices.empty())
-    {
-        std::array<double, NDIM> x_lower_node, x_upper_node;
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            x_lower_node[d] = x_lower[d] - 0.5 * dx[d];
-            x_upper_node[d] = x_upper[d] + 0.5 * dx[d];
-        }
-        spread(q_data->getPointer(),
-               NodeGeometry<NDIM>::toNodeBox(q_data->getBox()),
-               q_data->getGhostCellWidth(),
-               q_data->getDepth(),
-               Q_data,
-               Q_depth,
-               X_data,
-               x_lower_node.data(),
-               x_upper_node.data(),
-               dx,
-               patch_touches_lower_physical_bdry,
-               patch_touches_upper_physical_bdry,
-               local_indices,
-               periodic_shifts,
-               spread_fcn);
-    }
+    spreadField(
+        q_data, Q_data, Q_depth, X_data, patch, local_indices, periodic_shifts, spread_fcn, s_use_weight_cache);
     return;
 }
 
@@ -3280,69 +3776,14 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
 #else
     NULL_USE(X_depth);
 #endif
-    if (Q_depth != NDIM || q_data->getDepth() != 1)
-    {
-        TBOX_ERROR("LEInteractor::spread():\n"
-                   << "  side-centered spreading requires vector-valued data.\n");
-    }
-
-    // Determine the patch geometry.
-    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-    const double* const x_lower = pgeom->getXLower();
-    const double* const x_upper = pgeom->getXUpper();
-    const double* const dx = pgeom->getDx();
-    std::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
-    std::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        static const int lower = 0;
-        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
-        static const int upper = 1;
-        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
-    }
-
     // Generate a list of local indices which lie in the specified box.
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
     buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
 
     // Spread.
-    if (!local_indices.empty())
-    {
-        std::array<double, NDIM> x_lower_axis, x_upper_axis;
-        const int local_sz = (*std::max_element(local_indices.begin(), local_indices.end())) + 1;
-        std::vector<double> Q_data_axis(local_sz);
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                x_lower_axis[d] = x_lower[d];
-                x_upper_axis[d] = x_upper[d];
-            }
-            x_lower_axis[axis] -= 0.5 * dx[axis];
-            x_upper_axis[axis] += 0.5 * dx[axis];
-            for (const auto& local_index : local_indices)
-            {
-                Q_data_axis[local_index] = Q_data[NDIM * local_index + axis];
-            }
-            spread(q_data->getPointer(axis),
-                   SideGeometry<NDIM>::toSideBox(q_data->getBox(), axis),
-                   q_data->getGhostCellWidth(),
-                   /*q_depth*/ 1,
-                   &Q_data_axis[0],
-                   /*Q_depth*/ 1,
-                   X_data,
-                   x_lower_axis.data(),
-                   x_upper_axis.data(),
-                   dx,
-                   patch_touches_lower_physical_bdry,
-                   patch_touches_upper_physical_bdry,
-                   local_indices,
-                   periodic_shifts,
-                   spread_fcn,
-                   axis);
-        }
-    }
+    spreadField(
+        q_data, Q_data, Q_depth, X_data, patch, local_indices, periodic_shifts, spread_fcn, s_use_weight_cache);
     return;
 }
 
@@ -3369,72 +3810,14 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
 #else
     NULL_USE(X_depth);
 #endif
-    if (NDIM != 3 || Q_depth != NDIM || q_data->getDepth() != 1)
-    {
-        TBOX_ERROR("LEInteractor::spread():\n"
-                   << "  edge-centered interpolation requires 3D vector-valued data.\n");
-    }
-
-    // Determine the patch geometry.
-    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-    const double* const x_lower = pgeom->getXLower();
-    const double* const x_upper = pgeom->getXUpper();
-    const double* const dx = pgeom->getDx();
-    std::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
-    std::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        static const int lower = 0;
-        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
-        static const int upper = 1;
-        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
-    }
-
     // Generate a list of local indices which lie in the specified box.
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
     buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
 
     // Spread.
-    if (!local_indices.empty())
-    {
-        std::array<double, NDIM> x_lower_axis, x_upper_axis;
-        const int local_sz = (*std::max_element(local_indices.begin(), local_indices.end())) + 1;
-        std::vector<double> Q_data_axis(local_sz);
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                x_lower_axis[d] = x_lower[d];
-                x_upper_axis[d] = x_upper[d];
-                if (d != axis)
-                {
-                    x_lower_axis[d] -= 0.5 * dx[d];
-                    x_upper_axis[d] += 0.5 * dx[d];
-                }
-            }
-            for (const auto& local_index : local_indices)
-            {
-                Q_data_axis[local_index] = Q_data[NDIM * local_index + axis];
-            }
-            spread(q_data->getPointer(axis),
-                   EdgeGeometry<NDIM>::toEdgeBox(q_data->getBox(), axis),
-                   q_data->getGhostCellWidth(),
-                   /*q_depth*/ 1,
-                   &Q_data_axis[0],
-                   /*Q_depth*/ 1,
-                   X_data,
-                   x_lower_axis.data(),
-                   x_upper_axis.data(),
-                   dx,
-                   patch_touches_lower_physical_bdry,
-                   patch_touches_upper_physical_bdry,
-                   local_indices,
-                   periodic_shifts,
-                   spread_fcn,
-                   axis);
-        }
-    }
+    spreadField(
+        q_data, Q_data, Q_depth, X_data, patch, local_indices, periodic_shifts, spread_fcn, s_use_weight_cache);
     return;
 }
 
@@ -4144,7 +4527,8 @@ LEInteractor::interpolate(double* const Q_data,
                           const std::vector<int>& local_indices,
                           const std::vector<double>& periodic_shifts,
                           const std::string& interp_fcn,
-                          const int axis)
+                          const int axis,
+                          const bool use_weight_cache)
 {
     const int stencil_size = getStencilSize(interp_fcn);
     const int min_ghosts = getMinimumGhostWidth(interp_fcn);
@@ -4158,10 +4542,178 @@ LEInteractor::interpolate(double* const Q_data,
                    << "  ghost cell width         = " << q_gcw_min << "\n");
     }
     if (local_indices.empty()) return;
-    const int local_indices_size = static_cast<int>(local_indices.size());
+    const int num_local_indices = static_cast<int>(local_indices.size());
+    const KernelType kernel = string_to_kernel(interp_fcn);
+    if (use_weight_cache && get_cached_stencil_size(kernel) > 0)
+    {
+        WeightCacheEntry& entry = get_weight_cache_entry(X_data, kernel, q_data_box, x_lower, dx);
+        std::vector<int> slots;
+        get_weight_cache_slots(slots, entry, local_indices, periodic_shifts);
+        const int num_threads = s_use_threaded_interpolation ? getNumThreads() : 1;
+        const int num_batches = std::min(num_local_indices, 4 * num_threads);
+#ifdef IBTK_HAVE_OPENMP
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+#endif
+        for (int batch = 0; batch < num_batches; ++batch)
+        {
+            const int batch_begin = static_cast<int>((static_cast<long>(batch) * num_local_indices) / num_batches);
+            const int batch_end = static_cast<int>((static_cast<long>(batch + 1) * num_local_indices) / num_batches);
+            update_cached_weights(entry,
+                                  &slots[batch_begin],
+                                  &local_indices[batch_begin],
+                                  batch_end - batch_begin,
+                                  X_data,
+                                  kernel,
+                                  q_data_box,
+                                  x_lower,
+                                  dx);
+            interpolate_cached(Q_data,
+                               q_data,
+                               q_data_box,
+                               q_gcw,
+                               q_depth,
+                               entry,
+                               &slots[batch_begin],
+                               &local_indices[batch_begin],
+                               batch_end - batch_begin);
+        }
+    }
+    else if (s_use_threaded_interpolation)
+    {
+        // Each point only reads the Eulerian data, so contiguous batches of
+        // points may be interpolated concurrently without synchronization.
+        const int num_threads = getNumThreads();
+        const int num_batches = std::min(num_local_indices, 4 * num_threads);
+#ifdef IBTK_HAVE_OPENMP
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+#endif
+        for (int batch = 0; batch < num_batches; ++batch)
+        {
+            // The Fortran kernels assign x_upper to itself to suppress
+            // compiler warnings, so each batch gets its own copy.
+            std::array<double, NDIM> x_upper_batch;
+            std::copy(x_upper, x_upper + NDIM, x_upper_batch.begin());
+            const int batch_begin = static_cast<int>((static_cast<long>(batch) * num_local_indices) / num_batches);
+            const int batch_end = static_cast<int>((static_cast<long>(batch + 1) * num_local_indices) / num_batches);
+            interpolateKernel(Q_data,
+                              Q_depth,
+                              X_data,
+                              q_data,
+                              q_data_box,
+                              q_gcw,
+                              q_depth,
+                              x_lower,
+                              x_upper_batch.data(),
+                              dx,
+                              &local_indices[batch_begin],
+                              &periodic_shifts[NDIM * batch_begin],
+                              batch_end - batch_begin,
+                              interp_fcn,
+                              axis);
+        }
+    }
+    else
+    {
+        interpolateKernel(Q_data,
+                          Q_depth,
+                          X_data,
+                          q_data,
+                          q_data_box,
+                          q_gcw,
+                          q_depth,
+                          x_lower,
+                          x_upper,
+                          dx,
+                          &local_indices[0],
+                          &periodic_shifts[0],
+                          num_local_indices,
+                          interp_fcn,
+                          axis);
+    }
+    return;
+}
+
+void
+LEInteractor::interpolateKernel(double* const Q_data,
+                                const int Q_depth,
+                                const double* const X_data,
+                                const double* const q_data,
+                                const Box<NDIM>& q_data_box,
+                                const IntVector<NDIM>& q_gcw,
+                                const int q_depth,
+                                const double* const x_lower,
+                                const double* const x_upper,
+                                const double* const dx,
+                                const int* const local_indices,
+                                const double* const periodic_shifts,
+                                const int num_local_indices,
+                                const std::string& interp_fcn,
+                                const int axis)
+{
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
-    switch (string_to_kernel(interp_fcn))
+    const KernelType kernel = string_to_kernel(interp_fcn);
+    if (s_use_templated_kernels)
+    {
+        std::array<int, NDIM> ilower_arr, iupper_arr, q_gcw_arr;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            ilower_arr[d] = ilower(d);
+            iupper_arr[d] = iupper(d);
+            q_gcw_arr[d] = q_gcw(d);
+        }
+        bool applied = false;
+        switch (q_depth)
+        {
+        case 1:
+            applied = interpolate_templated<1>(kernel,
+                                               Q_data,
+                                               X_data,
+                                               q_data,
+                                               q_depth,
+                                               ilower_arr.data(),
+                                               iupper_arr.data(),
+                                               q_gcw_arr.data(),
+                                               x_lower,
+                                               dx,
+                                               local_indices,
+                                               periodic_shifts,
+                                               num_local_indices);
+            break;
+        case NDIM:
+            applied = interpolate_templated<NDIM>(kernel,
+                                                  Q_data,
+                                                  X_data,
+                                                  q_data,
+                                                  q_depth,
+                                                  ilower_arr.data(),
+                                                  iupper_arr.data(),
+                                                  q_gcw_arr.data(),
+                                                  x_lower,
+                                                  dx,
+                                                  local_indices,
+                                                  periodic_shifts,
+                                                  num_local_indices);
+            break;
+        default:
+            applied = interpolate_templated<0>(kernel,
+                                               Q_data,
+                                               X_data,
+                                               q_data,
+                                               q_depth,
+                                               ilower_arr.data(),
+                                               iupper_arr.data(),
+                                               q_gcw_arr.data(),
+                                               x_lower,
+                                               dx,
+                                               local_indices,
+                                               periodic_shifts,
+                                               num_local_indices);
+            break;
+        }
+        if (applied) return;
+    }
+    switch (kernel)
     {
     case PIECEWISE_CONSTANT:
     {
@@ -4189,9 +4741,9 @@ LEInteractor::interpolate(double* const Q_data,
                                                 q_gcw(2),
 #endif
                                                 q_data,
-                                                &local_indices[0],
-                                                &periodic_shifts[0],
-                                                local_indices_size,
+                                                local_indices,
+                                                periodic_shifts,
+                                                num_local_indices,
                                                 X_data,
                                                 Q_data);
         break;
@@ -4223,9 +4775,9 @@ LEInteractor::interpolate(double* const Q_data,
                                                   q_gcw(2),
 #endif
                                                   q_data,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
-                                                  local_indices_size,
+                                                  local_indices,
+                                                  periodic_shifts,
+                                                  num_local_indices,
                                                   X_data,
                                                   Q_data);
         break;
@@ -4256,9 +4808,9 @@ LEInteractor::interpolate(double* const Q_data,
                                               q_gcw(2),
 #endif
                                               q_data,
-                                              &local_indices[0],
-                                              &periodic_shifts[0],
-                                              local_indices_size,
+                                              local_indices,
+                                              periodic_shifts,
+                                              num_local_indices,
                                               X_data,
                                               Q_data);
         break;
@@ -4289,9 +4841,9 @@ LEInteractor::interpolate(double* const Q_data,
                                              q_gcw(2),
 #endif
                                              q_data,
-                                             &local_indices[0],
-                                             &periodic_shifts[0],
-                                             local_indices_size,
+                                             local_indices,
+                                             periodic_shifts,
+                                             num_local_indices,
                                              X_data,
                                              Q_data);
         break;
@@ -4322,9 +4874,9 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data);
         break;
@@ -4355,9 +4907,9 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data);
         break;
@@ -4388,9 +4940,9 @@ LEInteractor::interpolate(double* const Q_data,
                                      q_gcw(2),
 #endif
                                      q_data,
-                                     &local_indices[0],
-                                     &periodic_shifts[0],
-                                     local_indices_size,
+                                     local_indices,
+                                     periodic_shifts,
+                                     num_local_indices,
                                      X_data,
                                      Q_data);
         break;
@@ -4421,9 +4973,9 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data);
         break;
@@ -4454,9 +5006,9 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data);
         break;
@@ -4487,9 +5039,9 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data);
         break;
@@ -4520,9 +5072,9 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data);
         break;
@@ -4553,9 +5105,9 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data);
         break;
@@ -4586,9 +5138,9 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data);
         break;
@@ -4620,9 +5172,9 @@ LEInteractor::interpolate(double* const Q_data,
                                                   q_gcw(2),
 #endif
                                                   q_data,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
-                                                  local_indices_size,
+                                                  local_indices,
+                                                  periodic_shifts,
+                                                  num_local_indices,
                                                   X_data,
                                                   Q_data);
         break;
@@ -4654,9 +5206,9 @@ LEInteractor::interpolate(double* const Q_data,
                                                   q_gcw(2),
 #endif
                                                   q_data,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
-                                                  local_indices_size,
+                                                  local_indices,
+                                                  periodic_shifts,
+                                                  num_local_indices,
                                                   X_data,
                                                   Q_data);
         break;
@@ -4688,9 +5240,9 @@ LEInteractor::interpolate(double* const Q_data,
                                                   q_gcw(2),
 #endif
                                                   q_data,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
-                                                  local_indices_size,
+                                                  local_indices,
+                                                  periodic_shifts,
+                                                  num_local_indices,
                                                   X_data,
                                                   Q_data);
         break;
@@ -4722,9 +5274,9 @@ LEInteractor::interpolate(double* const Q_data,
                                                   q_gcw(2),
 #endif
                                                   q_data,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
-                                                  local_indices_size,
+                                                  local_indices,
+                                                  periodic_shifts,
+                                                  num_local_indices,
                                                   X_data,
                                                   Q_data);
         break;
@@ -4741,9 +5293,9 @@ LEInteractor::interpolate(double* const Q_data,
                                x_lower,
                                x_upper,
                                dx,
-                               &local_indices[0],
-                               &periodic_shifts[0],
-                               local_indices_size);
+                               local_indices,
+                               periodic_shifts,
+                               num_local_indices);
         break;
     }
     case INVALID:
@@ -4770,7 +5322,8 @@ LEInteractor::spread(double* const q_data,
                      const std::vector<int>& local_indices,
                      const std::vector<double>& periodic_shifts,
                      const std::string& spread_fcn,
-                     const int axis)
+                     const int axis,
+                     const bool use_weight_cache)
 {
     const int stencil_size = getStencilSize(spread_fcn);
     const int min_ghosts = getMinimumGhostWidth(spread_fcn);
@@ -4790,10 +5343,201 @@ LEInteractor::spread(double* const q_data,
                    << "  ghost cell width         = " << q_gcw_min << "\n");
     }
     if (local_indices.empty()) return;
-    const int local_indices_size = static_cast<int>(local_indices.size());
+    const KernelType kernel = string_to_kernel(spread_fcn);
+    const bool use_cached_weights = use_weight_cache && get_cached_stencil_size(kernel) > 0;
+    WeightCacheEntry* const entry =
+        use_cached_weights ? &get_weight_cache_entry(X_data, kernel, q_data_box, x_lower, dx) : nullptr;
+    if (s_use_threaded_spreading)
+    {
+        // Sort the points into tiles which are wide enough that the kernel
+        // footprints of points in distinct tiles of the same color never
+        // overlap. All tiles of a given color may then be spread concurrently.
+        std::vector<int> tile_local_indices;
+        std::vector<double> tile_periodic_shifts;
+        std::vector<int> tile_offsets;
+        std::array<int, NUM_TILE_COLORS + 1> color_offsets;
+        sort_into_colored_tiles(tile_local_indices,
+                                tile_periodic_shifts,
+                                tile_offsets,
+                                color_offsets,
+                                local_indices,
+                                periodic_shifts,
+                                X_data,
+                                x_lower,
+                                dx,
+                                2 * min_ghosts);
+        std::vector<int> tile_slots;
+        if (use_cached_weights) get_weight_cache_slots(tile_slots, *entry, tile_local_indices, tile_periodic_shifts);
+#ifdef IBTK_HAVE_OPENMP
+        const int num_threads = getNumThreads();
+#endif
+        for (int color = 0; color < NUM_TILE_COLORS; ++color)
+        {
+#ifdef IBTK_HAVE_OPENMP
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+#endif
+            for (int tile = color_offsets[color]; tile < color_offsets[color + 1]; ++tile)
+            {
+                const int tile_begin = tile_offsets[tile];
+                const int tile_end = tile_offsets[tile + 1];
+                if (use_cached_weights)
+                {
+                    update_cached_weights(*entry,
+                                          &tile_slots[tile_begin],
+                                          &tile_local_indices[tile_begin],
+                                          tile_end - tile_begin,
+                                          X_data,
+                                          kernel,
+                                          q_data_box,
+                                          x_lower,
+                                          dx);
+                    spread_cached(q_data,
+                                  q_data_box,
+                                  q_gcw,
+                                  q_depth,
+                                  Q_data,
+                                  dx,
+                                  *entry,
+                                  &tile_slots[tile_begin],
+                                  &tile_local_indices[tile_begin],
+                                  tile_end - tile_begin);
+                    continue;
+                }
+
+                // The Fortran kernels assign x_upper to itself to suppress
+                // compiler warnings, so each tile gets its own copy.
+                std::array<double, NDIM> x_upper_tile;
+                std::copy(x_upper, x_upper + NDIM, x_upper_tile.begin());
+                spreadKernel(q_data,
+                             q_data_box,
+                             q_gcw,
+                             q_depth,
+                             Q_data,
+                             Q_depth,
+                             X_data,
+                             x_lower,
+                             x_upper_tile.data(),
+                             dx,
+                             &tile_local_indices[tile_begin],
+                             &tile_periodic_shifts[NDIM * tile_begin],
+                             tile_end - tile_begin,
+                             spread_fcn,
+                             axis);
+            }
+        }
+    }
+    else if (use_cached_weights)
+    {
+        const int num_local_indices = static_cast<int>(local_indices.size());
+        std::vector<int> slots;
+        get_weight_cache_slots(slots, *entry, local_indices, periodic_shifts);
+        update_cached_weights(
+            *entry, &slots[0], &local_indices[0], num_local_indices, X_data, kernel, q_data_box, x_lower, dx);
+        spread_cached(
+            q_data, q_data_box, q_gcw, q_depth, Q_data, dx, *entry, &slots[0], &local_indices[0], num_local_indices);
+    }
+    else
+    {
+        spreadKernel(q_data,
+                     q_data_box,
+                     q_gcw,
+                     q_depth,
+                     Q_data,
+                     Q_depth,
+                     X_data,
+                     x_lower,
+                     x_upper,
+                     dx,
+                     &local_indices[0],
+                     &periodic_shifts[0],
+                     static_cast<int>(local_indices.size()),
+                     spread_fcn,
+                     axis);
+    }
+    return;
+}
+
+void
+LEInteractor::spreadKernel(double* const q_data,
+                           const Box<NDIM>& q_data_box,
+                           const IntVector<NDIM>& q_gcw,
+                           const int q_depth,
+                           const double* const Q_data,
+                           const int Q_depth,
+                           const double* const X_data,
+                           const double* const x_lower,
+                           const double* const x_upper,
+                           const double* const dx,
+                           const int* const local_indices,
+                           const double* const periodic_shifts,
+                           const int num_local_indices,
+                           const std::string& spread_fcn,
+                           const int axis)
+{
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
-    switch (string_to_kernel(spread_fcn))
+    const KernelType kernel = string_to_kernel(spread_fcn);
+    if (s_use_templated_kernels)
+    {
+        std::array<int, NDIM> ilower_arr, iupper_arr, q_gcw_arr;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            ilower_arr[d] = ilower(d);
+            iupper_arr[d] = iupper(d);
+            q_gcw_arr[d] = q_gcw(d);
+        }
+        bool applied = false;
+        switch (q_depth)
+        {
+        case 1:
+            applied = spread_templated<1>(kernel,
+                                          q_data,
+                                          Q_data,
+                                          X_data,
+                                          q_depth,
+                                          ilower_arr.data(),
+                                          iupper_arr.data(),
+                                          q_gcw_arr.data(),
+                                          x_lower,
+                                          dx,
+                                          local_indices,
+                                          periodic_shifts,
+                                          num_local_indices);
+            break;
+        case NDIM:
+            applied = spread_templated<NDIM>(kernel,
+                                             q_data,
+                                             Q_data,
+                                             X_data,
+                                             q_depth,
+                                             ilower_arr.data(),
+                                             iupper_arr.data(),
+                                             q_gcw_arr.data(),
+                                             x_lower,
+                                             dx,
+                                             local_indices,
+                                             periodic_shifts,
+                                             num_local_indices);
+            break;
+        default:
+            applied = spread_templated<0>(kernel,
+                                          q_data,
+                                          Q_data,
+                                          X_data,
+                                          q_depth,
+                                          ilower_arr.data(),
+                                          iupper_arr.data(),
+                                          q_gcw_arr.data(),
+                                          x_lower,
+                                          dx,
+                                          local_indices,
+                                          periodic_shifts,
+                                          num_local_indices);
+            break;
+        }
+        if (applied) return;
+    }
+    switch (kernel)
     {
     case PIECEWISE_CONSTANT:
     {
@@ -4801,9 +5545,9 @@ LEInteractor::spread(double* const q_data,
                                                 x_lower,
                                                 x_upper,
                                                 q_depth,
-                                                &local_indices[0],
-                                                &periodic_shifts[0],
-                                                local_indices_size,
+                                                local_indices,
+                                                periodic_shifts,
+                                                num_local_indices,
                                                 X_data,
                                                 Q_data,
 #if (NDIM == 2)
@@ -4835,9 +5579,9 @@ LEInteractor::spread(double* const q_data,
                                                   x_upper,
                                                   q_depth,
                                                   axis,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
-                                                  local_indices_size,
+                                                  local_indices,
+                                                  periodic_shifts,
+                                                  num_local_indices,
                                                   X_data,
                                                   Q_data,
 #if (NDIM == 2)
@@ -4868,9 +5612,9 @@ LEInteractor::spread(double* const q_data,
                                               x_lower,
                                               x_upper,
                                               q_depth,
-                                              &local_indices[0],
-                                              &periodic_shifts[0],
-                                              local_indices_size,
+                                              local_indices,
+                                              periodic_shifts,
+                                              num_local_indices,
                                               X_data,
                                               Q_data,
 #if (NDIM == 2)
@@ -4901,9 +5645,9 @@ LEInteractor::spread(double* const q_data,
                                              x_lower,
                                              x_upper,
                                              q_depth,
-                                             &local_indices[0],
-                                             &periodic_shifts[0],
-                                             local_indices_size,
+                                             local_indices,
+                                             periodic_shifts,
+                                             num_local_indices,
                                              X_data,
                                              Q_data,
 #if (NDIM == 2)
@@ -4934,9 +5678,9 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -4967,9 +5711,9 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -5000,9 +5744,9 @@ LEInteractor::spread(double* const q_data,
                                      x_lower,
                                      x_upper,
                                      q_depth,
-                                     &local_indices[0],
-                                     &periodic_shifts[0],
-                                     local_indices_size,
+                                     local_indices,
+                                     periodic_shifts,
+                                     num_local_indices,
                                      X_data,
                                      Q_data,
 #if (NDIM == 2)
@@ -5033,9 +5777,9 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -5066,9 +5810,9 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -5099,9 +5843,9 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -5132,9 +5876,9 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -5165,9 +5909,9 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -5198,9 +5942,9 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -5232,9 +5976,9 @@ LEInteractor::spread(double* const q_data,
                                                   x_upper,
                                                   q_depth,
                                                   axis,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
-                                                  local_indices_size,
+                                                  local_indices,
+                                                  periodic_shifts,
+                                                  num_local_indices,
                                                   X_data,
                                                   Q_data,
 #if (NDIM == 2)
@@ -5266,9 +6010,9 @@ LEInteractor::spread(double* const q_data,
                                                   x_upper,
                                                   q_depth,
                                                   axis,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
-                                                  local_indices_size,
+                                                  local_indices,
+                                                  periodic_shifts,
+                                                  num_local_indices,
                                                   X_data,
                                                   Q_data,
 #if (NDIM == 2)
@@ -5301,9 +6045,9 @@ LEInteractor::spread(double* const q_data,
                                                   x_upper,
                                                   q_depth,
                                                   axis,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
-                                                  local_indices_size,
+                                                  local_indices,
+                                                  periodic_shifts,
+                                                  num_local_indices,
                                                   X_data,
                                                   Q_data,
 #if (NDIM == 2)
@@ -5336,9 +6080,9 @@ LEInteractor::spread(double* const q_data,
                                                   x_upper,
                                                   q_depth,
                                                   axis,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
-                                                  local_indices_size,
+                                                  local_indices,
+                                                  periodic_shifts,
+                                                  num_local_indices,
                                                   X_data,
                                                   Q_data,
 #if (NDIM == 2)
@@ -5376,9 +6120,9 @@ LEInteractor::spread(double* const q_data,
                           Q_data,
                           Q_depth,
                           X_data,
-                          &local_indices[0],
-                          &periodic_shifts[0],
-                          local_indices_size);
+                          local_indices,
+                          periodic_shifts,
+                          num_local_indices);
         break;
     }
     case INVALID:
@@ -5391,6 +6135,285 @@ LEInteractor::spread(double* const q_data,
     return;
 }
 
+void
+LEInteractor::interpolateField(double* const Q_data,
+                               const int Q_depth,
+                               const double* const X_data,
+                               const Pointer<PatchData<NDIM> > q_data,
+                               const Pointer<Patch<NDIM> > patch,
+                               const std::vector<int>& local_indices,
+                               const std::vector<double>& periodic_shifts,
+                               const std::string& interp_fcn,
+                               const bool use_weight_cache)
+{
+    const Pointer<CellData<NDIM, double> > q_cc_data = q_data;
+    const Pointer<NodeData<NDIM, double> > q_nc_data = q_data;
+    const Pointer<SideData<NDIM, double> > q_sc_data = q_data;
+    const Pointer<EdgeData<NDIM, double> > q_ec_data = q_data;
+    if (!q_cc_data && !q_nc_data && !q_sc_data && !q_ec_data)
+    {
+        TBOX_ERROR("LEInteractor::interpolate():\n"
+                   << "  unsupported data centering.\n");
+    }
+    if (q_sc_data && (Q_depth != NDIM || q_sc_data->getDepth() != 1))
+    {
+        TBOX_ERROR("LEInteractor::interpolate():\n"
+                   << "  side-centered interpolation requires vector-valued data.\n");
+    }
+    if (q_ec_data && (NDIM != 3 || Q_depth != NDIM || q_ec_data->getDepth() != 1))
+    {
+        TBOX_ERROR("LEInteractor::interpolate():\n"
+                   << "  edge-centered interpolation requires 3D vector-valued data.\n");
+    }
+    if (local_indices.empty()) return;
+
+    // Determine the patch geometry.
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const x_lower = pgeom->getXLower();
+    const double* const x_upper = pgeom->getXUpper();
+    const double* const dx = pgeom->getDx();
+    std::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
+    std::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        static const int lower = 0;
+        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
+        static const int upper = 1;
+        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
+    }
+
+    // Interpolate.
+    if (q_cc_data)
+    {
+        interpolate(Q_data,
+                    Q_depth,
+                    X_data,
+                    q_cc_data->getPointer(),
+                    q_cc_data->getBox(),
+                    q_cc_data->getGhostCellWidth(),
+                    q_cc_data->getDepth(),
+                    x_lower,
+                    x_upper,
+                    dx,
+                    patch_touches_lower_physical_bdry,
+                    patch_touches_upper_physical_bdry,
+                    local_indices,
+                    periodic_shifts,
+                    interp_fcn,
+                    /*axis*/ 0,
+                    use_weight_cache);
+    }
+    else if (q_nc_data)
+    {
+        std::array<double, NDIM> x_lower_node, x_upper_node;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            x_lower_node[d] = x_lower[d] - 0.5 * dx[d];
+            x_upper_node[d] = x_upper[d] + 0.5 * dx[d];
+        }
+        interpolate(Q_data,
+                    Q_depth,
+                    X_data,
+                    q_nc_data->getPointer(),
+                    NodeGeometry<NDIM>::toNodeBox(q_nc_data->getBox()),
+                    q_nc_data->getGhostCellWidth(),
+                    q_nc_data->getDepth(),
+                    x_lower_node.data(),
+                    x_upper_node.data(),
+                    dx,
+                    patch_touches_lower_physical_bdry,
+                    patch_touches_upper_physical_bdry,
+                    local_indices,
+                    periodic_shifts,
+                    interp_fcn,
+                    /*axis*/ 0,
+                    use_weight_cache);
+    }
+    else
+    {
+        // Side- and edge-centered data are interpolated one component at a
+        // time.
+        std::array<double, NDIM> x_lower_axis, x_upper_axis;
+        const int local_sz = (*std::max_element(local_indices.begin(), local_indices.end())) + 1;
+        std::vector<double> Q_data_axis(local_sz);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                x_lower_axis[d] = x_lower[d];
+                x_upper_axis[d] = x_upper[d];
+                if ((q_sc_data && d == axis) || (q_ec_data && d != axis))
+                {
+                    x_lower_axis[d] -= 0.5 * dx[d];
+                    x_upper_axis[d] += 0.5 * dx[d];
+                }
+            }
+            interpolate(&Q_data_axis[0],
+                        /*Q_depth*/ 1,
+                        X_data,
+                        q_sc_data ? q_sc_data->getPointer(axis) : q_ec_data->getPointer(axis),
+                        q_sc_data ? SideGeometry<NDIM>::toSideBox(q_sc_data->getBox(), axis) :
+                                    EdgeGeometry<NDIM>::toEdgeBox(q_ec_data->getBox(), axis),
+                        q_data->getGhostCellWidth(),
+                        /*q_depth*/ 1,
+                        x_lower_axis.data(),
+                        x_upper_axis.data(),
+                        dx,
+                        patch_touches_lower_physical_bdry,
+                        patch_touches_upper_physical_bdry,
+                        local_indices,
+                        periodic_shifts,
+                        interp_fcn,
+                        axis,
+                        use_weight_cache);
+            for (const auto& local_index : local_indices)
+            {
+                Q_data[NDIM * local_index + axis] = Q_data_axis[local_index];
+            }
+        }
+    }
+    return;
+}
+
+void
+LEInteractor::spreadField(Pointer<PatchData<NDIM> > q_data,
+                          const double* const Q_data,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const std::vector<int>& local_indices,
+                          const std::vector<double>& periodic_shifts,
+                          const std::string& spread_fcn,
+                          const bool use_weight_cache)
+{
+    const Pointer<CellData<NDIM, double> > q_cc_data = q_data;
+    const Pointer<NodeData<NDIM, double> > q_nc_data = q_data;
+    const Pointer<SideData<NDIM, double> > q_sc_data = q_data;
+    const Pointer<EdgeData<NDIM, double> > q_ec_data = q_data;
+    if (!q_cc_data && !q_nc_data && !q_sc_data && !q_ec_data)
+    {
+        TBOX_ERROR("LEInteractor::spread():\n"
+                   << "  unsupported data centering.\n");
+    }
+    if (q_sc_data && (Q_depth != NDIM || q_sc_data->getDepth() != 1))
+    {
+        TBOX_ERROR("LEInteractor::spread():\n"
+                   << "  side-centered spreading requires vector-valued data.\n");
+    }
+    if (q_ec_data && (NDIM != 3 || Q_depth != NDIM || q_ec_data->getDepth() != 1))
+    {
+        TBOX_ERROR("LEInteractor::spread():\n"
+                   << "  edge-centered interpolation requires 3D vector-valued data.\n");
+    }
+    if (local_indices.empty()) return;
+
+    // Determine the patch geometry.
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const x_lower = pgeom->getXLower();
+    const double* const x_upper = pgeom->getXUpper();
+    const double* const dx = pgeom->getDx();
+    std::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
+    std::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        static const int lower = 0;
+        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
+        static const int upper = 1;
+        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
+    }
+
+    // Spread.
+    if (q_cc_data)
+    {
+        spread(q_cc_data->getPointer(),
+               q_cc_data->getBox(),
+               q_cc_data->getGhostCellWidth(),
+               q_cc_data->getDepth(),
+               Q_data,
+               Q_depth,
+               X_data,
+               x_lower,
+               x_upper,
+               dx,
+               patch_touches_lower_physical_bdry,
+               patch_touches_upper_physical_bdry,
+               local_indices,
+               periodic_shifts,
+               spread_fcn,
+               /*axis*/ 0,
+               use_weight_cache);
+    }
+    else if (q_nc_data)
+    {
+        std::array<double, NDIM> x_lower_node, x_upper_node;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            x_lower_node[d] = x_lower[d] - 0.5 * dx[d];
+            x_upper_node[d] = x_upper[d] + 0.5 * dx[d];
+        }
+        spread(q_nc_data->getPointer(),
+               NodeGeometry<NDIM>::toNodeBox(q_nc_data->getBox()),
+               q_nc_data->getGhostCellWidth(),
+               q_nc_data->getDepth(),
+               Q_data,
+               Q_depth,
+               X_data,
+               x_lower_node.data(),
+               x_upper_node.data(),
+               dx,
+               patch_touches_lower_physical_bdry,
+               patch_touches_upper_physical_bdry,
+               local_indices,
+               periodic_shifts,
+               spread_fcn,
+               /*axis*/ 0,
+               use_weight_cache);
+    }
+    else
+    {
+        // Side- and edge-centered data are spread one component at a time.
+        std::array<double, NDIM> x_lower_axis, x_upper_axis;
+        const int local_sz = (*std::max_element(local_indices.begin(), local_indices.end())) + 1;
+        std::vector<double> Q_data_axis(local_sz);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                x_lower_axis[d] = x_lower[d];
+                x_upper_axis[d] = x_upper[d];
+                if ((q_sc_data && d == axis) || (q_ec_data && d != axis))
+                {
+                    x_lower_axis[d] -= 0.5 * dx[d];
+                    x_upper_axis[d] += 0.5 * dx[d];
+                }
+            }
+            for (const auto& local_index : local_indices)
+            {
+                Q_data_axis[local_index] = Q_data[NDIM * local_index + axis];
+            }
+            spread(q_sc_data ? q_sc_data->getPointer(axis) : q_ec_data->getPointer(axis),
+                   q_sc_data ? SideGeometry<NDIM>::toSideBox(q_sc_data->getBox(), axis) :
+                               EdgeGeometry<NDIM>::toEdgeBox(q_ec_data->getBox(), axis),
+                   q_data->getGhostCellWidth(),
+                   /*q_depth*/ 1,
+                   &Q_data_axis[0],
+                   /*Q_depth*/ 1,
+                   X_data,
+                   x_lower_axis.data(),
+                   x_upper_axis.data(),
+                   dx,
+                   patch_touches_lower_physical_bdry,
+                   patch_touches_upper_physical_bdry,
+                   local_indices,
+                   periodic_shifts,
+                   spread_fcn,
+                   axis,
+                   use_weight_cache);
+        }
+    }
+    return;
+}
+
 template <class T>
 void
 LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
@@ -5793,6 +6816,16 @@ template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_dat
                                               const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                               const std::string& interp_fcn);
 
+template void IBTK::LEInteractor::interpolate(
+    const std::vector<std::pair<SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> >, SAMRAI::tbox::Pointer<LData> > >&
+        q_Q_data,
+    const SAMRAI::tbox::Pointer<LData> X_data,
+    const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
+    const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+    const SAMRAI::hier::Box<NDIM>& interp_box,
+    const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+    const std::string& interp_fcn);
+
 template void IBTK::LEInteractor::interpolate(double* const Q_data,
                                               const int Q_depth,
                                               const double* const X_data,
@@ -5873,6 +6906,16 @@ template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::Edg
                                          const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                          const std::string& spread_fcn);
 
+template void IBTK::LEInteractor::spread(
+    const std::vector<std::pair<SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> >, SAMRAI::tbox::Pointer<LData> > >&
+        q_Q_data,
+    const SAMRAI::tbox::Pointer<LData> X_data,
+    const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
+    const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+    const SAMRAI::hier::Box<NDIM>& spread_box,
+    const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+    const std::string& spread_fcn);
+
 template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
                                          const double* const Q_data,
                                          const int Q_depth,
@@ -13,6 +13,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/IndexUtilities.h"
 #include "ibtk/LIndexSetData.h"
 #include "ibtk/LNode.h"
 #include "ibtk/LNodeIndex.h"
@@ -29,6 +30,8 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -51,7 +54,9 @@ LIndexSetData<T>::LIndexSetData(Box<NDIM> box, IntVector<NDIM> ghosts) : LSetDat
 
 template <class T>
 void
-LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector<NDIM>& periodic_shift)
+LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch,
+                                    const IntVector<NDIM>& periodic_shift,
+                                    const bool use_morton_ordering)
 {
     d_lag_indices.clear();
     d_interior_lag_indices.clear();
@@ -79,9 +84,26 @@ LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector
         patch_touches_upper_periodic_bdry[axis] = pgeom->getTouchesPeriodicBoundary(axis, 1);
     }
 
+    // Collect the index sets, optionally sorted along a Morton curve so that
+    // the cached indices of nearby cells are also nearby.
+    std::vector<std::tuple<std::uint64_t, CellIndex<NDIM>, const LSet<T>*> > idx_sets;
+    const hier::Index<NDIM>& ghost_lower = this->getGhostBox().lower();
     for (typename LSetData<T>::SetIterator it(*this); it; it++)
     {
         const CellIndex<NDIM>& i = it.getIndex();
+        const std::uint64_t key = use_morton_ordering ? IndexUtilities::getMortonIndex(i, ghost_lower) : 0;
+        idx_sets.emplace_back(key, i, &(*it));
+    }
+    if (use_morton_ordering)
+    {
+        std::stable_sort(idx_sets.begin(), idx_sets.end(), [](const auto& a, const auto& b) {
+            return std::get<0>(a) < std::get<0>(b);
+        });
+    }
+
+    for (const auto& key_idx_set : idx_sets)
+    {
+        const CellIndex<NDIM>& i = std::get<1>(key_idx_set);
         std::array<int, NDIM> offset;
         for (unsigned int d = 0; d < NDIM; ++d)
         {
@@ -99,7 +121,7 @@ LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector
                 offset[d] = 0;
             }
         }
-        const LSet<T>& idx_set = *it;
+        const LSet<T>& idx_set = *std::get<2>(key_idx_set);
         const bool patch_owns_idx_set = patch_box.contains(i);
         for (auto n = idx_set.begin(); n != idx_set.end(); ++n)
         {
@@ -20,6 +20,7 @@
 #include "ibtk/CartCellRobinPhysBdryOp.h"
 #include "ibtk/CellNoCornersFillPattern.h"
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
+#include "ibtk/ExtendedRobinBcCoefStrategy.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/LinearSolver.h"
@@ -30,9 +31,13 @@
 
 #include "ArrayData.h"
 #include "Box.h"
+#include "BoxArray.h"
+#include "BoxList.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
+#include "CellDataFactory.h"
+#include "CellVariable.h"
 #include "CoarsenOperator.h"
 #include "HierarchyCellDataOpsReal.h"
 #include "MultiblockDataTranslator.h"
@@ -42,8 +47,15 @@
 #include "PatchLevel.h"
 #include "PoissonSpecifications.h"
 #include "ProcessorMapping.h"
+#include "RefineAlgorithm.h"
+#include "RefineOperator.h"
+#include "RefineSchedule.h"
+#include "RobinBcCoefStrategy.h"
 #include "SideData.h"
+#include "SideDataFactory.h"
+#include "SideVariable.h"
 #include "Variable.h"
+#include "VariableContext.h"
 #include "VariableDatabase.h"
 #include "VariableFillPattern.h"
 #include "tbox/Array.h"
@@ -55,6 +67,7 @@
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -74,6 +87,14 @@
 #define SMOOTH_GS_RB_CONST_D_VAR_C_FC IBTK_FC_FUNC_(smooth_gs_rb_const_d_var_c_2d, SMOOTH_GS_rb_CONST_D_VAR_C_2D)
 #define SMOOTH_GS_VAR_DC_FC IBTK_FC_FUNC_(smooth_gs_var_dc_2d, SMOOTH_GS_VAR_DC_2D)
 #define SMOOTH_GS_RB_VAR_DC_FC IBTK_FC_FUNC_(smooth_gs_rb_var_dc_2d, SMOOTH_GS_RB_VAR_DC_2D)
+#define SMOOTH_GS_VAR_D_CONST_C_SP_FC IBTK_FC_FUNC_(smooth_gs_var_d_const_c_sp_2d, SMOOTH_GS_VAR_D_CONST_C_SP_2D)
+#define SMOOTH_GS_RB_VAR_D_CONST_C_SP_FC                                                                               \
+    IBTK_FC_FUNC_(smooth_gs_rb_var_d_const_c_sp_2d, SMOOTH_GS_RB_VAR_D_CONST_C_SP_2D)
+#define SMOOTH_GS_CONST_D_VAR_C_SP_FC IBTK_FC_FUNC_(smooth_gs_const_d_var_c_sp_2d, SMOOTH_GS_CONST_D_VAR_C_SP_2D)
+#define SMOOTH_GS_RB_CONST_D_VAR_C_SP_FC                                                                               \
+    IBTK_FC_FUNC_(smooth_gs_rb_const_d_var_c_sp_2d, SMOOTH_GS_RB_CONST_D_VAR_C_SP_2D)
+#define SMOOTH_GS_VAR_DC_SP_FC IBTK_FC_FUNC_(smooth_gs_var_dc_sp_2d, SMOOTH_GS_VAR_DC_SP_2D)
+#define SMOOTH_GS_RB_VAR_DC_SP_FC IBTK_FC_FUNC_(smooth_gs_rb_var_dc_sp_2d, SMOOTH_GS_RB_VAR_DC_SP_2D)
 #endif
 #if (NDIM == 3)
 #define SMOOTH_GS_CONST_DC_FC IBTK_FC_FUNC_(smooth_gs_const_dc_3d, SMOOTH_GS_CONST_DC_3D)
@@ -84,6 +105,14 @@
 #define SMOOTH_GS_RB_CONST_D_VAR_C_FC IBTK_FC_FUNC_(smooth_gs_rb_const_d_var_c_3d, SMOOTH_GS_rb_CONST_D_VAR_C_3D)
 #define SMOOTH_GS_VAR_DC_FC IBTK_FC_FUNC_(smooth_gs_var_dc_3d, SMOOTH_GS_VAR_DC_3D)
 #define SMOOTH_GS_RB_VAR_DC_FC IBTK_FC_FUNC_(smooth_gs_rb_var_dc_3d, SMOOTH_GS_RB_VAR_DC_3D)
+#define SMOOTH_GS_VAR_D_CONST_C_SP_FC IBTK_FC_FUNC_(smooth_gs_var_d_const_c_sp_3d, SMOOTH_GS_VAR_D_CONST_C_SP_3D)
+#define SMOOTH_GS_RB_VAR_D_CONST_C_SP_FC                                                                               \
+    IBTK_FC_FUNC_(smooth_gs_rb_var_d_const_c_sp_3d, SMOOTH_GS_RB_VAR_D_CONST_C_SP_3D)
+#define SMOOTH_GS_CONST_D_VAR_C_SP_FC IBTK_FC_FUNC_(smooth_gs_const_d_var_c_sp_3d, SMOOTH_GS_CONST_D_VAR_C_SP_3D)
+#define SMOOTH_GS_RB_CONST_D_VAR_C_SP_FC                                                                               \
+    IBTK_FC_FUNC_(smooth_gs_rb_const_d_var_c_sp_3d, SMOOTH_GS_RB_CONST_D_VAR_C_SP_3D)
+#define SMOOTH_GS_VAR_DC_SP_FC IBTK_FC_FUNC_(smooth_gs_var_dc_sp_3d, SMOOTH_GS_VAR_DC_SP_3D)
+#define SMOOTH_GS_RB_VAR_DC_SP_FC IBTK_FC_FUNC_(smooth_gs_rb_var_dc_sp_3d, SMOOTH_GS_RB_VAR_DC_SP_3D)
 #endif
 
 // Function interfaces
@@ -244,6 +273,129 @@ extern "C"
 #endif
                                 const double* dx,
                                 const int& red_or_black);
+
+    void SMOOTH_GS_VAR_D_CONST_C_SP_FC(double* U,
+                                       const int& U_gcw,
+                                       const float* D0,
+                                       const float* D1,
+#if (NDIM == 3)
+                                       const float* D2,
+#endif
+                                       const int& D_gcw,
+                                       const double& C,
+                                       const double* F,
+                                       const int& F_gcw,
+                                       const int& ilower0,
+                                       const int& iupper0,
+                                       const int& ilower1,
+                                       const int& iupper1,
+#if (NDIM == 3)
+                                       const int& ilower2,
+                                       const int& iupper2,
+#endif
+                                       const double* dx);
+
+    void SMOOTH_GS_RB_VAR_D_CONST_C_SP_FC(double* U,
+                                          const int& U_gcw,
+                                          const float* D0,
+                                          const float* D1,
+#if (NDIM == 3)
+                                          const float* D2,
+#endif
+                                          const int& D_gcw,
+                                          const double& C,
+                                          const double* F,
+                                          const int& F_gcw,
+                                          const int& ilower0,
+                                          const int& iupper0,
+                                          const int& ilower1,
+                                          const int& iupper1,
+#if (NDIM == 3)
+                                          const int& ilower2,
+                                          const int& iupper2,
+#endif
+                                          const double* dx,
+                                          const int& red_or_black);
+
+    void SMOOTH_GS_CONST_D_VAR_C_SP_FC(double* U,
+                                       const int& U_gcw,
+                                       const double& D,
+                                       const float* C,
+                                       const int& C_gcw,
+                                       const double* F,
+                                       const int& F_gcw,
+                                       const int& ilower0,
+                                       const int& iupper0,
+                                       const int& ilower1,
+                                       const int& iupper1,
+#if (NDIM == 3)
+                                       const int& ilower2,
+                                       const int& iupper2,
+#endif
+                                       const double* dx);
+
+    void SMOOTH_GS_RB_CONST_D_VAR_C_SP_FC(double* U,
+                                          const int& U_gcw,
+                                          const double& D,
+                                          const float* C,
+                                          const int& C_gcw,
+                                          const double* F,
+                                          const int& F_gcw,
+                                          const int& ilower0,
+                                          const int& iupper0,
+                                          const int& ilower1,
+                                          const int& iupper1,
+#if (NDIM == 3)
+                                          const int& ilower2,
+                                          const int& iupper2,
+#endif
+                                          const double* dx,
+                                          const int& red_or_black);
+
+    void SMOOTH_GS_VAR_DC_SP_FC(double* U,
+                                const int& U_gcw,
+                                const float* D0,
+                                const float* D1,
+#if (NDIM == 3)
+                                const float* D2,
+#endif
+                                const int& D_gcw,
+                                const float* C,
+                                const int& C_gcw,
+                                const double* F,
+                                const int& F_gcw,
+                                const int& ilower0,
+                                const int& iupper0,
+                                const int& ilower1,
+                                const int& iupper1,
+#if (NDIM == 3)
+                                const int& ilower2,
+                                const int& iupper2,
+#endif
+                                const double* dx);
+
+    void SMOOTH_GS_RB_VAR_DC_SP_FC(double* U,
+                                   const int& U_gcw,
+                                   const float* D0,
+                                   const float* D1,
+#if (NDIM == 3)
+                                   const float* D2,
+#endif
+                                   const int& D_gcw,
+                                   const float* C,
+                                   const int& C_gcw,
+                                   const double* F,
+                                   const int& F_gcw,
+                                   const int& ilower0,
+                                   const int& iupper0,
+                                   const int& ilower1,
+                                   const int& iupper1,
+#if (NDIM == 3)
+                                   const int& ilower2,
+                                   const int& iupper2,
+#endif
+                                   const double* dx,
+                                   const int& red_or_black);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -311,6 +463,37 @@ use_red_black_ordering(SmootherType smoother_type)
     }
 } // use_red_black_ordering
 
+// Copy double precision array data into single precision array data.
+inline void
+copy_to_single_precision(const ArrayData<NDIM, double>& src_data, ArrayData<NDIM, float>& dst_data)
+{
+    const Box<NDIM> box = src_data.getBox() * dst_data.getBox();
+    for (int depth = 0; depth < dst_data.getDepth(); ++depth)
+    {
+        for (Box<NDIM>::Iterator b(box); b; b++)
+        {
+            dst_data(b(), depth) = static_cast<float>(src_data(b(), depth));
+        }
+    }
+    return;
+} // copy_to_single_precision
+
+// Register a variable and context pair, replacing any previous registration of
+// a variable with the same name.
+int
+register_variable_and_context(Pointer<Variable<NDIM> > var,
+                              Pointer<VariableContext> context,
+                              const IntVector<NDIM>& ghosts)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    if (var_db->checkVariableExists(var->getName()))
+    {
+        var = var_db->getVariable(var->getName());
+        var_db->removePatchDataIndex(var_db->mapVariableAndContextToIndex(var, context));
+    }
+    return var_db->registerVariableAndContext(var, context, ghosts);
+} // register_variable_and_context
+
 inline bool
 do_local_data_update(SmootherType smoother_type)
 {
@@ -364,6 +547,10 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
             d_coarse_solver_max_iterations = input_db->getInteger("coarse_solver_max_iterations");
         if (input_db->keyExists("coarse_solver_prefix"))
             d_coarse_solver_default_options_prefix = input_db->getString("coarse_solver_prefix");
+        if (input_db->keyExists("use_single_precision_coefficients"))
+            d_use_single_precision_coefficients = input_db->getBool("use_single_precision_coefficients");
+        if (input_db->keyExists("num_sweeps_per_ghost_fill"))
+            d_num_sweeps_per_ghost_fill = input_db->getInteger("num_sweeps_per_ghost_fill");
         if (input_db->isDatabase("coarse_solver_db"))
         {
             d_coarse_solver_db = input_db->getDatabase("coarse_solver_db");
@@ -391,6 +578,16 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
     // Configure the coarse level solver.
     setCoarseSolverType(d_coarse_solver_type);
 
+    // Setup variables for single precision copies of the coefficients.
+    d_C_sp_idx = register_variable_and_context(
+        new CellVariable<NDIM, float>(d_object_name + "::C_sp", DEFAULT_DATA_DEPTH), d_context, IntVector<NDIM>(0));
+    d_D_sp_idx = register_variable_and_context(
+        new SideVariable<NDIM, float>(d_object_name + "::D_sp", DEFAULT_DATA_DEPTH), d_context, IntVector<NDIM>(0));
+
+    // Setup variables for the copies of the error and residual with wide ghost
+    // cell layers.
+    setNumSweepsPerGhostFill(d_num_sweeps_per_ghost_fill);
+
     // Setup Timers.
     IBTK_DO_ONCE(t_smooth_error =
                      TimerManager::getManager()->getTimer("IBTK::CCPoissonPointRelaxationFACOperator::smoothError()");
@@ -437,6 +634,54 @@ CCPoissonPointRelaxationFACOperator::setCoarseSolverType(const std::string& coar
     return;
 } // setCoarseSolverType
 
+void
+CCPoissonPointRelaxationFACOperator::setUseSinglePrecisionCoefficients(const bool use_single_precision_coefficients)
+{
+    if (d_is_initialized)
+    {
+        TBOX_ERROR(d_object_name << "::setUseSinglePrecisionCoefficients():\n"
+                                 << "  cannot be called while operator state is initialized" << std::endl);
+    }
+    d_use_single_precision_coefficients = use_single_precision_coefficients;
+    return;
+} // setUseSinglePrecisionCoefficients
+
+void
+CCPoissonPointRelaxationFACOperator::setNumSweepsPerGhostFill(const int num_sweeps_per_ghost_fill)
+{
+    if (d_is_initialized)
+    {
+        TBOX_ERROR(d_object_name << "::setNumSweepsPerGhostFill():\n"
+                                 << "  cannot be called while operator state is initialized" << std::endl);
+    }
+    if (num_sweeps_per_ghost_fill < 1)
+    {
+        TBOX_ERROR(d_object_name << "::setNumSweepsPerGhostFill():\n"
+                                 << "  number of sweeps per ghost cell fill must be positive" << std::endl);
+    }
+    d_num_sweeps_per_ghost_fill = num_sweeps_per_ghost_fill;
+    const IntVector<NDIM> wide_gcw(d_num_sweeps_per_ghost_fill);
+    d_error_wide_idx = register_variable_and_context(
+        new CellVariable<NDIM, double>(d_object_name + "::error_wide", DEFAULT_DATA_DEPTH), d_context, wide_gcw);
+    d_residual_wide_idx = register_variable_and_context(
+        new CellVariable<NDIM, double>(d_object_name + "::residual_wide", DEFAULT_DATA_DEPTH), d_context, wide_gcw);
+    return;
+} // setNumSweepsPerGhostFill
+
+void
+CCPoissonPointRelaxationFACOperator::setPoissonSpecifications(const PoissonSpecifications& poisson_spec)
+{
+    PoissonFACPreconditionerStrategy::setPoissonSpecifications(poisson_spec);
+
+    // The coefficients may have changed, so refresh their single precision
+    // copies.
+    if (d_is_initialized && d_use_single_precision_coefficients)
+    {
+        copyCoefficientsToSinglePrecision(d_coarsest_ln, d_finest_ln);
+    }
+    return;
+} // setPoissonSpecifications
+
 void
 CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>& error,
                                                  const SAMRAIVectorReal<NDIM, double>& residual,
@@ -450,7 +695,6 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     IBTK_TIMER_START(t_smooth_error);
 
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
-    const int error_idx = error.getComponentDescriptorIndex(0);
     const int scratch_idx = d_scratch_idx;
 
     // Determine the smoother type.
@@ -462,14 +706,35 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
 
+    // When several sweeps are performed per ghost cell fill, the smoother acts
+    // on copies of the error and residual with wide ghost cell layers. This is
+    // only done with red-black ordering (see below); a point relaxation coarse
+    // level solver with a different ordering fills ghost cells for each sweep.
+    const int sweeps_per_ghost_fill = d_num_sweeps_per_ghost_fill;
+    const bool use_wide_ghosts = sweeps_per_ghost_fill > 1 && red_black_ordering;
+    const int error_idx = use_wide_ghosts ? d_error_wide_idx : error.getComponentDescriptorIndex(0);
+    const int residual_idx = use_wide_ghosts ? d_residual_wide_idx : residual.getComponentDescriptorIndex(0);
+    if (use_wide_ghosts)
+    {
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            patch->getPatchData(error_idx)->copy(*error.getComponentPatchData(0, *patch));
+            patch->getPatchData(residual_idx)->copy(*residual.getComponentPatchData(0, *patch));
+        }
+    }
+
     // Cache coarse-fine interface ghost cell values in the "scratch" data.
-    if (level_num > d_coarsest_ln && num_sweeps > 1)
+    //
+    // NOTE: With wide ghost cell layers, the cached values are instead updated
+    // after each ghost cell fill.
+    if (level_num > d_coarsest_ln && num_sweeps > 1 && !use_wide_ghosts)
     {
         int patch_counter = 0;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            Pointer<CellData<NDIM, double> > error_data = patch->getPatchData(error_idx);
             Pointer<CellData<NDIM, double> > scratch_data = patch->getPatchData(scratch_idx);
 #if !defined(NDEBUG)
             const Box<NDIM>& ghost_box = error_data->getGhostBox();
@@ -486,34 +751,80 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     if (red_black_ordering) num_sweeps *= 2;
     for (int isweep = 0; isweep < num_sweeps; ++isweep)
     {
+        // With wide ghost cell layers, ghost cell values are filled once for
+        // each group of sweeps. Within a group, patches that are away from
+        // physical and coarse-fine boundaries also smooth a shrinking layer of
+        // their ghost cells. With red-black ordering, the update of a cell
+        // depends only on values of the other color from the previous
+        // (half-)sweep, so these patches compute exactly the ghost cell values
+        // that the neighboring patches compute for their interiors. (This is
+        // not true for lexicographic orderings, in which the result depends on
+        // the order in which each patch visits the cells.)
+        const int group_sweep = use_wide_ghosts ? isweep % sweeps_per_ghost_fill : 0;
+        const bool fill_ghosts = use_wide_ghosts ? group_sweep == 0 : isweep > 0;
+        const int num_redundant_cells =
+            use_wide_ghosts ? std::min(sweeps_per_ghost_fill - 1 - group_sweep, num_sweeps - 1 - isweep) : 0;
+
         // Re-fill ghost cell data as needed.
-        if (level_num > d_coarsest_ln)
+        if (level_num > d_coarsest_ln && isweep > 0)
         {
-            if (isweep > 0)
+            // Copy the coarse-fine interface ghost cell values which are cached
+            // in the scratch data into the error data.
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                // Patches that smooth their ghost cells do not have coarse-fine
+                // interface ghost cells, and their ghost cell values must be
+                // kept between ghost cell fills.
+                if (!fill_ghosts && d_patch_smooths_ghost_cells[level_num][patch_counter]) continue;
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > error_data = patch->getPatchData(error_idx);
+                Pointer<CellData<NDIM, double> > scratch_data = patch->getPatchData(scratch_idx);
+#if !defined(NDEBUG)
+                TBOX_ASSERT(error_data->getGhostCellWidth() >= d_gcw);
+                TBOX_ASSERT(scratch_data->getGhostCellWidth() == d_gcw);
+#endif
+                error_data->getArrayData().copy(scratch_data->getArrayData(),
+                                                d_patch_bc_box_overlap[level_num][patch_counter],
+                                                IntVector<NDIM>(0));
+            }
+        }
+        if (fill_ghosts && use_wide_ghosts)
+        {
+            // Fill the non-coarse-fine interface ghost cell values. The first
+            // fill also sets the ghost cell values of the residual.
+            xeqScheduleWideGhostFill(level_num, isweep == 0);
+
+            // Cache the ghost cell values used by the remaining sweeps of the
+            // group; the coarse-fine interface ghost cell values are not
+            // modified by the ghost cell fill.
+            if (level_num > d_coarsest_ln && isweep + 1 < num_sweeps)
             {
-                // Copy the coarse-fine interface ghost cell values which are
-                // cached in the scratch data into the error data.
                 int patch_counter = 0;
                 for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
                 {
                     Pointer<Patch<NDIM> > patch = level->getPatch(p());
-                    Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+                    Pointer<CellData<NDIM, double> > error_data = patch->getPatchData(error_idx);
                     Pointer<CellData<NDIM, double> > scratch_data = patch->getPatchData(scratch_idx);
-#if !defined(NDEBUG)
-                    const Box<NDIM>& ghost_box = error_data->getGhostBox();
-                    TBOX_ASSERT(ghost_box == scratch_data->getGhostBox());
-                    TBOX_ASSERT(error_data->getGhostCellWidth() == d_gcw);
-                    TBOX_ASSERT(scratch_data->getGhostCellWidth() == d_gcw);
-#endif
-                    error_data->getArrayData().copy(scratch_data->getArrayData(),
-                                                    d_patch_bc_box_overlap[level_num][patch_counter],
-                                                    IntVector<NDIM>(0));
+                    scratch_data->getArrayData().copy(error_data->getArrayData(),
+                                                      d_patch_bc_box_overlap[level_num][patch_counter],
+                                                      IntVector<NDIM>(0));
                 }
-
-                // Fill the non-coarse-fine interface ghost cell values.
-                xeqScheduleGhostFillNoCoarse(error_idx, level_num);
             }
-
+        }
+        else if (fill_ghosts)
+        {
+            // Fill the non-coarse-fine interface ghost cell values.
+            xeqScheduleGhostFillNoCoarse(error_idx, level_num);
+        }
+        else if (isweep > 0)
+        {
+            // Within a group of sweeps, only the physical boundary ghost cell
+            // values are updated, which does not require communication.
+            setWidePhysicalBoundaryConditions(level_num);
+        }
+        if (level_num > d_coarsest_ln)
+        {
             // Complete the coarse-fine interface interpolation by computing the
             // normal extension.
             d_cf_bdry_op->setPatchDataIndex(error_idx);
@@ -525,29 +836,35 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                 d_cf_bdry_op->computeNormalExtension(*patch, ratio, ghost_width_to_fill);
             }
         }
-        else if (isweep > 0)
-        {
-            xeqScheduleGhostFillNoCoarse(error_idx, level_num);
-        }
 
         // Smooth the error on the patches.
         int patch_counter = 0;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
-            Pointer<CellData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
+            Pointer<CellData<NDIM, double> > error_data = patch->getPatchData(error_idx);
+            Pointer<CellData<NDIM, double> > residual_data = patch->getPatchData(residual_idx);
 #if !defined(NDEBUG)
+            const IntVector<NDIM> gcw = use_wide_ghosts ? IntVector<NDIM>(sweeps_per_ghost_fill) : d_gcw;
             const Box<NDIM>& ghost_box = error_data->getGhostBox();
             TBOX_ASSERT(ghost_box == residual_data->getGhostBox());
-            TBOX_ASSERT(error_data->getGhostCellWidth() == d_gcw);
-            TBOX_ASSERT(residual_data->getGhostCellWidth() == d_gcw);
+            TBOX_ASSERT(error_data->getGhostCellWidth() == gcw);
+            TBOX_ASSERT(residual_data->getGhostCellWidth() == gcw);
             TBOX_ASSERT(error_data->getDepth() == residual_data->getDepth());
 #endif
             const Box<NDIM>& patch_box = patch->getBox();
             const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
             const double* const dx = pgeom->getDx();
 
+            // Determine the number of ghost cell layers that are smoothed along
+            // with the patch interior. This is only done for constant
+            // coefficient problems.
+            const int num_smoothed_ghosts =
+                (num_redundant_cells > 0 && d_patch_smooths_ghost_cells[level_num][patch_counter]) ?
+                    num_redundant_cells :
+                    0;
+            const Box<NDIM> smooth_box = Box<NDIM>::grow(patch_box, IntVector<NDIM>(num_smoothed_ghosts));
+
             // Copy updated values from neighboring local patches.
             if (update_local_data)
             {
@@ -557,7 +874,7 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                     const int src_patch_num = pair.first;
                     const Box<NDIM>& overlap = pair.second;
                     Pointer<Patch<NDIM> > src_patch = level->getPatch(src_patch_num);
-                    Pointer<CellData<NDIM, double> > src_error_data = error.getComponentPatchData(0, *src_patch);
+                    Pointer<CellData<NDIM, double> > src_error_data = src_patch->getPatchData(error_idx);
                     error_data->getArrayData().copy(src_error_data->getArrayData(), overlap, IntVector<NDIM>(0));
                 }
             }
@@ -595,6 +912,17 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
 #endif
             }
 
+            // Use the single precision copies of the variable coefficients when
+            // requested.
+            Pointer<SideData<NDIM, float> > D_sp_data = nullptr;
+            Pointer<CellData<NDIM, float> > C_sp_data = nullptr;
+            const bool use_sp_coefs = d_use_single_precision_coefficients && (!D_is_constant || C_is_var);
+            if (use_sp_coefs)
+            {
+                if (!D_is_constant) D_sp_data = patch->getPatchData(d_D_sp_idx);
+                if (C_is_var) C_sp_data = patch->getPatchData(d_C_sp_idx);
+            }
+
             for (int depth = 0; depth < error_data->getDepth(); ++depth)
             {
                 double* const U = error_data->getPointer(depth);
@@ -607,18 +935,18 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                     {
                         int red_or_black = isweep % 2; // "red" = 0, "black" = 1
                         SMOOTH_GS_RB_CONST_DC_FC(U,
-                                                 U_ghosts,
+                                                 U_ghosts - num_smoothed_ghosts,
                                                  D,
                                                  C,
                                                  F,
-                                                 F_ghosts,
-                                                 patch_box.lower(0),
-                                                 patch_box.upper(0),
-                                                 patch_box.lower(1),
-                                                 patch_box.upper(1),
+                                                 F_ghosts - num_smoothed_ghosts,
+                                                 smooth_box.lower(0),
+                                                 smooth_box.upper(0),
+                                                 smooth_box.lower(1),
+                                                 smooth_box.upper(1),
 #if (NDIM == 3)
-                                                 patch_box.lower(2),
-                                                 patch_box.upper(2),
+                                                 smooth_box.lower(2),
+                                                 smooth_box.upper(2),
 #endif
                                                  dx,
                                                  red_or_black);
@@ -626,22 +954,181 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                     else
                     {
                         SMOOTH_GS_CONST_DC_FC(U,
-                                              U_ghosts,
+                                              U_ghosts - num_smoothed_ghosts,
                                               D,
                                               C,
                                               F,
-                                              F_ghosts,
-                                              patch_box.lower(0),
-                                              patch_box.upper(0),
-                                              patch_box.lower(1),
-                                              patch_box.upper(1),
+                                              F_ghosts - num_smoothed_ghosts,
+                                              smooth_box.lower(0),
+                                              smooth_box.upper(0),
+                                              smooth_box.lower(1),
+                                              smooth_box.upper(1),
 #if (NDIM == 3)
-                                              patch_box.lower(2),
-                                              patch_box.upper(2),
+                                              smooth_box.lower(2),
+                                              smooth_box.upper(2),
 #endif
                                               dx);
                     }
                 }
+                else if (use_sp_coefs && !D_is_constant && !C_is_var)
+                {
+                    const float* const D0 = D_sp_data->getPointer(0, depth);
+                    const float* const D1 = D_sp_data->getPointer(1, depth);
+#if (NDIM == 3)
+                    const float* const D2 = D_sp_data->getPointer(2, depth);
+#endif
+                    const int D_ghosts = (D_sp_data->getGhostCellWidth()).max();
+                    if (red_black_ordering)
+                    {
+                        int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                        SMOOTH_GS_RB_VAR_D_CONST_C_SP_FC(U,
+                                                         U_ghosts,
+                                                         D0,
+                                                         D1,
+#if (NDIM == 3)
+                                                         D2,
+#endif
+                                                         D_ghosts,
+                                                         C,
+                                                         F,
+                                                         F_ghosts,
+                                                         patch_box.lower(0),
+                                                         patch_box.upper(0),
+                                                         patch_box.lower(1),
+                                                         patch_box.upper(1),
+#if (NDIM == 3)
+                                                         patch_box.lower(2),
+                                                         patch_box.upper(2),
+#endif
+                                                         dx,
+                                                         red_or_black);
+                    }
+                    else
+                    {
+                        SMOOTH_GS_VAR_D_CONST_C_SP_FC(U,
+                                                      U_ghosts,
+                                                      D0,
+                                                      D1,
+#if (NDIM == 3)
+                                                      D2,
+#endif
+                                                      D_ghosts,
+                                                      C,
+                                                      F,
+                                                      F_ghosts,
+                                                      patch_box.lower(0),
+                                                      patch_box.upper(0),
+                                                      patch_box.lower(1),
+                                                      patch_box.upper(1),
+#if (NDIM == 3)
+                                                      patch_box.lower(2),
+                                                      patch_box.upper(2),
+#endif
+                                                      dx);
+                    }
+                }
+                else if (use_sp_coefs && D_is_constant && C_is_var)
+                {
+                    if (red_black_ordering)
+                    {
+                        int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                        SMOOTH_GS_RB_CONST_D_VAR_C_SP_FC(U,
+                                                         U_ghosts,
+                                                         D,
+                                                         C_sp_data->getPointer(),
+                                                         C_sp_data->getGhostCellWidth().max(),
+                                                         F,
+                                                         F_ghosts,
+                                                         patch_box.lower(0),
+                                                         patch_box.upper(0),
+                                                         patch_box.lower(1),
+                                                         patch_box.upper(1),
+#if (NDIM == 3)
+                                                         patch_box.lower(2),
+                                                         patch_box.upper(2),
+#endif
+                                                         dx,
+                                                         red_or_black);
+                    }
+                    else
+                    {
+                        SMOOTH_GS_CONST_D_VAR_C_SP_FC(U,
+                                                      U_ghosts,
+                                                      D,
+                                                      C_sp_data->getPointer(),
+                                                      C_sp_data->getGhostCellWidth().max(),
+                                                      F,
+                                                      F_ghosts,
+                                                      patch_box.lower(0),
+                                                      patch_box.upper(0),
+                                                      patch_box.lower(1),
+                                                      patch_box.upper(1),
+#if (NDIM == 3)
+                                                      patch_box.lower(2),
+                                                      patch_box.upper(2),
+#endif
+                                                      dx);
+                    }
+                }
+                else if (use_sp_coefs && !D_is_constant && C_is_var)
+                {
+                    const float* const D0 = D_sp_data->getPointer(0, depth);
+                    const float* const D1 = D_sp_data->getPointer(1, depth);
+#if (NDIM == 3)
+                    const float* const D2 = D_sp_data->getPointer(2, depth);
+#endif
+                    const int D_ghosts = (D_sp_data->getGhostCellWidth()).max();
+                    if (red_black_ordering)
+                    {
+                        int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                        SMOOTH_GS_RB_VAR_DC_SP_FC(U,
+                                                  U_ghosts,
+                                                  D0,
+                                                  D1,
+#if (NDIM == 3)
+                                                  D2,
+#endif
+                                                  D_ghosts,
+                                                  C_sp_data->getPointer(),
+                                                  C_sp_data->getGhostCellWidth().max(),
+                                                  F,
+                                                  F_ghosts,
+                                                  patch_box.lower(0),
+                                                  patch_box.upper(0),
+                                                  patch_box.lower(1),
+                                                  patch_box.upper(1),
+#if (NDIM == 3)
+                                                  patch_box.lower(2),
+                                                  patch_box.upper(2),
+#endif
+                                                  dx,
+                                                  red_or_black);
+                    }
+                    else
+                    {
+                        SMOOTH_GS_VAR_DC_SP_FC(U,
+                                               U_ghosts,
+                                               D0,
+                                               D1,
+#if (NDIM == 3)
+                                               D2,
+#endif
+                                               D_ghosts,
+                                               C_sp_data->getPointer(),
+                                               C_sp_data->getGhostCellWidth().max(),
+                                               F,
+                                               F_ghosts,
+                                               patch_box.lower(0),
+                                               patch_box.upper(0),
+                                               patch_box.lower(1),
+                                               patch_box.upper(1),
+#if (NDIM == 3)
+                                               patch_box.lower(2),
+                                               patch_box.upper(2),
+#endif
+                                               dx);
+                    }
+                }
                 else if (!D_is_constant && !C_is_var)
                 {
                     const double* const D0 = D_data->getPointer(0, depth);
@@ -804,6 +1291,16 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             }
         }
     }
+
+    // Copy the smoothed error out of the data with wide ghost cell layers.
+    if (use_wide_ghosts)
+    {
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            error.getComponentPatchData(0, *patch)->copy(*patch->getPatchData(error_idx));
+        }
+    }
     IBTK_TIMER_STOP(t_smooth_error);
     return;
 } // smoothError
@@ -942,6 +1439,12 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
         var_db->getPatchDescriptor()->getPatchDataFactory(d_scratch_idx);
     scratch_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
 
+    // Make single precision copies of the variable coefficients.
+    if (d_use_single_precision_coefficients)
+    {
+        copyCoefficientsToSinglePrecision(std::max(d_coarsest_ln, coarsest_reset_ln), finest_reset_ln);
+    }
+
     // Initialize the coarse level solvers when needed.
     if (coarsest_reset_ln == d_coarsest_ln && d_coarse_solver)
     {
@@ -1016,19 +1519,132 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
             }
         }
     }
+
+    // Setup data and communication schedules for smoothing with wide ghost
+    // cell layers.
+    if (d_num_sweeps_per_ghost_fill > 1)
+    {
+        if (!use_red_black_ordering(get_smoother_type(d_smoother_type)))
+        {
+            TBOX_ERROR(d_object_name << "::initializeOperatorState():\n"
+                                     << "  num_sweeps_per_ghost_fill > 1 requires smoother_type = "
+                                        "\"RED_BLACK_GAUSS_SEIDEL\""
+                                     << std::endl);
+        }
+        const IntVector<NDIM> wide_gcw(d_num_sweeps_per_ghost_fill);
+        Pointer<CellDataFactory<NDIM, double> > error_wide_pdat_fac =
+            var_db->getPatchDescriptor()->getPatchDataFactory(d_error_wide_idx);
+        error_wide_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
+        Pointer<CellDataFactory<NDIM, double> > residual_wide_pdat_fac =
+            var_db->getPatchDescriptor()->getPatchDataFactory(d_residual_wide_idx);
+        residual_wide_pdat_fac->setDefaultDepth(rhs_pdat_fac->getDefaultDepth());
+
+        d_wide_ghostfill_refine_algorithm = new RefineAlgorithm<NDIM>();
+        d_wide_ghostfill_refine_algorithm->registerRefine(
+            d_error_wide_idx, d_error_wide_idx, d_error_wide_idx, Pointer<RefineOperator<NDIM> >());
+        d_wide_ghostfill_refine_algorithm->registerRefine(
+            d_residual_wide_idx, d_residual_wide_idx, d_residual_wide_idx, Pointer<RefineOperator<NDIM> >());
+        d_wide_error_ghostfill_refine_algorithm = new RefineAlgorithm<NDIM>();
+        d_wide_error_ghostfill_refine_algorithm->registerRefine(
+            d_error_wide_idx, d_error_wide_idx, d_error_wide_idx, Pointer<RefineOperator<NDIM> >());
+
+        d_wide_ghostfill_refine_schedules.resize(d_finest_ln + 1);
+        d_wide_error_ghostfill_refine_schedules.resize(d_finest_ln + 1);
+        d_patch_smooths_ghost_cells.resize(d_finest_ln + 1);
+        const bool const_coefs = d_poisson_spec.dIsConstant() && !d_poisson_spec.cIsVariable();
+        if (!const_coefs)
+        {
+            TBOX_WARNING(d_object_name << "::initializeOperatorState():\n"
+                                       << "  num_sweeps_per_ghost_fill > 1 with variable coefficients: patches do not "
+                                          "smooth their ghost cells,\n"
+                                       << "  so sweeps after the first use stale values from neighboring patches and "
+                                          "the smoother differs from\n"
+                                       << "  the one obtained with num_sweeps_per_ghost_fill = 1" << std::endl);
+        }
+        for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            if (!level->checkAllocated(d_error_wide_idx)) level->allocatePatchData(d_error_wide_idx);
+            if (!level->checkAllocated(d_residual_wide_idx)) level->allocatePatchData(d_residual_wide_idx);
+            d_wide_ghostfill_refine_schedules[ln] =
+                d_wide_ghostfill_refine_algorithm->createSchedule(level, d_bc_op.getPointer());
+            d_wide_error_ghostfill_refine_schedules[ln] =
+                d_wide_error_ghostfill_refine_algorithm->createSchedule(level, d_bc_op.getPointer());
+
+            // Patches whose wide ghost cell layers are covered by the level
+            // or its periodic images smooth their ghost cells along with their
+            // interiors. The red-black coloring of a periodic image agrees
+            // with that of the cells it copies only if the level has an even
+            // number of cells in each periodic direction.
+            Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+            const IntVector<NDIM> periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+            bool use_periodic_images = true;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                use_periodic_images = use_periodic_images && periodic_shift(d) % 2 == 0;
+            }
+            const BoxArray<NDIM>& boxes = level->getBoxes();
+            BoxList<NDIM> level_boxes(boxes);
+            int num_offsets = 1;
+            for (unsigned int d = 0; d < NDIM; ++d) num_offsets *= 3;
+            for (int n = 0; n < num_offsets && use_periodic_images; ++n)
+            {
+                IntVector<NDIM> periodic_offset = 0;
+                bool is_image = false, is_duplicate = false;
+                for (unsigned int d = 0, m = n; d < NDIM; ++d, m /= 3)
+                {
+                    const int sgn = static_cast<int>(m % 3) - 1;
+                    periodic_offset(d) = sgn * periodic_shift(d);
+                    is_image = is_image || periodic_offset(d) != 0;
+                    is_duplicate = is_duplicate || (sgn != 0 && periodic_shift(d) == 0);
+                }
+                if (!is_image || is_duplicate) continue;
+                for (int i = 0; i < boxes.getNumberOfBoxes(); ++i)
+                {
+                    level_boxes.appendItem(Box<NDIM>::shift(boxes[i], periodic_offset));
+                }
+            }
+            const int num_local_patches = level->getProcessorMapping().getLocalIndices().getSize();
+            d_patch_smooths_ghost_cells[ln].resize(num_local_patches);
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                BoxList<NDIM> uncovered_boxes(Box<NDIM>::grow(patch->getBox(), wide_gcw));
+                uncovered_boxes.removeIntersections(level_boxes);
+                d_patch_smooths_ghost_cells[ln][patch_counter] = const_coefs && uncovered_boxes.isEmpty();
+            }
+        }
+    }
     return;
 } // initializeOperatorStateSpecialized
 
 void
-CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int /*coarsest_reset_ln*/,
-                                                                        const int /*finest_reset_ln*/)
+CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int coarsest_reset_ln,
+                                                                        const int finest_reset_ln)
 {
     if (!d_is_initialized) return;
 
+    for (int ln = coarsest_reset_ln;
+         ln <= std::min({ d_finest_ln, finest_reset_ln, d_hierarchy->getFinestLevelNumber() });
+         ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_C_sp_idx)) level->deallocatePatchData(d_C_sp_idx);
+        if (level->checkAllocated(d_D_sp_idx)) level->deallocatePatchData(d_D_sp_idx);
+        if (level->checkAllocated(d_error_wide_idx)) level->deallocatePatchData(d_error_wide_idx);
+        if (level->checkAllocated(d_residual_wide_idx)) level->deallocatePatchData(d_residual_wide_idx);
+    }
+
     if (!d_in_initialize_operator_state)
     {
         d_patch_bc_box_overlap.clear();
         d_patch_neighbor_overlap.clear();
+        d_patch_smooths_ghost_cells.clear();
+        d_wide_ghostfill_refine_algorithm.setNull();
+        d_wide_ghostfill_refine_schedules.resize(0);
+        d_wide_error_ghostfill_refine_algorithm.setNull();
+        d_wide_error_ghostfill_refine_schedules.resize(0);
         if (d_coarse_solver) d_coarse_solver->deallocateSolverState();
     }
     return;
@@ -1036,6 +1652,128 @@ CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const in
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+CCPoissonPointRelaxationFACOperator::xeqScheduleWideGhostFill(const int dst_ln, const bool fill_residual)
+{
+    d_bc_op->setPatchDataIndex(d_error_wide_idx);
+    d_bc_op->setPhysicalBcCoefs(d_bc_coefs);
+    d_bc_op->setHomogeneousBc(true);
+    for (const auto& bc_coef : d_bc_coefs)
+    {
+        auto extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
+        if (extended_bc_coef)
+        {
+            extended_bc_coef->setTargetPatchDataIndex(d_error_wide_idx);
+            extended_bc_coef->setHomogeneousBc(true);
+        }
+    }
+    if (fill_residual)
+    {
+        d_wide_ghostfill_refine_schedules[dst_ln]->fillData(d_solution_time);
+    }
+    else
+    {
+        d_wide_error_ghostfill_refine_schedules[dst_ln]->fillData(d_solution_time);
+    }
+    for (const auto& bc_coef : d_bc_coefs)
+    {
+        auto extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
+        if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+    }
+    return;
+} // xeqScheduleWideGhostFill
+
+void
+CCPoissonPointRelaxationFACOperator::setWidePhysicalBoundaryConditions(const int dst_ln)
+{
+    d_bc_op->setPatchDataIndex(d_error_wide_idx);
+    d_bc_op->setPhysicalBcCoefs(d_bc_coefs);
+    d_bc_op->setHomogeneousBc(true);
+    for (const auto& bc_coef : d_bc_coefs)
+    {
+        auto extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
+        if (extended_bc_coef)
+        {
+            extended_bc_coef->setTargetPatchDataIndex(d_error_wide_idx);
+            extended_bc_coef->setHomogeneousBc(true);
+        }
+    }
+    const IntVector<NDIM> ghost_width_to_fill(d_num_sweeps_per_ghost_fill);
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(dst_ln);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        if (patch->getPatchGeometry()->getTouchesRegularBoundary())
+        {
+            d_bc_op->setPhysicalBoundaryConditions(*patch, d_solution_time, ghost_width_to_fill);
+        }
+    }
+    for (const auto& bc_coef : d_bc_coefs)
+    {
+        auto extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
+        if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+    }
+    return;
+} // setWidePhysicalBoundaryConditions
+
+void
+CCPoissonPointRelaxationFACOperator::copyCoefficientsToSinglePrecision(const int coarsest_ln, const int finest_ln)
+{
+    const bool C_is_var = d_poisson_spec.cIsVariable();
+    const bool D_is_var = !d_poisson_spec.dIsConstant();
+    const int C_idx = C_is_var ? d_poisson_spec.getCPatchDataId() : IBTK::invalid_index;
+    const int D_idx = D_is_var ? d_poisson_spec.getDPatchDataId() : IBTK::invalid_index;
+
+    // The depths of the coefficients may differ from those of the previous
+    // copies, in which case the copies are reallocated.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    bool reallocate_C_sp = false, reallocate_D_sp = false;
+    if (C_is_var)
+    {
+        Pointer<CellDataFactory<NDIM, double> > C_pdat_fac = var_db->getPatchDescriptor()->getPatchDataFactory(C_idx);
+        Pointer<CellDataFactory<NDIM, float> > C_sp_pdat_fac =
+            var_db->getPatchDescriptor()->getPatchDataFactory(d_C_sp_idx);
+        reallocate_C_sp = C_sp_pdat_fac->getDefaultDepth() != C_pdat_fac->getDefaultDepth();
+        C_sp_pdat_fac->setDefaultDepth(C_pdat_fac->getDefaultDepth());
+    }
+    if (D_is_var)
+    {
+        Pointer<SideDataFactory<NDIM, double> > D_pdat_fac = var_db->getPatchDescriptor()->getPatchDataFactory(D_idx);
+        Pointer<SideDataFactory<NDIM, float> > D_sp_pdat_fac =
+            var_db->getPatchDescriptor()->getPatchDataFactory(d_D_sp_idx);
+        reallocate_D_sp = D_sp_pdat_fac->getDefaultDepth() != D_pdat_fac->getDefaultDepth();
+        D_sp_pdat_fac->setDefaultDepth(D_pdat_fac->getDefaultDepth());
+    }
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (reallocate_C_sp && level->checkAllocated(d_C_sp_idx)) level->deallocatePatchData(d_C_sp_idx);
+        if (reallocate_D_sp && level->checkAllocated(d_D_sp_idx)) level->deallocatePatchData(d_D_sp_idx);
+        if (C_is_var && !level->checkAllocated(d_C_sp_idx)) level->allocatePatchData(d_C_sp_idx);
+        if (D_is_var && !level->checkAllocated(d_D_sp_idx)) level->allocatePatchData(d_D_sp_idx);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            if (C_is_var)
+            {
+                Pointer<CellData<NDIM, double> > C_data = patch->getPatchData(C_idx);
+                Pointer<CellData<NDIM, float> > C_sp_data = patch->getPatchData(d_C_sp_idx);
+                copy_to_single_precision(C_data->getArrayData(), C_sp_data->getArrayData());
+            }
+            if (D_is_var)
+            {
+                Pointer<SideData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+                Pointer<SideData<NDIM, float> > D_sp_data = patch->getPatchData(d_D_sp_idx);
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    copy_to_single_precision(D_data->getArrayData(axis), D_sp_data->getArrayData(axis));
+                }
+            }
+        }
+    }
+    return;
+} // copyCoefficientsToSinglePrecision
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -22,6 +22,7 @@
 #include "ibtk/PETScMatLOWrapper.h"
 #include "ibtk/PETScPCLSWrapper.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
+#include "ibtk/SAMRAIFischerGuess.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/solver_utilities.h"
 
@@ -44,7 +45,9 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <array>
 #include <cstring>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -64,6 +67,18 @@ namespace
 static Timer* t_solve_system;
 static Timer* t_initialize_solver_state;
 static Timer* t_deallocate_solver_state;
+
+// Pipelined PETSc Krylov methods, which overlap their global reductions with
+// the operator and preconditioner applications by using split-phase
+// reductions (e.g., VecDotBegin() and VecDotEnd()).
+bool
+is_pipelined_ksp_type(const std::string& ksp_type)
+{
+    static const std::array<const char*, 10> pipelined_ksp_types = { "pipecg",   "pipecr",   "pipelcg", "pipecgrr",
+                                                                     "pipeprcg", "pipebcgs", "pgmres",  "pipefgmres",
+                                                                     "pipegcr",  "groppcg" };
+    return std::find(pipelined_ksp_types.begin(), pipelined_ksp_types.end(), ksp_type) != pipelined_ksp_types.end();
+} // is_pipelined_ksp_type
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -94,6 +109,8 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(std::string object_name,
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+        const int num_fischer_vectors = input_db->getIntegerWithDefault("num_fischer_vectors", 0);
+        if (num_fischer_vectors > 0) d_fischer_guess = std::make_unique<SAMRAIFischerGuess>(num_fischer_vectors);
     }
 
     // Common constructor functionality.
@@ -155,6 +172,7 @@ void
 PETScKrylovLinearSolver::setOperator(Pointer<LinearOperator> A)
 {
     KrylovLinearSolver::setOperator(A);
+    if (d_fischer_guess) d_fischer_guess->clear();
     d_user_provided_mat = true;
     resetKSPOperators();
     return;
@@ -205,8 +223,34 @@ PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVe
     d_A->setHomogeneousBc(true);
     PETScSAMRAIVectorReal::replaceSAMRAIVector(d_petsc_x, Pointer<SAMRAIVectorReal<NDIM, double> >(&x, false));
     PETScSAMRAIVectorReal::replaceSAMRAIVector(d_petsc_b, d_b);
+    // Initial guesses provided by the caller are left alone.
+    const bool use_fischer_guess = d_fischer_guess && !d_initial_guess_nonzero && d_fischer_guess->guess(x, *d_b);
+    if (use_fischer_guess)
+    {
+        ierr = KSPSetInitialGuessNonzero(d_petsc_ksp, PETSC_TRUE);
+        IBTK_CHKERRQ(ierr);
+    }
     ierr = KSPSolve(d_petsc_ksp, d_petsc_b, d_petsc_x);
     IBTK_CHKERRQ(ierr);
+
+    // Restore the user's choice of initial guess, since the KSP settings are
+    // read back into the member state variables when the solver is
+    // (re)initialized.
+    if (use_fischer_guess)
+    {
+        ierr = KSPSetInitialGuessNonzero(d_petsc_ksp, d_initial_guess_nonzero ? PETSC_TRUE : PETSC_FALSE);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    // Store the solution of the homogeneous problem for use in computing
+    // future initial guesses.
+    if (d_fischer_guess)
+    {
+        KSPConvergedReason reason;
+        ierr = KSPGetConvergedReason(d_petsc_ksp, &reason);
+        IBTK_CHKERRQ(ierr);
+        if (static_cast<int>(reason) > 0) d_fischer_guess->submit(x, *d_b);
+    }
     d_A->setHomogeneousBc(d_homogeneous_bc);
     d_A->imposeSolBcs(x);
 
@@ -391,6 +435,9 @@ PETScKrylovLinearSolver::deallocateSolverState()
     // Deallocate the nullspace object.
     deallocateNullSpaceData();
 
+    // Discard vectors stored for computing initial guesses.
+    if (d_fischer_guess) d_fischer_guess->clear();
+
     // Destroy the KSP solver.
     if (d_managing_petsc_ksp)
     {
@@ -502,7 +549,10 @@ PETScKrylovLinearSolver::resetKSPOptions()
     ierr = KSPSetType(d_petsc_ksp, ksp_type);
     IBTK_CHKERRQ(ierr);
     std::string ksp_type_name(ksp_type);
-    if (ksp_type_name.find("gmres") != std::string::npos)
+    // Iterative refinement of the orthogonalization requires additional
+    // blocking reductions, which would defeat the purpose of the pipelined
+    // GMRES variants.
+    if (ksp_type_name.find("gmres") != std::string::npos && !is_pipelined_ksp_type(ksp_type_name))
     {
         ierr = KSPGMRESSetCGSRefinementType(d_petsc_ksp, KSP_GMRES_CGS_REFINE_IFNEEDED);
         IBTK_CHKERRQ(ierr);
@@ -0,0 +1,423 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/CCPoissonPointRelaxationFACOperator.h"
+#include "ibtk/GeneralSolver.h"
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/PoissonFACPreconditioner.h"
+#include "ibtk/PoissonMultigridLevelSolver.h"
+#include "ibtk/SCPoissonPointRelaxationFACOperator.h"
+#include "ibtk/ibtk_utilities.h"
+
+#include "Box.h"
+#include "BoxArray.h"
+#include "CartesianGridGeometry.h"
+#include "CellVariable.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchData.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "PoissonSpecifications.h"
+#include "ProcessorMapping.h"
+#include "SAMRAIVectorReal.h"
+#include "SideVariable.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+
+#include <algorithm>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Timers.
+static Timer* t_solve_system;
+static Timer* t_initialize_solver_state;
+static Timer* t_deallocate_solver_state;
+
+// Total number of cells in a collection of boxes.
+inline int
+number_of_cells(const BoxArray<NDIM>& boxes)
+{
+    int n_cells = 0;
+    for (int i = 0; i < boxes.getNumberOfBoxes(); ++i) n_cells += boxes[i].size();
+    return n_cells;
+} // number_of_cells
+
+// Whether every box can be coarsened exactly by the given ratio.
+inline bool
+is_coarsenable(const BoxArray<NDIM>& boxes, const int ratio)
+{
+    for (int i = 0; i < boxes.getNumberOfBoxes(); ++i)
+    {
+        for (int d = 0; d < NDIM; ++d)
+        {
+            if (boxes[i].lower(d) % ratio != 0 || (boxes[i].upper(d) + 1) % ratio != 0) return false;
+        }
+    }
+    return true;
+} // is_coarsenable
+
+// Chop boxes into pieces with at most max_size cells in each direction.
+BoxArray<NDIM>
+chop_boxes(const BoxArray<NDIM>& boxes, const int max_size)
+{
+    std::vector<Box<NDIM> > chopped_boxes;
+    for (int i = 0; i < boxes.getNumberOfBoxes(); ++i)
+    {
+        std::vector<Box<NDIM> > pieces(1, boxes[i]);
+        for (int d = 0; d < NDIM; ++d)
+        {
+            std::vector<Box<NDIM> > new_pieces;
+            for (const Box<NDIM>& piece : pieces)
+            {
+                for (int lower = piece.lower(d); lower <= piece.upper(d); lower += max_size)
+                {
+                    Box<NDIM> new_piece = piece;
+                    new_piece.lower(d) = lower;
+                    new_piece.upper(d) = std::min(lower + max_size - 1, piece.upper(d));
+                    new_pieces.push_back(new_piece);
+                }
+            }
+            pieces.swap(new_pieces);
+        }
+        chopped_boxes.insert(chopped_boxes.end(), pieces.begin(), pieces.end());
+    }
+    BoxArray<NDIM> result(static_cast<int>(chopped_boxes.size()));
+    for (unsigned int i = 0; i < chopped_boxes.size(); ++i) result[i] = chopped_boxes[i];
+    return result;
+} // chop_boxes
+
+// Assign boxes to the first n_procs processes so that each process owns a
+// contiguous range of boxes with approximately the same number of cells.
+ProcessorMapping
+agglomerate_boxes(const BoxArray<NDIM>& boxes, const int n_procs)
+{
+    const int n_boxes = boxes.getNumberOfBoxes();
+    const double n_cells = static_cast<double>(number_of_cells(boxes));
+    ProcessorMapping mapping(n_boxes);
+    double n_preceding_cells = 0.0;
+    for (int i = 0; i < n_boxes; ++i)
+    {
+        const double midpoint = n_preceding_cells + 0.5 * boxes[i].size();
+        const int proc = std::min(static_cast<int>(n_procs * midpoint / n_cells), n_procs - 1);
+        mapping.setProcessorAssignment(i, proc);
+        n_preceding_cells += boxes[i].size();
+    }
+    return mapping;
+} // agglomerate_boxes
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+PoissonMultigridLevelSolver::PoissonMultigridLevelSolver(const std::string& object_name,
+                                                         Pointer<Database> input_db,
+                                                         const std::string& default_options_prefix)
+    : d_default_options_prefix(default_options_prefix)
+{
+    // Setup default options.
+    GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
+    d_initial_guess_nonzero = false;
+    d_rel_residual_tol = 1.0e-5;
+    d_abs_residual_tol = 1.0e-50;
+    d_max_iterations = 1;
+
+    // Get values from the input database.
+    if (input_db)
+    {
+        if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+        if (input_db->keyExists("max_coarse_levels")) d_max_coarse_levels = input_db->getInteger("max_coarse_levels");
+        if (input_db->keyExists("coarsest_level_max_cells"))
+            d_coarsest_level_max_cells = input_db->getInteger("coarsest_level_max_cells");
+        if (input_db->keyExists("cells_per_processor"))
+            d_cells_per_processor = input_db->getInteger("cells_per_processor");
+        if (input_db->keyExists("coarse_patch_size")) d_coarse_patch_size = input_db->getInteger("coarse_patch_size");
+        if (input_db->isDatabase("fac_db")) d_fac_db = input_db->getDatabase("fac_db");
+    }
+    if (d_max_coarse_levels < 0 || d_coarsest_level_max_cells < 1 || d_cells_per_processor < 1 ||
+        d_coarse_patch_size < 1)
+    {
+        TBOX_ERROR(d_object_name << "::PoissonMultigridLevelSolver()\n"
+                                 << "  invalid input parameters" << std::endl);
+    }
+
+    // Setup Timers.
+    IBTK_DO_ONCE(t_solve_system =
+                     TimerManager::getManager()->getTimer("IBTK::PoissonMultigridLevelSolver::solveSystem()");
+                 t_initialize_solver_state =
+                     TimerManager::getManager()->getTimer("IBTK::PoissonMultigridLevelSolver::initializeSolverState()");
+                 t_deallocate_solver_state = TimerManager::getManager()->getTimer(
+                     "IBTK::PoissonMultigridLevelSolver::deallocateSolverState()"););
+    return;
+} // PoissonMultigridLevelSolver
+
+PoissonMultigridLevelSolver::~PoissonMultigridLevelSolver()
+{
+    if (d_is_initialized) deallocateSolverState();
+    return;
+} // ~PoissonMultigridLevelSolver
+
+bool
+PoissonMultigridLevelSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBTK_TIMER_START(t_solve_system);
+
+    // Initialize the solver, when necessary.
+    const bool deallocate_after_solve = !d_is_initialized;
+    if (deallocate_after_solve) initializeSolverState(x, b);
+
+    // Copy the right-hand side to the finest level of the multigrid hierarchy.
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_level_num);
+    Pointer<PatchLevel<NDIM> > mg_level = d_mg_hierarchy->getPatchLevel(d_mg_finest_ln);
+    copyVectorData(b, level, *d_mg_b, mg_level);
+
+    // Apply a multigrid cycle.
+    d_fac_pc->setHomogeneousBc(d_homogeneous_bc);
+    d_fac_pc->setSolutionTime(d_solution_time);
+    d_fac_pc->setTimeInterval(d_current_time, d_new_time);
+    const bool converged = d_fac_pc->solveSystem(*d_mg_x, *d_mg_b);
+    d_current_iterations = d_fac_pc->getNumIterations();
+    d_current_residual_norm = d_fac_pc->getResidualNorm();
+
+    // Copy the solution back to the solver level.
+    copyVectorData(*d_mg_x, mg_level, x, level);
+
+    // Log solver info.
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::solveSystem(): applied a multigrid cycle with " << d_mg_finest_ln
+             << " additional coarse levels\n";
+    }
+
+    // Deallocate the solver, when necessary.
+    if (deallocate_after_solve) deallocateSolverState();
+
+    IBTK_TIMER_STOP(t_solve_system);
+    return converged;
+} // solveSystem
+
+void
+PoissonMultigridLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
+                                                   const SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBTK_TIMER_START(t_initialize_solver_state);
+
+    // Rudimentary error checking.
+    if (x.getPatchHierarchy() != b.getPatchHierarchy())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same hierarchy" << std::endl);
+    }
+    if (x.getCoarsestLevelNumber() != 0 || x.getFinestLevelNumber() != 0 || b.getCoarsestLevelNumber() != 0 ||
+        b.getFinestLevelNumber() != 0)
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must be defined only on level 0 of the patch hierarchy" << std::endl);
+    }
+    if (x.getNumberOfComponents() != 1 || b.getNumberOfComponents() != 1)
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have exactly one component" << std::endl);
+    }
+    if (!d_poisson_spec.cIsConstant() && !d_poisson_spec.cIsZero())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  only constant coefficient problems are supported" << std::endl);
+    }
+    if (!d_poisson_spec.dIsConstant())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  only constant coefficient problems are supported" << std::endl);
+    }
+
+    // Deallocate the solver state if the solver is already initialized.
+    if (d_is_initialized) deallocateSolverState();
+
+    // Get the hierarchy information.
+    d_hierarchy = x.getPatchHierarchy();
+    d_level_num = x.getCoarsestLevelNumber();
+
+    // Setup the multigrid hierarchy and the vectors defined on it.
+    buildMultigridHierarchy();
+    d_mg_x = new SAMRAIVectorReal<NDIM, double>(d_object_name + "::mg_x", d_mg_hierarchy, 0, d_mg_finest_ln);
+    d_mg_x->addComponent(x.getComponentVariable(0), x.getComponentDescriptorIndex(0));
+    d_mg_b = new SAMRAIVectorReal<NDIM, double>(d_object_name + "::mg_b", d_mg_hierarchy, 0, d_mg_finest_ln);
+    d_mg_b->addComponent(b.getComponentVariable(0), b.getComponentDescriptorIndex(0));
+    d_mg_x->allocateVectorData();
+    d_mg_b->allocateVectorData();
+
+    // Setup the FAC preconditioner.
+    if (!d_fac_pc)
+    {
+        Pointer<CellVariable<NDIM, double> > x_cc_var = x.getComponentVariable(0);
+        Pointer<SideVariable<NDIM, double> > x_sc_var = x.getComponentVariable(0);
+        Pointer<PoissonSolver> fac_pc;
+        if (x_cc_var)
+        {
+            fac_pc = CCPoissonPointRelaxationFACOperator::allocate_solver(
+                d_object_name + "::fac_pc", d_fac_db, d_default_options_prefix + "mg_");
+        }
+        else if (x_sc_var)
+        {
+            fac_pc = SCPoissonPointRelaxationFACOperator::allocate_solver(
+                d_object_name + "::fac_pc", d_fac_db, d_default_options_prefix + "mg_");
+        }
+        else
+        {
+            TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                     << "  unsupported variable type: only cell-centered and side-centered data are "
+                                        "supported"
+                                     << std::endl);
+        }
+        d_fac_pc = fac_pc;
+    }
+    d_fac_pc->setPoissonSpecifications(d_poisson_spec);
+    d_fac_pc->setPhysicalBcCoefs(d_bc_coefs);
+    d_fac_pc->setHomogeneousBc(d_homogeneous_bc);
+    d_fac_pc->setSolutionTime(d_solution_time);
+    d_fac_pc->setTimeInterval(d_current_time, d_new_time);
+    d_fac_pc->initializeSolverState(*d_mg_x, *d_mg_b);
+
+    // Indicate that the solver is initialized.
+    d_is_initialized = true;
+
+    IBTK_TIMER_STOP(t_initialize_solver_state);
+    return;
+} // initializeSolverState
+
+void
+PoissonMultigridLevelSolver::deallocateSolverState()
+{
+    if (!d_is_initialized) return;
+
+    IBTK_TIMER_START(t_deallocate_solver_state);
+
+    // Deallocate the FAC preconditioner and the multigrid hierarchy.
+    d_fac_pc->deallocateSolverState();
+    d_mg_x->deallocateVectorData();
+    d_mg_x.setNull();
+    d_mg_b->deallocateVectorData();
+    d_mg_b.setNull();
+    d_mg_hierarchy.setNull();
+    d_mg_finest_ln = IBTK::invalid_level_number;
+    d_hierarchy.setNull();
+    d_level_num = IBTK::invalid_level_number;
+
+    // Indicate that the solver is NOT initialized.
+    d_is_initialized = false;
+
+    IBTK_TIMER_STOP(t_deallocate_solver_state);
+    return;
+} // deallocateSolverState
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+PoissonMultigridLevelSolver::buildMultigridHierarchy()
+{
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_level_num);
+    const BoxArray<NDIM>& domain_boxes = grid_geom->getPhysicalDomain();
+
+    // Determine the number of coarse levels. The physical domain must be
+    // exactly coarsenable on each coarse level, and the patches of the solver
+    // level must be exactly coarsenable to the first coarse level.
+    int n_coarse_levels = 0;
+    if (is_coarsenable(level->getBoxes(), 2))
+    {
+        while (n_coarse_levels < d_max_coarse_levels && is_coarsenable(domain_boxes, 1 << (n_coarse_levels + 1)))
+        {
+            BoxArray<NDIM> coarse_domain_boxes(domain_boxes);
+            coarse_domain_boxes.coarsen(IntVector<NDIM>(1 << n_coarse_levels));
+            if (number_of_cells(coarse_domain_boxes) <= d_coarsest_level_max_cells) break;
+            ++n_coarse_levels;
+        }
+    }
+    else
+    {
+        TBOX_WARNING(d_object_name << "::initializeSolverState()\n"
+                                   << "  the patches on level " << d_level_num
+                                   << " of the patch hierarchy cannot be coarsened: the multigrid solver reduces to"
+                                      " the coarse level solver of the FAC preconditioner."
+                                   << std::endl);
+    }
+
+    // Create the multigrid hierarchy. The finest level has the same patches
+    // (with the same processor mapping) as the solver level, so data can be
+    // copied patch-by-patch between them. Note that the refinement ratio of
+    // each level is given relative to level 0 of the multigrid hierarchy.
+    const std::string mg_name = d_object_name + "::mg_hierarchy";
+    Pointer<CartesianGridGeometry<NDIM> > mg_grid_geom = grid_geom;
+    if (n_coarse_levels > 0)
+    {
+        mg_grid_geom = grid_geom->makeCoarsenedGridGeometry(
+            mg_name + "::grid_geometry", IntVector<NDIM>(1 << n_coarse_levels), /*register_for_restart*/ false);
+    }
+    d_mg_hierarchy = new PatchHierarchy<NDIM>(mg_name, mg_grid_geom, /*register_for_restart*/ false);
+    d_mg_finest_ln = n_coarse_levels;
+    const int n_nodes = IBTK_MPI::getNodes();
+    for (int ln = 0; ln < n_coarse_levels; ++ln)
+    {
+        BoxArray<NDIM> coarse_domain_boxes(domain_boxes);
+        coarse_domain_boxes.coarsen(IntVector<NDIM>(1 << (n_coarse_levels - ln)));
+        const BoxArray<NDIM> boxes = chop_boxes(coarse_domain_boxes, d_coarse_patch_size);
+        const int n_procs = std::max(1, std::min(n_nodes, number_of_cells(boxes) / d_cells_per_processor));
+        d_mg_hierarchy->makeNewPatchLevel(ln, IntVector<NDIM>(1 << ln), boxes, agglomerate_boxes(boxes, n_procs));
+    }
+    d_mg_hierarchy->makeNewPatchLevel(d_mg_finest_ln,
+                                      IntVector<NDIM>(1 << n_coarse_levels),
+                                      level->getBoxes(),
+                                      level->getProcessorMapping());
+    return;
+} // buildMultigridHierarchy
+
+void
+PoissonMultigridLevelSolver::copyVectorData(const SAMRAIVectorReal<NDIM, double>& src_vec,
+                                            Pointer<PatchLevel<NDIM> > src_level,
+                                            const SAMRAIVectorReal<NDIM, double>& dst_vec,
+                                            Pointer<PatchLevel<NDIM> > dst_level)
+{
+    const int src_idx = src_vec.getComponentDescriptorIndex(0);
+    const int dst_idx = dst_vec.getComponentDescriptorIndex(0);
+    for (PatchLevel<NDIM>::Iterator p(src_level); p; p++)
+    {
+        Pointer<PatchData<NDIM> > src_data = src_level->getPatch(p())->getPatchData(src_idx);
+        Pointer<PatchData<NDIM> > dst_data = dst_level->getPatch(p())->getPatchData(dst_idx);
+        dst_data->copy(*src_data);
+    }
+    return;
+} // copyVectorData
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,205 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/SAMRAIFischerGuess.h"
+#include "ibtk/ibtk_utilities.h"
+
+#include "SAMRAIVectorReal.h"
+#include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+
+IBTK_DISABLE_EXTRA_WARNINGS
+#include <Eigen/Dense>
+IBTK_ENABLE_EXTRA_WARNINGS
+
+#include <utility>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Timers.
+static Timer* t_submit;
+static Timer* t_guess;
+
+// SAMRAIVectorReal's const member functions take non-const pointer arguments.
+inline Pointer<SAMRAIVectorReal<NDIM, double> >
+wrap(const SAMRAIVectorReal<NDIM, double>& x)
+{
+    return Pointer<SAMRAIVectorReal<NDIM, double> >(const_cast<SAMRAIVectorReal<NDIM, double>*>(&x), false);
+} // wrap
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+SAMRAIFischerGuess::SAMRAIFischerGuess(const int n_vectors) : d_n_max_vectors(n_vectors)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(n_vectors >= 0);
+#endif
+    IBTK_DO_ONCE(t_submit = TimerManager::getManager()->getTimer("IBTK::SAMRAIFischerGuess::submit()");
+                 t_guess = TimerManager::getManager()->getTimer("IBTK::SAMRAIFischerGuess::guess()"););
+    return;
+} // SAMRAIFischerGuess
+
+SAMRAIFischerGuess::~SAMRAIFischerGuess()
+{
+    clear();
+    return;
+} // ~SAMRAIFischerGuess
+
+void
+SAMRAIFischerGuess::submit(const SAMRAIVectorReal<NDIM, double>& solution, const SAMRAIVectorReal<NDIM, double>& rhs)
+{
+    if (d_n_max_vectors == 0) return;
+    IBTK_TIMER_START(t_submit);
+
+    // Update our list of vectors. Once the list is full, the storage of the
+    // oldest pair is reused for the new one.
+    Pointer<SAMRAIVectorReal<NDIM, double> > new_solution, new_rhs;
+    if (d_n_stored_vectors == d_n_max_vectors)
+    {
+        // oldest entry is first
+        new_solution = d_solutions.front();
+        d_solutions.erase(d_solutions.begin());
+        new_rhs = d_rhs.front();
+        d_rhs.erase(d_rhs.begin());
+
+        // shift the computed dot products up and to the left:
+        Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> mat_copy(d_correlation_matrix);
+        for (int i = 1; i < d_n_max_vectors; ++i)
+        {
+            for (int j = 1; j < d_n_max_vectors; ++j)
+            {
+                d_correlation_matrix(i - 1, j - 1) = mat_copy(i, j);
+            }
+        }
+    }
+    else
+    {
+        ++d_n_stored_vectors;
+        new_solution = solution.cloneVector(solution.getName());
+        new_solution->allocateVectorData();
+        new_rhs = rhs.cloneVector(rhs.getName());
+        new_rhs->allocateVectorData();
+
+        // Save the prior dot products:
+        Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> mat_copy(d_correlation_matrix);
+        d_correlation_matrix.resize(d_n_stored_vectors, d_n_stored_vectors);
+        for (int i = 0; i < d_n_stored_vectors - 1; ++i)
+        {
+            for (int j = 0; j < d_n_stored_vectors - 1; ++j)
+            {
+                d_correlation_matrix(i, j) = mat_copy(i, j);
+            }
+        }
+    }
+    new_solution->copyVector(wrap(solution), /*interior_only*/ false);
+    new_rhs->copyVector(wrap(rhs), /*interior_only*/ false);
+    d_solutions.push_back(new_solution);
+    d_rhs.push_back(new_rhs);
+
+    // Compute the last row and then copy it into the last column.
+    for (int j = 0; j < d_n_stored_vectors; ++j)
+    {
+        const double inner = d_rhs.back()->dot(d_rhs[j]);
+        d_correlation_matrix(d_n_stored_vectors - 1, j) = inner;
+        d_correlation_matrix(j, d_n_stored_vectors - 1) = inner;
+    }
+    IBTK_TIMER_STOP(t_submit);
+    return;
+} // submit
+
+bool
+SAMRAIFischerGuess::guess(SAMRAIVectorReal<NDIM, double>& solution, const SAMRAIVectorReal<NDIM, double>& rhs) const
+{
+    if (d_n_stored_vectors == 0) return false;
+    IBTK_TIMER_START(t_guess);
+
+    Eigen::VectorXd coef_rhs(d_n_stored_vectors);
+    for (int i = 0; i < d_n_stored_vectors; ++i)
+    {
+        coef_rhs(i) = d_rhs[i]->dot(wrap(rhs));
+    }
+
+    // Should the SVD fail for any reason just use the last solution as a guess.
+    Eigen::VectorXd coefs(d_n_stored_vectors);
+    if (d_correlation_matrix.allFinite() && coef_rhs.allFinite())
+    {
+        Eigen::JacobiSVD<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> > svd(
+            d_correlation_matrix, Eigen::ComputeThinU | Eigen::ComputeThinV);
+        coefs = svd.solve(coef_rhs);
+    }
+    else
+    {
+        TBOX_WARNING(
+            "SAMRAIFischerGuess::guess()\n"
+            "  Unable to compute the SVD of the correlation matrix.\n"
+            "  This is not a fatal error, but usually indicates that\n"
+            "  the stored vectors are not valid, e.g., they may contain\n"
+            "  infinities or NaNs.\n");
+        coefs.fill(0.0);
+        coefs(d_n_stored_vectors - 1) = 1.0;
+    }
+
+    solution.setToScalar(0.0, /*interior_only*/ false);
+    Pointer<SAMRAIVectorReal<NDIM, double> > solution_ptr(&solution, false);
+    for (int i = 0; i < d_n_stored_vectors; ++i)
+    {
+        solution.axpy(coefs(i), d_solutions[i], solution_ptr);
+    }
+    IBTK_TIMER_STOP(t_guess);
+    return true;
+} // guess
+
+void
+SAMRAIFischerGuess::clear()
+{
+    for (auto& solution : d_solutions)
+    {
+        deallocate_vector_data(*solution);
+        free_vector_components(*solution);
+    }
+    for (auto& rhs : d_rhs)
+    {
+        deallocate_vector_data(*rhs);
+        free_vector_components(*rhs);
+    }
+    d_solutions.clear();
+    d_rhs.clear();
+    d_n_stored_vectors = 0;
+    d_correlation_matrix.resize(0, 0);
+    return;
+} // clear
+
+int
+SAMRAIFischerGuess::getNumberOfStoredVectors() const
+{
+    return d_n_stored_vectors;
+} // getNumberOfStoredVectors
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
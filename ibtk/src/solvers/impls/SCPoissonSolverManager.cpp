@@ -17,6 +17,7 @@
 #include "ibtk/LinearOperator.h"
 #include "ibtk/LinearSolver.h"
 #include "ibtk/PETScKrylovPoissonSolver.h"
+#include "ibtk/PoissonMultigridLevelSolver.h"
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/SCLaplaceOperator.h"
 #include "ibtk/SCPoissonHypreLevelSolver.h"
@@ -51,6 +52,7 @@ const std::string SCPoissonSolverManager::POINT_RELAXATION_FAC_PRECONDITIONER =
 const std::string SCPoissonSolverManager::DEFAULT_LEVEL_SOLVER = "DEFAULT_LEVEL_SOLVER";
 const std::string SCPoissonSolverManager::HYPRE_LEVEL_SOLVER = "HYPRE_LEVEL_SOLVER";
 const std::string SCPoissonSolverManager::PETSC_LEVEL_SOLVER = "PETSC_LEVEL_SOLVER";
+const std::string SCPoissonSolverManager::MULTIGRID_LEVEL_SOLVER = "MULTIGRID_LEVEL_SOLVER";
 
 SCPoissonSolverManager* SCPoissonSolverManager::s_solver_manager_instance = nullptr;
 bool SCPoissonSolverManager::s_registered_callback = false;
@@ -166,6 +168,7 @@ SCPoissonSolverManager::SCPoissonSolverManager() : d_solver_maker_map()
     registerSolverFactoryFunction(DEFAULT_LEVEL_SOLVER, SCPoissonHypreLevelSolver::allocate_solver);
     registerSolverFactoryFunction(HYPRE_LEVEL_SOLVER, SCPoissonHypreLevelSolver::allocate_solver);
     registerSolverFactoryFunction(PETSC_LEVEL_SOLVER, SCPoissonPETScLevelSolver::allocate_solver);
+    registerSolverFactoryFunction(MULTIGRID_LEVEL_SOLVER, PoissonMultigridLevelSolver::allocate_solver);
     return;
 } // SCPoissonSolverManager
 
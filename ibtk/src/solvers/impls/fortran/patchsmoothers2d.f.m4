@@ -13,19 +13,25 @@ c ---------------------------------------------------------------------
 
 define(NDIM,2)dnl
 define(REAL,`double precision')dnl
+define(SINGLE_REAL,`real')dnl
 define(INTEGER,`integer')dnl
 include(SAMRAI_FORTDIR/pdat_m4arrdim2d.i)dnl
-c
-ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+dnl Define the variable coefficient patch smoothers. The first argument is a
+dnl suffix for the subroutine names and the second argument is the type of the
+dnl variable coefficients, so that the same kernels can be generated for double
+dnl and single precision coefficients.
+define(VAR_COEF_SMOOTHERS_2D,`ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c     Perform a single Gauss-Seidel sweep for F = D div grad U +
-c     C U. Both D and C coefficients are constant.
+c     C U. C is a cell-centered variable and
+c     D is constant.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine smooth_gs_const_dc_2d(
+      subroutine smooth_gs_const_d_var_c$1_2d(
      &     U,U_gcw,
-     &     D,C,
+     &     D,
+     &     C,C_gcw,
      &     F,F_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
@@ -37,9 +43,10 @@ c     Input.
 c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
-      INTEGER U_gcw,F_gcw
+      INTEGER U_gcw,F_gcw,C_gcw
 
-      REAL D,C
+      REAL D
+      $2 C(CELL2d(ilower,iupper,C_gcw))
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &       ilower1-F_gcw:iupper1+F_gcw)
@@ -60,10 +67,11 @@ c     Perform a single Gauss-Seidel sweep.
 c
       fac0 = D/(dx(0)*dx(0))
       fac1 = D/(dx(1)*dx(1))
-      fac = 0.5d0/(fac0+fac1-0.5d0*C)
+
 
       do i1 = ilower1,iupper1
          do i0 = ilower0,iupper0
+            fac = 0.5d0/(fac0+fac1-0.5d0*C(i0,i1))
             U(i0,i1) = fac*(
      &           fac0*(U(i0-1,i1)+U(i0+1,i1)) +
      &           fac1*(U(i0,i1-1)+U(i0,i1+1)) -
@@ -77,14 +85,15 @@ c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c     Perform a single "red" or "black" Gauss-Seidel sweep for F = D
-c     div grad U + C U. Both D and C coefficients
-c     are constant.
+c     div grad U + C U. C is cell-centered variable and
+c     D is constant.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine smooth_gs_rb_const_dc_2d(
+      subroutine smooth_gs_rb_const_d_var_c$1_2d(
      &     U,U_gcw,
-     &     D,C,
+     &     D,
+     &     C, C_gcw,
      &     F,F_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
@@ -97,10 +106,11 @@ c     Input.
 c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
-      INTEGER U_gcw,F_gcw
+      INTEGER U_gcw,F_gcw,C_gcw
       INTEGER red_or_black
 
-      REAL D,C
+      REAL D
+      $2 C(CELL2d(ilower,iupper,C_gcw))
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &       ilower1-F_gcw:iupper1+F_gcw)
@@ -123,11 +133,11 @@ c
 
       fac0 = D/(dx(0)*dx(0))
       fac1 = D/(dx(1)*dx(1))
-      fac = 0.5d0/(fac0+fac1-0.5d0*C)
 
       do i1 = ilower1,iupper1
          do i0 = ilower0,iupper0
-            if ( mod(i0+i1,2) .eq. red_or_black ) then
+            if ( modulo(i0+i1,2) .eq. red_or_black ) then
+              fac = 0.5d0/(fac0+fac1-0.5d0*C(i0,i1))
                U(i0,i1) = fac*(
      &              fac0*(U(i0-1,i1)+U(i0+1,i1)) +
      &              fac1*(U(i0,i1-1)+U(i0,i1+1)) -
@@ -141,18 +151,19 @@ c
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Perform a single Gauss-Seidel sweep for F = alpha div grad U +
-c     beta U with masking of certain degrees of freedom.
+c     Perform a single Gauss-Seidel sweep for F = div D grad U +
+c     C U.
 c
-c     NOTE: The solution U is unmodified at masked degrees of freedom.
+c     The smoother is written for cell-centered U and side-centered
+c     D = (D0,D1) with constant C coefficient.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine gssmoothmask2d(
+      subroutine smooth_gs_var_d_const_c$1_2d(
      &     U,U_gcw,
-     &     alpha,beta,
+     &     D0,D1,D_gcw,
+     &     C,
      &     F,F_gcw,
-     &     mask,mask_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
      &     dx)
@@ -163,15 +174,15 @@ c     Input.
 c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
-      INTEGER U_gcw,F_gcw,mask_gcw
+      INTEGER U_gcw,F_gcw,D_gcw
 
-      REAL alpha,beta
+      REAL C
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &       ilower1-F_gcw:iupper1+F_gcw)
 
-      INTEGER mask(ilower0-mask_gcw:iupper0+mask_gcw,
-     &             ilower1-mask_gcw:iupper1+mask_gcw)
+      $2 D0(SIDE2d0(ilower,iupper,D_gcw))
+      $2 D1(SIDE2d1(ilower,iupper,D_gcw))
 
       REAL dx(0:NDIM-1)
 c
@@ -183,43 +194,51 @@ c
 c     Local variables.
 c
       INTEGER i0,i1
-      REAL    fac0,fac1,fac
+      REAL    hx,hy
+      REAL    facu0,facl0
+      REAL    facu1,facl1
+      REAL    fac
 c
 c     Perform a single Gauss-Seidel sweep.
 c
-      fac0 = alpha/(dx(0)*dx(0))
-      fac1 = alpha/(dx(1)*dx(1))
-      fac = 0.5d0/(fac0+fac1-0.5d0*beta)
+      hx = dx(0)
+      hy = dx(1)
 
       do i1 = ilower1,iupper1
          do i0 = ilower0,iupper0
-            if (mask(i0,i1) .eq. 0) then
-               U(i0,i1) = fac*(
-     &              fac0*(U(i0-1,i1)+U(i0+1,i1)) +
-     &              fac1*(U(i0,i1-1)+U(i0,i1+1)) -
-     &              F(i0,i1))
-            endif
+            facu0 = D0(i0+1,i1)/(hx*hx)
+            facl0 = D0(i0,i1)/(hx*hx)
+            facu1 = D1(i0,i1+1)/(hy*hy)
+            facl1 = D1(i0,i1)/(hy*hy)
+            fac   = 1.d0/(facu0+facl0+facu1+facl1-C)
+            U(i0,i1) = fac*(
+     &           facu0*U(i0+1,i1) +
+     &           facl0*U(i0-1,i1) +
+     &           facu1*U(i0,i1+1) +
+     &           facl1*U(i0,i1-1) -
+     &           F(i0,i1))
          enddo
       enddo
 c
       return
       end
 c
-c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Perform a single "red" or "black" Gauss-Seidel sweep for F = alpha
-c     div grad U + beta U with masking of certain degrees of freedom.
+c     Perform a single "red" or "black" Gauss-Seidel sweep for F =
+c     div D grad U + C U.
+c
+c     The smoother is written for cell-centered U and side-centered
+c     D = (D0,D1) with constant C coefficient.
 c
-c     NOTE: The solution U is unmodified at masked degrees of freedom.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine rbgssmoothmask2d(
+      subroutine smooth_gs_rb_var_d_const_c$1_2d(
      &     U,U_gcw,
-     &     alpha,beta,
+     &     D0,D1,D_gcw,
+     &     C,
      &     F,F_gcw,
-     &     mask,mask_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
      &     dx,
@@ -231,16 +250,15 @@ c     Input.
 c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
-      INTEGER U_gcw,F_gcw,mask_gcw
+      INTEGER U_gcw,F_gcw,D_gcw
       INTEGER red_or_black
-
-      REAL alpha,beta
+      REAL C
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &       ilower1-F_gcw:iupper1+F_gcw)
 
-      INTEGER mask(ilower0-mask_gcw:iupper0+mask_gcw,
-     &             ilower1-mask_gcw:iupper1+mask_gcw)
+      $2 D0(SIDE2d0(ilower,iupper,D_gcw))
+      $2 D1(SIDE2d1(ilower,iupper,D_gcw))
 
       REAL dx(0:NDIM-1)
 c
@@ -252,24 +270,32 @@ c
 c     Local variables.
 c
       INTEGER i0,i1
-      REAL    fac0,fac1,fac
+      REAL    hx,hy
+      REAL    facu0,facl0
+      REAL    facu1,facl1
+      REAL    fac
 c
 c     Perform a single "red" or "black" Gauss-Seidel sweep.
 c
       red_or_black = mod(red_or_black,2) ! "red" = 0, "black" = 1
 
-      fac0 = alpha/(dx(0)*dx(0))
-      fac1 = alpha/(dx(1)*dx(1))
-      fac = 0.5d0/(fac0+fac1-0.5d0*beta)
+      hx = dx(0)
+      hy = dx(1)
 
       do i1 = ilower1,iupper1
          do i0 = ilower0,iupper0
-            if ( (mod(i0+i1,2) .eq. red_or_black) .and.
-     &           (mask(i0,i1) .eq. 0) ) then
+            if ( modulo(i0+i1,2) .eq. red_or_black ) then
+               facu0 = D0(i0+1,i1)/(hx*hx)
+               facl0 = D0(i0,i1)/(hx*hx)
+               facu1 = D1(i0,i1+1)/(hy*hy)
+               facl1 = D1(i0,i1)/(hy*hy)
+               fac   = 1.d0/(facu0+facl0+facu1+facl1-C)
                U(i0,i1) = fac*(
-     &              fac0*(U(i0-1,i1)+U(i0+1,i1)) +
-     &              fac1*(U(i0,i1-1)+U(i0,i1+1)) -
-     &              F(i0,i1))
+     &             facu0*U(i0+1,i1) +
+     &             facl0*U(i0-1,i1) +
+     &             facu1*U(i0,i1+1) +
+     &             facl1*U(i0,i1-1) -
+     &             F(i0,i1))
             endif
          enddo
       enddo
@@ -278,21 +304,18 @@ c
       end
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
-
-c              Variable coefficient patch smoothers
-
-ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
-ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Perform a single Gauss-Seidel sweep for F = D div grad U +
-c     C U. C is a cell-centered variable and
-c     D is constant.
+c     Perform a single Gauss-Seidel sweep for F = div D grad U +
+c     C U.
+c
+c     The smoother is written for cell-centered U, side-centered
+c     D = (D0,D1) and cell-centered C coefficient.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine smooth_gs_const_d_var_c_2d(
+      subroutine smooth_gs_var_dc$1_2d(
      &     U,U_gcw,
-     &     D,
+     &     D0,D1,D_gcw,
      &     C,C_gcw,
      &     F,F_gcw,
      &     ilower0,iupper0,
@@ -305,14 +328,16 @@ c     Input.
 c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
-      INTEGER U_gcw,F_gcw,C_gcw
+      INTEGER U_gcw,F_gcw,D_gcw,C_gcw
 
-      REAL D
-      REAL C(CELL2d(ilower,iupper,C_gcw))
+      $2 C(CELL2d(ilower,iupper,C_gcw))
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &       ilower1-F_gcw:iupper1+F_gcw)
 
+      $2 D0(SIDE2d0(ilower,iupper,D_gcw))
+      $2 D1(SIDE2d1(ilower,iupper,D_gcw))
+
       REAL dx(0:NDIM-1)
 c
 c     Input/Output.
@@ -323,20 +348,28 @@ c
 c     Local variables.
 c
       INTEGER i0,i1
-      REAL    fac0,fac1,fac
+      REAL    hx,hy
+      REAL    facu0,facl0
+      REAL    facu1,facl1
+      REAL    fac
 c
 c     Perform a single Gauss-Seidel sweep.
 c
-      fac0 = D/(dx(0)*dx(0))
-      fac1 = D/(dx(1)*dx(1))
-
+      hx = dx(0)
+      hy = dx(1)
 
       do i1 = ilower1,iupper1
          do i0 = ilower0,iupper0
-            fac = 0.5d0/(fac0+fac1-0.5d0*C(i0,i1))
+            facu0 = D0(i0+1,i1)/(hx*hx)
+            facl0 = D0(i0,i1)/(hx*hx)
+            facu1 = D1(i0,i1+1)/(hy*hy)
+            facl1 = D1(i0,i1)/(hy*hy)
+            fac   = 1.d0/(facu0+facl0+facu1+facl1-C(i0,i1))
             U(i0,i1) = fac*(
-     &           fac0*(U(i0-1,i1)+U(i0+1,i1)) +
-     &           fac1*(U(i0,i1-1)+U(i0,i1+1)) -
+     &           facu0*U(i0+1,i1) +
+     &           facl0*U(i0-1,i1) +
+     &           facu1*U(i0,i1+1) +
+     &           facl1*U(i0,i1-1) -
      &           F(i0,i1))
          enddo
       enddo
@@ -346,16 +379,19 @@ c
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Perform a single "red" or "black" Gauss-Seidel sweep for F = D
-c     div grad U + C U. C is cell-centered variable and
-c     D is constant.
+c     Perform a single "red" or "black" Gauss-Seidel sweep for F =
+c     div D grad U + C U.
+c
+c     The smoother is written for cell-centered U, side-centered
+c     D = (D0,D1) and cell-centered C coefficient.
+c
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine smooth_gs_rb_const_d_var_c_2d(
+      subroutine smooth_gs_rb_var_dc$1_2d(
      &     U,U_gcw,
-     &     D,
-     &     C, C_gcw,
+     &     D0,D1,D_gcw,
+     &     C,C_gcw,
      &     F,F_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
@@ -368,15 +404,16 @@ c     Input.
 c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
-      INTEGER U_gcw,F_gcw,C_gcw
+      INTEGER U_gcw,F_gcw,D_gcw,C_gcw
       INTEGER red_or_black
-
-      REAL D
-      REAL C(CELL2d(ilower,iupper,C_gcw))
+      $2 C(CELL2d(ilower,iupper,C_gcw))
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &       ilower1-F_gcw:iupper1+F_gcw)
 
+      $2 D0(SIDE2d0(ilower,iupper,D_gcw))
+      $2 D1(SIDE2d1(ilower,iupper,D_gcw))
+
       REAL dx(0:NDIM-1)
 c
 c     Input/Output.
@@ -387,44 +424,49 @@ c
 c     Local variables.
 c
       INTEGER i0,i1
-      REAL    fac0,fac1,fac
+      REAL    hx,hy
+      REAL    facu0,facl0
+      REAL    facu1,facl1
+      REAL    fac
 c
 c     Perform a single "red" or "black" Gauss-Seidel sweep.
 c
       red_or_black = mod(red_or_black,2) ! "red" = 0, "black" = 1
 
-      fac0 = D/(dx(0)*dx(0))
-      fac1 = D/(dx(1)*dx(1))
+      hx = dx(0)
+      hy = dx(1)
 
       do i1 = ilower1,iupper1
          do i0 = ilower0,iupper0
-            if ( mod(i0+i1,2) .eq. red_or_black ) then
-              fac = 0.5d0/(fac0+fac1-0.5d0*C(i0,i1))
+            if ( modulo(i0+i1,2) .eq. red_or_black ) then
+               facu0 = D0(i0+1,i1)/(hx*hx)
+               facl0 = D0(i0,i1)/(hx*hx)
+               facu1 = D1(i0,i1+1)/(hy*hy)
+               facl1 = D1(i0,i1)/(hy*hy)
+               fac   = 1.d0/(facu0+facl0+facu1+facl1-C(i0,i1))
                U(i0,i1) = fac*(
-     &              fac0*(U(i0-1,i1)+U(i0+1,i1)) +
-     &              fac1*(U(i0,i1-1)+U(i0,i1+1)) -
-     &              F(i0,i1))
+     &             facu0*U(i0+1,i1) +
+     &             facl0*U(i0-1,i1) +
+     &             facu1*U(i0,i1+1) +
+     &             facl1*U(i0,i1-1) -
+     &             F(i0,i1))
             endif
          enddo
       enddo
 c
       return
-      end
+      end')dnl
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Perform a single Gauss-Seidel sweep for F = div D grad U +
-c     C U.
-c
-c     The smoother is written for cell-centered U and side-centered
-c     D = (D0,D1) with constant C coefficient.
+c     Perform a single Gauss-Seidel sweep for F = D div grad U +
+c     C U. Both D and C coefficients are constant.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine smooth_gs_var_d_const_c_2d(
+      subroutine smooth_gs_const_dc_2d(
      &     U,U_gcw,
-     &     D0,D1,D_gcw,
-     &     C,
+     &     D,C,
      &     F,F_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
@@ -436,16 +478,13 @@ c     Input.
 c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
-      INTEGER U_gcw,F_gcw,D_gcw
+      INTEGER U_gcw,F_gcw
 
-      REAL C
+      REAL D,C
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &       ilower1-F_gcw:iupper1+F_gcw)
 
-      REAL D0(SIDE2d0(ilower,iupper,D_gcw))
-      REAL D1(SIDE2d1(ilower,iupper,D_gcw))
-
       REAL dx(0:NDIM-1)
 c
 c     Input/Output.
@@ -456,28 +495,19 @@ c
 c     Local variables.
 c
       INTEGER i0,i1
-      REAL    hx,hy
-      REAL    facu0,facl0
-      REAL    facu1,facl1
-      REAL    fac
+      REAL    fac0,fac1,fac
 c
 c     Perform a single Gauss-Seidel sweep.
 c
-      hx = dx(0)
-      hy = dx(1)
+      fac0 = D/(dx(0)*dx(0))
+      fac1 = D/(dx(1)*dx(1))
+      fac = 0.5d0/(fac0+fac1-0.5d0*C)
 
       do i1 = ilower1,iupper1
          do i0 = ilower0,iupper0
-            facu0 = D0(i0+1,i1)/(hx*hx)
-            facl0 = D0(i0,i1)/(hx*hx)
-            facu1 = D1(i0,i1+1)/(hy*hy)
-            facl1 = D1(i0,i1)/(hy*hy)
-            fac   = 1.d0/(facu0+facl0+facu1+facl1-C)
             U(i0,i1) = fac*(
-     &           facu0*U(i0+1,i1) +
-     &           facl0*U(i0-1,i1) +
-     &           facu1*U(i0,i1+1) +
-     &           facl1*U(i0,i1-1) -
+     &           fac0*(U(i0-1,i1)+U(i0+1,i1)) +
+     &           fac1*(U(i0,i1-1)+U(i0,i1+1)) -
      &           F(i0,i1))
          enddo
       enddo
@@ -487,19 +517,15 @@ c
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Perform a single "red" or "black" Gauss-Seidel sweep for F =
-c     div D grad U + C U.
-c
-c     The smoother is written for cell-centered U and side-centered
-c     D = (D0,D1) with constant C coefficient.
-c
+c     Perform a single "red" or "black" Gauss-Seidel sweep for F = D
+c     div grad U + C U. Both D and C coefficients
+c     are constant.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine smooth_gs_rb_var_d_const_c_2d(
+      subroutine smooth_gs_rb_const_dc_2d(
      &     U,U_gcw,
-     &     D0,D1,D_gcw,
-     &     C,
+     &     D,C,
      &     F,F_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
@@ -512,16 +538,14 @@ c     Input.
 c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
-      INTEGER U_gcw,F_gcw,D_gcw
+      INTEGER U_gcw,F_gcw
       INTEGER red_or_black
-      REAL C
+
+      REAL D,C
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &       ilower1-F_gcw:iupper1+F_gcw)
 
-      REAL D0(SIDE2d0(ilower,iupper,D_gcw))
-      REAL D1(SIDE2d1(ilower,iupper,D_gcw))
-
       REAL dx(0:NDIM-1)
 c
 c     Input/Output.
@@ -532,32 +556,23 @@ c
 c     Local variables.
 c
       INTEGER i0,i1
-      REAL    hx,hy
-      REAL    facu0,facl0
-      REAL    facu1,facl1
-      REAL    fac
+      REAL    fac0,fac1,fac
 c
 c     Perform a single "red" or "black" Gauss-Seidel sweep.
 c
       red_or_black = mod(red_or_black,2) ! "red" = 0, "black" = 1
 
-      hx = dx(0)
-      hy = dx(1)
+      fac0 = D/(dx(0)*dx(0))
+      fac1 = D/(dx(1)*dx(1))
+      fac = 0.5d0/(fac0+fac1-0.5d0*C)
 
       do i1 = ilower1,iupper1
          do i0 = ilower0,iupper0
-            if ( mod(i0+i1,2) .eq. red_or_black ) then
-               facu0 = D0(i0+1,i1)/(hx*hx)
-               facl0 = D0(i0,i1)/(hx*hx)
-               facu1 = D1(i0,i1+1)/(hy*hy)
-               facl1 = D1(i0,i1)/(hy*hy)
-               fac   = 1.d0/(facu0+facl0+facu1+facl1-C)
+            if ( modulo(i0+i1,2) .eq. red_or_black ) then
                U(i0,i1) = fac*(
-     &             facu0*U(i0+1,i1) +
-     &             facl0*U(i0-1,i1) +
-     &             facu1*U(i0,i1+1) +
-     &             facl1*U(i0,i1-1) -
-     &             F(i0,i1))
+     &              fac0*(U(i0-1,i1)+U(i0+1,i1)) +
+     &              fac1*(U(i0,i1-1)+U(i0,i1+1)) -
+     &              F(i0,i1))
             endif
          enddo
       enddo
@@ -567,19 +582,18 @@ c
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Perform a single Gauss-Seidel sweep for F = div D grad U +
-c     C U.
+c     Perform a single Gauss-Seidel sweep for F = alpha div grad U +
+c     beta U with masking of certain degrees of freedom.
 c
-c     The smoother is written for cell-centered U, side-centered
-c     D = (D0,D1) and cell-centered C coefficient.
+c     NOTE: The solution U is unmodified at masked degrees of freedom.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine smooth_gs_var_dc_2d(
+      subroutine gssmoothmask2d(
      &     U,U_gcw,
-     &     D0,D1,D_gcw,
-     &     C,C_gcw,
+     &     alpha,beta,
      &     F,F_gcw,
+     &     mask,mask_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
      &     dx)
@@ -590,15 +604,15 @@ c     Input.
 c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
-      INTEGER U_gcw,F_gcw,D_gcw,C_gcw
+      INTEGER U_gcw,F_gcw,mask_gcw
 
-      REAL C(CELL2d(ilower,iupper,C_gcw))
+      REAL alpha,beta
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &       ilower1-F_gcw:iupper1+F_gcw)
 
-      REAL D0(SIDE2d0(ilower,iupper,D_gcw))
-      REAL D1(SIDE2d1(ilower,iupper,D_gcw))
+      INTEGER mask(ilower0-mask_gcw:iupper0+mask_gcw,
+     &             ilower1-mask_gcw:iupper1+mask_gcw)
 
       REAL dx(0:NDIM-1)
 c
@@ -610,51 +624,43 @@ c
 c     Local variables.
 c
       INTEGER i0,i1
-      REAL    hx,hy
-      REAL    facu0,facl0
-      REAL    facu1,facl1
-      REAL    fac
+      REAL    fac0,fac1,fac
 c
 c     Perform a single Gauss-Seidel sweep.
 c
-      hx = dx(0)
-      hy = dx(1)
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac = 0.5d0/(fac0+fac1-0.5d0*beta)
 
       do i1 = ilower1,iupper1
          do i0 = ilower0,iupper0
-            facu0 = D0(i0+1,i1)/(hx*hx)
-            facl0 = D0(i0,i1)/(hx*hx)
-            facu1 = D1(i0,i1+1)/(hy*hy)
-            facl1 = D1(i0,i1)/(hy*hy)
-            fac   = 1.d0/(facu0+facl0+facu1+facl1-C(i0,i1))
-            U(i0,i1) = fac*(
-     &           facu0*U(i0+1,i1) +
-     &           facl0*U(i0-1,i1) +
-     &           facu1*U(i0,i1+1) +
-     &           facl1*U(i0,i1-1) -
-     &           F(i0,i1))
+            if (mask(i0,i1) .eq. 0) then
+               U(i0,i1) = fac*(
+     &              fac0*(U(i0-1,i1)+U(i0+1,i1)) +
+     &              fac1*(U(i0,i1-1)+U(i0,i1+1)) -
+     &              F(i0,i1))
+            endif
          enddo
       enddo
 c
       return
       end
 c
-ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Perform a single "red" or "black" Gauss-Seidel sweep for F =
-c     div D grad U + C U.
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     The smoother is written for cell-centered U, side-centered
-c     D = (D0,D1) and cell-centered C coefficient.
+c     Perform a single "red" or "black" Gauss-Seidel sweep for F = alpha
+c     div grad U + beta U with masking of certain degrees of freedom.
 c
+c     NOTE: The solution U is unmodified at masked degrees of freedom.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine smooth_gs_rb_var_dc_2d(
+      subroutine rbgssmoothmask2d(
      &     U,U_gcw,
-     &     D0,D1,D_gcw,
-     &     C,C_gcw,
+     &     alpha,beta,
      &     F,F_gcw,
+     &     mask,mask_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
      &     dx,
@@ -666,15 +672,16 @@ c     Input.
 c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
-      INTEGER U_gcw,F_gcw,D_gcw,C_gcw
+      INTEGER U_gcw,F_gcw,mask_gcw
       INTEGER red_or_black
-      REAL C(CELL2d(ilower,iupper,C_gcw))
+
+      REAL alpha,beta
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &       ilower1-F_gcw:iupper1+F_gcw)
 
-      REAL D0(SIDE2d0(ilower,iupper,D_gcw))
-      REAL D1(SIDE2d1(ilower,iupper,D_gcw))
+      INTEGER mask(ilower0-mask_gcw:iupper0+mask_gcw,
+     &             ilower1-mask_gcw:iupper1+mask_gcw)
 
       REAL dx(0:NDIM-1)
 c
@@ -686,32 +693,24 @@ c
 c     Local variables.
 c
       INTEGER i0,i1
-      REAL    hx,hy
-      REAL    facu0,facl0
-      REAL    facu1,facl1
-      REAL    fac
+      REAL    fac0,fac1,fac
 c
 c     Perform a single "red" or "black" Gauss-Seidel sweep.
 c
       red_or_black = mod(red_or_black,2) ! "red" = 0, "black" = 1
 
-      hx = dx(0)
-      hy = dx(1)
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac = 0.5d0/(fac0+fac1-0.5d0*beta)
 
       do i1 = ilower1,iupper1
          do i0 = ilower0,iupper0
-            if ( mod(i0+i1,2) .eq. red_or_black ) then
-               facu0 = D0(i0+1,i1)/(hx*hx)
-               facl0 = D0(i0,i1)/(hx*hx)
-               facu1 = D1(i0,i1+1)/(hy*hy)
-               facl1 = D1(i0,i1)/(hy*hy)
-               fac   = 1.d0/(facu0+facl0+facu1+facl1-C(i0,i1))
+            if ( (modulo(i0+i1,2) .eq. red_or_black) .and.
+     &           (mask(i0,i1) .eq. 0) ) then
                U(i0,i1) = fac*(
-     &             facu0*U(i0+1,i1) +
-     &             facl0*U(i0-1,i1) +
-     &             facu1*U(i0,i1+1) +
-     &             facl1*U(i0,i1-1) -
-     &             F(i0,i1))
+     &              fac0*(U(i0-1,i1)+U(i0+1,i1)) +
+     &              fac1*(U(i0,i1-1)+U(i0,i1+1)) -
+     &              F(i0,i1))
             endif
          enddo
       enddo
@@ -720,6 +719,21 @@ c
       end
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+
+c              Variable coefficient patch smoothers
+
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+VAR_COEF_SMOOTHERS_2D(`',`REAL')
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+
+c              Variable coefficient patch smoothers with single
+c              precision coefficients
+
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+VAR_COEF_SMOOTHERS_2D(`_sp',`SINGLE_REAL')
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c  Perform a single Gauss-Seidel sweep for
 c     (f0,f1) = alpha div mu (grad (u0,u1) + grad (u0, u1)^T) + beta c (u0,u1).
@@ -925,7 +939,7 @@ c
       fac = 2.d0*fac0**2.d0
       do i1 = ilower1,iupper1
          do i0 = ilower0,iupper0+1
-            if (mod(i0+i1,2) .eq. red_or_black) then
+            if (modulo(i0+i1,2) .eq. red_or_black) then
 
             c = beta
             if (var_c .eq. 1) then
@@ -964,7 +978,7 @@ c
       fac = 2.d0*fac1**2.d0
       do i1 = ilower1,iupper1+1
          do i0 = ilower0,iupper0
-            if (mod(i0+i1,2) .eq. red_or_black) then
+            if (modulo(i0+i1,2) .eq. red_or_black) then
 
             c = beta
             if (var_c .eq. 1) then
@@ -1235,7 +1249,7 @@ c
       fac = 2.d0*fac0**2.d0
       do i1 = ilower1,iupper1
          do i0 = ilower0,iupper0+1
-            if ( (mod(i0+i1,2) .eq. red_or_black) .and.
+            if ( (modulo(i0+i1,2) .eq. red_or_black) .and.
      &           (mask0(i0,i1) .eq. 0) ) then
 
             c = beta
@@ -1275,7 +1289,7 @@ c
       fac = 2.d0*fac1**2.d0
       do i1 = ilower1,iupper1+1
          do i0 = ilower0,iupper0
-            if ( (mod(i0+i1,2) .eq. red_or_black) .and.
+            if ( (modulo(i0+i1,2) .eq. red_or_black) .and.
      &           (mask1(i0,i1) .eq. 0) ) then
 
             c = beta
@@ -13,19 +13,25 @@ c ---------------------------------------------------------------------
 
 define(NDIM,3)dnl
 define(REAL,`double precision')dnl
+define(SINGLE_REAL,`real')dnl
 define(INTEGER,`integer')dnl
 include(SAMRAI_FORTDIR/pdat_m4arrdim3d.i)dnl
-c
-ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+dnl Define the variable coefficient patch smoothers. The first argument is a
+dnl suffix for the subroutine names and the second argument is the type of the
+dnl variable coefficients, so that the same kernels can be generated for double
+dnl and single precision coefficients.
+define(VAR_COEF_SMOOTHERS_3D,`ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c     Perform a single Gauss-Seidel sweep for F = D div grad U +
-c     C U. Both D and C coefficients are constant.
+c     C U. C is a cell-centered variable and
+c     D is constant.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine smooth_gs_const_dc_3d(
+      subroutine smooth_gs_const_d_var_c$1_3d(
      &     U,U_gcw,
-     &     D,C,
+     &     D,
+     &     C,C_gcw,
      &     F,F_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
@@ -39,9 +45,10 @@ c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
       INTEGER ilower2,iupper2
-      INTEGER U_gcw,F_gcw
+      INTEGER U_gcw,F_gcw,C_gcw
 
-      REAL D,C
+      REAL D
+      $2 C(CELL3d(ilower,iupper,C_gcw))
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &     ilower1-F_gcw:iupper1+F_gcw,
@@ -65,11 +72,11 @@ c
       fac0 = D/(dx(0)*dx(0))
       fac1 = D/(dx(1)*dx(1))
       fac2 = D/(dx(2)*dx(2))
-      fac = 0.5d0/(fac0+fac1+fac2-0.5d0*C)
 
       do i2 = ilower2,iupper2
          do i1 = ilower1,iupper1
             do i0 = ilower0,iupper0
+               fac = 0.5d0/(fac0+fac1+fac2-0.5d0*C(i0,i1,i2))
                U(i0,i1,i2) = fac*(
      &              fac0*(U(i0-1,i1,i2)+U(i0+1,i1,i2)) +
      &              fac1*(U(i0,i1-1,i2)+U(i0,i1+1,i2)) +
@@ -85,14 +92,15 @@ c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c     Perform a single "red" or "black" Gauss-Seidel sweep for F = D
-c     div grad U + C U. Both D and C coefficients
-c     are constant.
+c     div grad U + C U. C is cell-centered variable and
+c     D is constant.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine smooth_gs_rb_const_dc_3d(
+      subroutine smooth_gs_rb_const_d_var_c$1_3d(
      &     U,U_gcw,
-     &     D,C,
+     &     D,
+     &     C, C_gcw,
      &     F,F_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
@@ -107,10 +115,11 @@ c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
       INTEGER ilower2,iupper2
-      INTEGER U_gcw,F_gcw
+      INTEGER U_gcw,F_gcw,C_gcw
       INTEGER red_or_black
 
-      REAL D,C
+      REAL D
+      $2 C(CELL3d(ilower,iupper,C_gcw))
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &     ilower1-F_gcw:iupper1+F_gcw,
@@ -136,12 +145,12 @@ c
       fac0 = D/(dx(0)*dx(0))
       fac1 = D/(dx(1)*dx(1))
       fac2 = D/(dx(2)*dx(2))
-      fac = 0.5d0/(fac0+fac1+fac2-0.5d0*C)
 
       do i2 = ilower2,iupper2
          do i1 = ilower1,iupper1
             do i0 = ilower0,iupper0
-               if ( mod(i0+i1+i2,2) .eq. red_or_black ) then
+               if ( modulo(i0+i1+i2,2) .eq. red_or_black ) then
+                  fac = 0.5d0/(fac0+fac1+fac2-0.5d0*C(i0,i1,i2))
                   U(i0,i1,i2) = fac*(
      &                 fac0*(U(i0-1,i1,i2)+U(i0+1,i1,i2)) +
      &                 fac1*(U(i0,i1-1,i2)+U(i0,i1+1,i2)) +
@@ -157,18 +166,19 @@ c
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Perform a single Gauss-Seidel sweep for F = alpha div grad U +
-c     beta U with masking of certain degrees of freedom.
+c     Perform a single Gauss-Seidel sweep for F = div D grad U +
+c     C U.
 c
-c     NOTE: The solution U is unmodified at masked degrees of freedom.
+c     The smoother is written for cell-centered U and side-centered
+c     D = (D0,D1) with constant C coefficient.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine gssmoothmask3d(
+      subroutine smooth_gs_var_d_const_c$1_3d(
      &     U,U_gcw,
-     &     alpha,beta,
+     &     D0,D1,D2,D_gcw,
+     &     C,
      &     F,F_gcw,
-     &     mask,mask_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
      &     ilower2,iupper2,
@@ -181,17 +191,17 @@ c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
       INTEGER ilower2,iupper2
-      INTEGER U_gcw,F_gcw,mask_gcw
+      INTEGER U_gcw,F_gcw,D_gcw
 
-      REAL alpha,beta
+      REAL C
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &     ilower1-F_gcw:iupper1+F_gcw,
      &     ilower2-F_gcw:iupper2+F_gcw)
 
-      INTEGER mask(ilower0-mask_gcw:iupper0+mask_gcw,
-     &     ilower1-mask_gcw:iupper1+mask_gcw,
-     &     ilower2-mask_gcw:iupper2+mask_gcw)
+      $2 D0(SIDE3d0(ilower,iupper,D_gcw))
+      $2 D1(SIDE3d1(ilower,iupper,D_gcw))
+      $2 D2(SIDE3d2(ilower,iupper,D_gcw))
 
       REAL dx(0:NDIM-1)
 c
@@ -204,25 +214,36 @@ c
 c     Local variables.
 c
       INTEGER i0,i1,i2
-      REAL    fac0,fac1,fac2,fac
+      REAL    hx,hy,hz
+      REAL    facu0,facl0
+      REAL    facu1,facl1
+      REAL    facu2,facl2
+      REAL    fac
 c
 c     Perform a single Gauss-Seidel sweep.
 c
-      fac0 = alpha/(dx(0)*dx(0))
-      fac1 = alpha/(dx(1)*dx(1))
-      fac2 = alpha/(dx(2)*dx(2))
-      fac = 0.5d0/(fac0+fac1+fac2-0.5d0*beta)
+      hx = dx(0)
+      hy = dx(1)
+      hz = dx(2)
 
       do i2 = ilower2,iupper2
          do i1 = ilower1,iupper1
             do i0 = ilower0,iupper0
-               if (mask(i0,i1,i2) .eq. 0) then
-                  U(i0,i1,i2) = fac*(
-     &                 fac0*(U(i0-1,i1,i2)+U(i0+1,i1,i2)) +
-     &                 fac1*(U(i0,i1-1,i2)+U(i0,i1+1,i2)) +
-     &                 fac2*(U(i0,i1,i2-1)+U(i0,i1,i2+1)) -
-     &                 F(i0,i1,i2))
-               endif
+               facu0 = D0(i0+1,i1,i2)/(hx*hx)
+               facl0 = D0(i0,i1,i2)/(hx*hx)
+               facu1 = D1(i0,i1+1,i2)/(hy*hy)
+               facl1 = D1(i0,i1,i2)/(hy*hy)
+               facu2 = D2(i0,i1,i2+1)/(hz*hz)
+               facl2 = D2(i0,i1,i2)/(hz*hz)
+               fac   = 1.d0/(facu0+facl0+facu1+facl1+facu2+facl2-C)
+               U(i0,i1,i2) = fac*(
+     &             facu0*U(i0+1,i1,i2) +
+     &             facl0*U(i0-1,i1,i2) +
+     &             facu1*U(i0,i1+1,i2) +
+     &             facl1*U(i0,i1-1,i2) +
+     &             facu2*U(i0,i1,i2+1) +
+     &             facl2*U(i0,i1,i2-1) -
+     &             F(i0,i1,i2))
             enddo
          enddo
       enddo
@@ -232,18 +253,20 @@ c
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Perform a single "red" or "black" Gauss-Seidel sweep for F = alpha
-c     div grad U + beta U with masking of certain degrees of freedom.
+c     Perform a single "red" or "black" Gauss-Seidel sweep for F =
+c     div D grad U + C U.
+c
+c     The smoother is written for cell-centered U and side-centered
+c     D = (D0,D1) with constant C coefficient.
 c
-c     NOTE: The solution U is unmodified at masked degrees of freedom.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine rbgssmoothmask3d(
+      subroutine smooth_gs_rb_var_d_const_c$1_3d(
      &     U,U_gcw,
-     &     alpha,beta,
+     &     D0,D1,D2,D_gcw,
+     &     C,
      &     F,F_gcw,
-     &     mask,mask_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
      &     ilower2,iupper2,
@@ -257,18 +280,18 @@ c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
       INTEGER ilower2,iupper2
-      INTEGER U_gcw,F_gcw,mask_gcw
+      INTEGER U_gcw,F_gcw,D_gcw
       INTEGER red_or_black
 
-      REAL alpha,beta
+      REAL C
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &     ilower1-F_gcw:iupper1+F_gcw,
      &     ilower2-F_gcw:iupper2+F_gcw)
 
-      INTEGER mask(ilower0-mask_gcw:iupper0+mask_gcw,
-     &     ilower1-mask_gcw:iupper1+mask_gcw,
-     &     ilower2-mask_gcw:iupper2+mask_gcw)
+      $2 D0(SIDE3d0(ilower,iupper,D_gcw))
+      $2 D1(SIDE3d1(ilower,iupper,D_gcw))
+      $2 D2(SIDE3d2(ilower,iupper,D_gcw))
 
       REAL dx(0:NDIM-1)
 c
@@ -281,27 +304,39 @@ c
 c     Local variables.
 c
       INTEGER i0,i1,i2
-      REAL    fac0,fac1,fac2,fac
+      REAL    hx,hy,hz
+      REAL    facu0,facl0
+      REAL    facu1,facl1
+      REAL    facu2,facl2
+      REAL    fac
 c
 c     Perform a single "red" or "black" Gauss-Seidel sweep.
 c
       red_or_black = mod(red_or_black,2) ! "red" = 0, "black" = 1
 
-      fac0 = alpha/(dx(0)*dx(0))
-      fac1 = alpha/(dx(1)*dx(1))
-      fac2 = alpha/(dx(2)*dx(2))
-      fac = 0.5d0/(fac0+fac1+fac2-0.5d0*beta)
+      hx = dx(0)
+      hy = dx(1)
+      hz = dx(2)
 
       do i2 = ilower2,iupper2
          do i1 = ilower1,iupper1
             do i0 = ilower0,iupper0
-               if ( (mod(i0+i1+i2,2) .eq. red_or_black) .and.
-     &              (mask(i0,i1,i2) .eq. 0) ) then
+               if ( modulo(i0+i1+i2,2) .eq. red_or_black ) then
+                  facu0 = D0(i0+1,i1,i2)/(hx*hx)
+                  facl0 = D0(i0,i1,i2)/(hx*hx)
+                  facu1 = D1(i0,i1+1,i2)/(hy*hy)
+                  facl1 = D1(i0,i1,i2)/(hy*hy)
+                  facu2 = D2(i0,i1,i2+1)/(hz*hz)
+                  facl2 = D2(i0,i1,i2)/(hz*hz)
+                  fac  = 1.d0/(facu0+facl0+facu1+facl1+facu2+facl2-C)
                   U(i0,i1,i2) = fac*(
-     &                 fac0*(U(i0-1,i1,i2)+U(i0+1,i1,i2)) +
-     &                 fac1*(U(i0,i1-1,i2)+U(i0,i1+1,i2)) +
-     &                 fac2*(U(i0,i1,i2-1)+U(i0,i1,i2+1)) -
-     &                 F(i0,i1,i2))
+     &                facu0*U(i0+1,i1,i2) +
+     &                facl0*U(i0-1,i1,i2) +
+     &                facu1*U(i0,i1+1,i2) +
+     &                facl1*U(i0,i1-1,i2) +
+     &                facu2*U(i0,i1,i2+1) +
+     &                facl2*U(i0,i1,i2-1) -
+     &                F(i0,i1,i2))
                endif
             enddo
          enddo
@@ -311,21 +346,18 @@ c
       end
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
-
-c              Variable coefficient patch smoothers
-
-ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
-ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Perform a single Gauss-Seidel sweep for F = D div grad U +
-c     C U. C is a cell-centered variable and
-c     D is constant.
+c     Perform a single Gauss-Seidel sweep for F = div D grad U +
+c     C U.
+c
+c     The smoother is written for cell-centered U, side-centered
+c     D = (D0,D1) and cell-centered C coefficient.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine smooth_gs_const_d_var_c_3d(
+      subroutine smooth_gs_var_dc$1_3d(
      &     U,U_gcw,
-     &     D,
+     &     D0,D1,D2,D_gcw,
      &     C,C_gcw,
      &     F,F_gcw,
      &     ilower0,iupper0,
@@ -340,15 +372,18 @@ c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
       INTEGER ilower2,iupper2
-      INTEGER U_gcw,F_gcw,C_gcw
+      INTEGER U_gcw,F_gcw,D_gcw,C_gcw
 
-      REAL D
-      REAL C(CELL3d(ilower,iupper,C_gcw))
+      $2 C(CELL3d(ilower,iupper,C_gcw))
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &     ilower1-F_gcw:iupper1+F_gcw,
      &     ilower2-F_gcw:iupper2+F_gcw)
 
+      $2 D0(SIDE3d0(ilower,iupper,D_gcw))
+      $2 D1(SIDE3d1(ilower,iupper,D_gcw))
+      $2 D2(SIDE3d2(ilower,iupper,D_gcw))
+
       REAL dx(0:NDIM-1)
 c
 c     Input/Output.
@@ -360,23 +395,37 @@ c
 c     Local variables.
 c
       INTEGER i0,i1,i2
-      REAL    fac0,fac1,fac2,fac
+      REAL    hx,hy,hz
+      REAL    facu0,facl0
+      REAL    facu1,facl1
+      REAL    facu2,facl2
+      REAL    fac
 c
 c     Perform a single Gauss-Seidel sweep.
 c
-      fac0 = D/(dx(0)*dx(0))
-      fac1 = D/(dx(1)*dx(1))
-      fac2 = D/(dx(2)*dx(2))
+      hx = dx(0)
+      hy = dx(1)
+      hz = dx(2)
 
       do i2 = ilower2,iupper2
          do i1 = ilower1,iupper1
             do i0 = ilower0,iupper0
-               fac = 0.5d0/(fac0+fac1+fac2-0.5d0*C(i0,i1,i2))
+               facu0 = D0(i0+1,i1,i2)/(hx*hx)
+               facl0 = D0(i0,i1,i2)/(hx*hx)
+               facu1 = D1(i0,i1+1,i2)/(hy*hy)
+               facl1 = D1(i0,i1,i2)/(hy*hy)
+               facu2 = D2(i0,i1,i2+1)/(hz*hz)
+               facl2 = D2(i0,i1,i2)/(hz*hz)
+               fac   = 1.d0/(facu0+facl0+facu1+facl1+facu2+facl2
+     &                  -C(i0,i1,i2))
                U(i0,i1,i2) = fac*(
-     &              fac0*(U(i0-1,i1,i2)+U(i0+1,i1,i2)) +
-     &              fac1*(U(i0,i1-1,i2)+U(i0,i1+1,i2)) +
-     &              fac2*(U(i0,i1,i2-1)+U(i0,i1,i2+1)) -
-     &              F(i0,i1,i2))
+     &             facu0*U(i0+1,i1,i2) +
+     &             facl0*U(i0-1,i1,i2) +
+     &             facu1*U(i0,i1+1,i2) +
+     &             facl1*U(i0,i1-1,i2) +
+     &             facu2*U(i0,i1,i2+1) +
+     &             facl2*U(i0,i1,i2-1) -
+     &             F(i0,i1,i2))
             enddo
          enddo
       enddo
@@ -386,16 +435,19 @@ c
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Perform a single "red" or "black" Gauss-Seidel sweep for F = D
-c     div grad U + C U. C is cell-centered variable and
-c     D is constant.
+c     Perform a single "red" or "black" Gauss-Seidel sweep for F =
+c     div D grad U + C U.
+c
+c     The smoother is written for cell-centered U, side-centered
+c     D = (D0,D1) and cell-centered C coefficient.
+c
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine smooth_gs_rb_const_d_var_c_3d(
+      subroutine smooth_gs_rb_var_dc$1_3d(
      &     U,U_gcw,
-     &     D,
-     &     C, C_gcw,
+     &     D0,D1,D2,D_gcw,
+     &     C,C_gcw,
      &     F,F_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
@@ -410,16 +462,19 @@ c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
       INTEGER ilower2,iupper2
-      INTEGER U_gcw,F_gcw,C_gcw
+      INTEGER U_gcw,F_gcw,D_gcw,C_gcw
       INTEGER red_or_black
 
-      REAL D
-      REAL C(CELL3d(ilower,iupper,C_gcw))
+      $2 C(CELL3d(ilower,iupper,C_gcw))
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &     ilower1-F_gcw:iupper1+F_gcw,
      &     ilower2-F_gcw:iupper2+F_gcw)
 
+      $2 D0(SIDE3d0(ilower,iupper,D_gcw))
+      $2 D1(SIDE3d1(ilower,iupper,D_gcw))
+      $2 D2(SIDE3d2(ilower,iupper,D_gcw))
+
       REAL dx(0:NDIM-1)
 c
 c     Input/Output.
@@ -431,48 +486,58 @@ c
 c     Local variables.
 c
       INTEGER i0,i1,i2
-      REAL    fac0,fac1,fac2,fac
+      REAL    hx,hy,hz
+      REAL    facu0,facl0
+      REAL    facu1,facl1
+      REAL    facu2,facl2
+      REAL    fac
 c
 c     Perform a single "red" or "black" Gauss-Seidel sweep.
 c
       red_or_black = mod(red_or_black,2) ! "red" = 0, "black" = 1
 
-      fac0 = D/(dx(0)*dx(0))
-      fac1 = D/(dx(1)*dx(1))
-      fac2 = D/(dx(2)*dx(2))
+      hx = dx(0)
+      hy = dx(1)
+      hz = dx(2)
 
       do i2 = ilower2,iupper2
          do i1 = ilower1,iupper1
             do i0 = ilower0,iupper0
-               if ( mod(i0+i1+i2,2) .eq. red_or_black ) then
-                  fac = 0.5d0/(fac0+fac1+fac2-0.5d0*C(i0,i1,i2))
+               if ( modulo(i0+i1+i2,2) .eq. red_or_black ) then
+                  facu0 = D0(i0+1,i1,i2)/(hx*hx)
+                  facl0 = D0(i0,i1,i2)/(hx*hx)
+                  facu1 = D1(i0,i1+1,i2)/(hy*hy)
+                  facl1 = D1(i0,i1,i2)/(hy*hy)
+                  facu2 = D2(i0,i1,i2+1)/(hz*hz)
+                  facl2 = D2(i0,i1,i2)/(hz*hz)
+                  fac  = 1.d0/(facu0+facl0+facu1+facl1+facu2+facl2
+     &                   -C(i0,i1,i2))
                   U(i0,i1,i2) = fac*(
-     &                 fac0*(U(i0-1,i1,i2)+U(i0+1,i1,i2)) +
-     &                 fac1*(U(i0,i1-1,i2)+U(i0,i1+1,i2)) +
-     &                 fac2*(U(i0,i1,i2-1)+U(i0,i1,i2+1)) -
-     &                 F(i0,i1,i2))
+     &                facu0*U(i0+1,i1,i2) +
+     &                facl0*U(i0-1,i1,i2) +
+     &                facu1*U(i0,i1+1,i2) +
+     &                facl1*U(i0,i1-1,i2) +
+     &                facu2*U(i0,i1,i2+1) +
+     &                facl2*U(i0,i1,i2-1) -
+     &                F(i0,i1,i2))
                endif
             enddo
          enddo
       enddo
 c
       return
-      end
+      end')dnl
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Perform a single Gauss-Seidel sweep for F = div D grad U +
-c     C U.
-c
-c     The smoother is written for cell-centered U and side-centered
-c     D = (D0,D1) with constant C coefficient.
+c     Perform a single Gauss-Seidel sweep for F = D div grad U +
+c     C U. Both D and C coefficients are constant.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine smooth_gs_var_d_const_c_3d(
+      subroutine smooth_gs_const_dc_3d(
      &     U,U_gcw,
-     &     D0,D1,D2,D_gcw,
-     &     C,
+     &     D,C,
      &     F,F_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
@@ -486,18 +551,14 @@ c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
       INTEGER ilower2,iupper2
-      INTEGER U_gcw,F_gcw,D_gcw
+      INTEGER U_gcw,F_gcw
 
-      REAL C
+      REAL D,C
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &     ilower1-F_gcw:iupper1+F_gcw,
      &     ilower2-F_gcw:iupper2+F_gcw)
 
-      REAL D0(SIDE3d0(ilower,iupper,D_gcw))
-      REAL D1(SIDE3d1(ilower,iupper,D_gcw))
-      REAL D2(SIDE3d2(ilower,iupper,D_gcw))
-
       REAL dx(0:NDIM-1)
 c
 c     Input/Output.
@@ -509,36 +570,23 @@ c
 c     Local variables.
 c
       INTEGER i0,i1,i2
-      REAL    hx,hy,hz
-      REAL    facu0,facl0
-      REAL    facu1,facl1
-      REAL    facu2,facl2
-      REAL    fac
+      REAL    fac0,fac1,fac2,fac
 c
 c     Perform a single Gauss-Seidel sweep.
 c
-      hx = dx(0)
-      hy = dx(1)
-      hz = dx(2)
+      fac0 = D/(dx(0)*dx(0))
+      fac1 = D/(dx(1)*dx(1))
+      fac2 = D/(dx(2)*dx(2))
+      fac = 0.5d0/(fac0+fac1+fac2-0.5d0*C)
 
       do i2 = ilower2,iupper2
          do i1 = ilower1,iupper1
             do i0 = ilower0,iupper0
-               facu0 = D0(i0+1,i1,i2)/(hx*hx)
-               facl0 = D0(i0,i1,i2)/(hx*hx)
-               facu1 = D1(i0,i1+1,i2)/(hy*hy)
-               facl1 = D1(i0,i1,i2)/(hy*hy)
-               facu2 = D2(i0,i1,i2+1)/(hz*hz)
-               facl2 = D2(i0,i1,i2)/(hz*hz)
-               fac   = 1.d0/(facu0+facl0+facu1+facl1+facu2+facl2-C)
                U(i0,i1,i2) = fac*(
-     &             facu0*U(i0+1,i1,i2) +
-     &             facl0*U(i0-1,i1,i2) +
-     &             facu1*U(i0,i1+1,i2) +
-     &             facl1*U(i0,i1-1,i2) +
-     &             facu2*U(i0,i1,i2+1) +
-     &             facl2*U(i0,i1,i2-1) -
-     &             F(i0,i1,i2))
+     &              fac0*(U(i0-1,i1,i2)+U(i0+1,i1,i2)) +
+     &              fac1*(U(i0,i1-1,i2)+U(i0,i1+1,i2)) +
+     &              fac2*(U(i0,i1,i2-1)+U(i0,i1,i2+1)) -
+     &              F(i0,i1,i2))
             enddo
          enddo
       enddo
@@ -548,19 +596,15 @@ c
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Perform a single "red" or "black" Gauss-Seidel sweep for F =
-c     div D grad U + C U.
-c
-c     The smoother is written for cell-centered U and side-centered
-c     D = (D0,D1) with constant C coefficient.
-c
+c     Perform a single "red" or "black" Gauss-Seidel sweep for F = D
+c     div grad U + C U. Both D and C coefficients
+c     are constant.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine smooth_gs_rb_var_d_const_c_3d(
+      subroutine smooth_gs_rb_const_dc_3d(
      &     U,U_gcw,
-     &     D0,D1,D2,D_gcw,
-     &     C,
+     &     D,C,
      &     F,F_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
@@ -575,19 +619,15 @@ c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
       INTEGER ilower2,iupper2
-      INTEGER U_gcw,F_gcw,D_gcw
+      INTEGER U_gcw,F_gcw
       INTEGER red_or_black
 
-      REAL C
+      REAL D,C
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &     ilower1-F_gcw:iupper1+F_gcw,
      &     ilower2-F_gcw:iupper2+F_gcw)
 
-      REAL D0(SIDE3d0(ilower,iupper,D_gcw))
-      REAL D1(SIDE3d1(ilower,iupper,D_gcw))
-      REAL D2(SIDE3d2(ilower,iupper,D_gcw))
-
       REAL dx(0:NDIM-1)
 c
 c     Input/Output.
@@ -599,39 +639,26 @@ c
 c     Local variables.
 c
       INTEGER i0,i1,i2
-      REAL    hx,hy,hz
-      REAL    facu0,facl0
-      REAL    facu1,facl1
-      REAL    facu2,facl2
-      REAL    fac
+      REAL    fac0,fac1,fac2,fac
 c
 c     Perform a single "red" or "black" Gauss-Seidel sweep.
 c
       red_or_black = mod(red_or_black,2) ! "red" = 0, "black" = 1
 
-      hx = dx(0)
-      hy = dx(1)
-      hz = dx(2)
+      fac0 = D/(dx(0)*dx(0))
+      fac1 = D/(dx(1)*dx(1))
+      fac2 = D/(dx(2)*dx(2))
+      fac = 0.5d0/(fac0+fac1+fac2-0.5d0*C)
 
       do i2 = ilower2,iupper2
          do i1 = ilower1,iupper1
             do i0 = ilower0,iupper0
-               if ( mod(i0+i1+i2,2) .eq. red_or_black ) then
-                  facu0 = D0(i0+1,i1,i2)/(hx*hx)
-                  facl0 = D0(i0,i1,i2)/(hx*hx)
-                  facu1 = D1(i0,i1+1,i2)/(hy*hy)
-                  facl1 = D1(i0,i1,i2)/(hy*hy)
-                  facu2 = D2(i0,i1,i2+1)/(hz*hz)
-                  facl2 = D2(i0,i1,i2)/(hz*hz)
-                  fac  = 1.d0/(facu0+facl0+facu1+facl1+facu2+facl2-C)
+               if ( modulo(i0+i1+i2,2) .eq. red_or_black ) then
                   U(i0,i1,i2) = fac*(
-     &                facu0*U(i0+1,i1,i2) +
-     &                facl0*U(i0-1,i1,i2) +
-     &                facu1*U(i0,i1+1,i2) +
-     &                facl1*U(i0,i1-1,i2) +
-     &                facu2*U(i0,i1,i2+1) +
-     &                facl2*U(i0,i1,i2-1) -
-     &                F(i0,i1,i2))
+     &                 fac0*(U(i0-1,i1,i2)+U(i0+1,i1,i2)) +
+     &                 fac1*(U(i0,i1-1,i2)+U(i0,i1+1,i2)) +
+     &                 fac2*(U(i0,i1,i2-1)+U(i0,i1,i2+1)) -
+     &                 F(i0,i1,i2))
                endif
             enddo
          enddo
@@ -642,19 +669,18 @@ c
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Perform a single Gauss-Seidel sweep for F = div D grad U +
-c     C U.
+c     Perform a single Gauss-Seidel sweep for F = alpha div grad U +
+c     beta U with masking of certain degrees of freedom.
 c
-c     The smoother is written for cell-centered U, side-centered
-c     D = (D0,D1) and cell-centered C coefficient.
+c     NOTE: The solution U is unmodified at masked degrees of freedom.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine smooth_gs_var_dc_3d(
+      subroutine gssmoothmask3d(
      &     U,U_gcw,
-     &     D0,D1,D2,D_gcw,
-     &     C,C_gcw,
+     &     alpha,beta,
      &     F,F_gcw,
+     &     mask,mask_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
      &     ilower2,iupper2,
@@ -667,17 +693,17 @@ c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
       INTEGER ilower2,iupper2
-      INTEGER U_gcw,F_gcw,D_gcw,C_gcw
+      INTEGER U_gcw,F_gcw,mask_gcw
 
-      REAL C(CELL3d(ilower,iupper,C_gcw))
+      REAL alpha,beta
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &     ilower1-F_gcw:iupper1+F_gcw,
      &     ilower2-F_gcw:iupper2+F_gcw)
 
-      REAL D0(SIDE3d0(ilower,iupper,D_gcw))
-      REAL D1(SIDE3d1(ilower,iupper,D_gcw))
-      REAL D2(SIDE3d2(ilower,iupper,D_gcw))
+      INTEGER mask(ilower0-mask_gcw:iupper0+mask_gcw,
+     &     ilower1-mask_gcw:iupper1+mask_gcw,
+     &     ilower2-mask_gcw:iupper2+mask_gcw)
 
       REAL dx(0:NDIM-1)
 c
@@ -690,37 +716,25 @@ c
 c     Local variables.
 c
       INTEGER i0,i1,i2
-      REAL    hx,hy,hz
-      REAL    facu0,facl0
-      REAL    facu1,facl1
-      REAL    facu2,facl2
-      REAL    fac
+      REAL    fac0,fac1,fac2,fac
 c
 c     Perform a single Gauss-Seidel sweep.
 c
-      hx = dx(0)
-      hy = dx(1)
-      hz = dx(2)
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac2 = alpha/(dx(2)*dx(2))
+      fac = 0.5d0/(fac0+fac1+fac2-0.5d0*beta)
 
       do i2 = ilower2,iupper2
          do i1 = ilower1,iupper1
             do i0 = ilower0,iupper0
-               facu0 = D0(i0+1,i1,i2)/(hx*hx)
-               facl0 = D0(i0,i1,i2)/(hx*hx)
-               facu1 = D1(i0,i1+1,i2)/(hy*hy)
-               facl1 = D1(i0,i1,i2)/(hy*hy)
-               facu2 = D2(i0,i1,i2+1)/(hz*hz)
-               facl2 = D2(i0,i1,i2)/(hz*hz)
-               fac   = 1.d0/(facu0+facl0+facu1+facl1+facu2+facl2
-     &                  -C(i0,i1,i2))
-               U(i0,i1,i2) = fac*(
-     &             facu0*U(i0+1,i1,i2) +
-     &             facl0*U(i0-1,i1,i2) +
-     &             facu1*U(i0,i1+1,i2) +
-     &             facl1*U(i0,i1-1,i2) +
-     &             facu2*U(i0,i1,i2+1) +
-     &             facl2*U(i0,i1,i2-1) -
-     &             F(i0,i1,i2))
+               if (mask(i0,i1,i2) .eq. 0) then
+                  U(i0,i1,i2) = fac*(
+     &                 fac0*(U(i0-1,i1,i2)+U(i0+1,i1,i2)) +
+     &                 fac1*(U(i0,i1-1,i2)+U(i0,i1+1,i2)) +
+     &                 fac2*(U(i0,i1,i2-1)+U(i0,i1,i2+1)) -
+     &                 F(i0,i1,i2))
+               endif
             enddo
          enddo
       enddo
@@ -730,20 +744,18 @@ c
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Perform a single "red" or "black" Gauss-Seidel sweep for F =
-c     div D grad U + C U.
-c
-c     The smoother is written for cell-centered U, side-centered
-c     D = (D0,D1) and cell-centered C coefficient.
+c     Perform a single "red" or "black" Gauss-Seidel sweep for F = alpha
+c     div grad U + beta U with masking of certain degrees of freedom.
 c
+c     NOTE: The solution U is unmodified at masked degrees of freedom.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine smooth_gs_rb_var_dc_3d(
+      subroutine rbgssmoothmask3d(
      &     U,U_gcw,
-     &     D0,D1,D2,D_gcw,
-     &     C,C_gcw,
+     &     alpha,beta,
      &     F,F_gcw,
+     &     mask,mask_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
      &     ilower2,iupper2,
@@ -757,18 +769,18 @@ c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
       INTEGER ilower2,iupper2
-      INTEGER U_gcw,F_gcw,D_gcw,C_gcw
+      INTEGER U_gcw,F_gcw,mask_gcw
       INTEGER red_or_black
 
-      REAL C(CELL3d(ilower,iupper,C_gcw))
+      REAL alpha,beta
 
       REAL F(ilower0-F_gcw:iupper0+F_gcw,
      &     ilower1-F_gcw:iupper1+F_gcw,
      &     ilower2-F_gcw:iupper2+F_gcw)
 
-      REAL D0(SIDE3d0(ilower,iupper,D_gcw))
-      REAL D1(SIDE3d1(ilower,iupper,D_gcw))
-      REAL D2(SIDE3d2(ilower,iupper,D_gcw))
+      INTEGER mask(ilower0-mask_gcw:iupper0+mask_gcw,
+     &     ilower1-mask_gcw:iupper1+mask_gcw,
+     &     ilower2-mask_gcw:iupper2+mask_gcw)
 
       REAL dx(0:NDIM-1)
 c
@@ -781,40 +793,27 @@ c
 c     Local variables.
 c
       INTEGER i0,i1,i2
-      REAL    hx,hy,hz
-      REAL    facu0,facl0
-      REAL    facu1,facl1
-      REAL    facu2,facl2
-      REAL    fac
+      REAL    fac0,fac1,fac2,fac
 c
 c     Perform a single "red" or "black" Gauss-Seidel sweep.
 c
       red_or_black = mod(red_or_black,2) ! "red" = 0, "black" = 1
 
-      hx = dx(0)
-      hy = dx(1)
-      hz = dx(2)
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac2 = alpha/(dx(2)*dx(2))
+      fac = 0.5d0/(fac0+fac1+fac2-0.5d0*beta)
 
       do i2 = ilower2,iupper2
          do i1 = ilower1,iupper1
             do i0 = ilower0,iupper0
-               if ( mod(i0+i1+i2,2) .eq. red_or_black ) then
-                  facu0 = D0(i0+1,i1,i2)/(hx*hx)
-                  facl0 = D0(i0,i1,i2)/(hx*hx)
-                  facu1 = D1(i0,i1+1,i2)/(hy*hy)
-                  facl1 = D1(i0,i1,i2)/(hy*hy)
-                  facu2 = D2(i0,i1,i2+1)/(hz*hz)
-                  facl2 = D2(i0,i1,i2)/(hz*hz)
-                  fac  = 1.d0/(facu0+facl0+facu1+facl1+facu2+facl2
-     &                   -C(i0,i1,i2))
+               if ( (modulo(i0+i1+i2,2) .eq. red_or_black) .and.
+     &              (mask(i0,i1,i2) .eq. 0) ) then
                   U(i0,i1,i2) = fac*(
-     &                facu0*U(i0+1,i1,i2) +
-     &                facl0*U(i0-1,i1,i2) +
-     &                facu1*U(i0,i1+1,i2) +
-     &                facl1*U(i0,i1-1,i2) +
-     &                facu2*U(i0,i1,i2+1) +
-     &                facl2*U(i0,i1,i2-1) -
-     &                F(i0,i1,i2))
+     &                 fac0*(U(i0-1,i1,i2)+U(i0+1,i1,i2)) +
+     &                 fac1*(U(i0,i1-1,i2)+U(i0,i1+1,i2)) +
+     &                 fac2*(U(i0,i1,i2-1)+U(i0,i1,i2+1)) -
+     &                 F(i0,i1,i2))
                endif
             enddo
          enddo
@@ -823,6 +822,21 @@ c
       return
       end
 c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+
+c              Variable coefficient patch smoothers
+
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+VAR_COEF_SMOOTHERS_3D(`',`REAL')
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+
+c              Variable coefficient patch smoothers with single
+c              precision coefficients
+
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+VAR_COEF_SMOOTHERS_3D(`_sp',`SINGLE_REAL')
+c
 cccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c  Perform a single Gauss-Seidel sweep for
 c     (f0,f1,f2) = alpha div mu (grad (u0,u1,u2) + grad (u0, u1,u2)^T) + beta c (u0,u1,u2).
@@ -1171,7 +1185,7 @@ c
       do i2 = ilower2,iupper2
          do i1 = ilower1,iupper1
             do i0 = ilower0,iupper0+1
-               if ( mod(i0+i1+i2,2) .eq. red_or_black ) then
+               if ( modulo(i0+i1+i2,2) .eq. red_or_black ) then
 
                   c = beta
                   if (var_c .eq. 1) then
@@ -1237,7 +1251,7 @@ c
       do i2 = ilower2,iupper2
          do i1 = ilower1,iupper1+1
             do i0 = ilower0,iupper0
-               if ( mod(i0+i1+i2,2) .eq. red_or_black ) then
+               if ( modulo(i0+i1+i2,2) .eq. red_or_black ) then
 
                   c = beta
                   if (var_c .eq. 1) then
@@ -1304,7 +1318,7 @@ c
       do i2 = ilower2,iupper2+1
          do i1 = ilower1,iupper1
             do i0 = ilower0,iupper0
-               if ( mod(i0+i1+i2,2) .eq. red_or_black ) then
+               if ( modulo(i0+i1+i2,2) .eq. red_or_black ) then
 
                   c = beta
                   if (var_c .eq. 1) then
@@ -1748,7 +1762,7 @@ c
       do i2 = ilower2,iupper2
          do i1 = ilower1,iupper1
             do i0 = ilower0,iupper0+1
-               if ( (mod(i0+i1+i2,2) .eq. red_or_black) .and.
+               if ( (modulo(i0+i1+i2,2) .eq. red_or_black) .and.
      &              (mask0(i0,i1,i2) .eq. 0) ) then
 
                   c = beta
@@ -1815,7 +1829,7 @@ c
       do i2 = ilower2,iupper2
          do i1 = ilower1,iupper1+1
             do i0 = ilower0,iupper0
-               if ( (mod(i0+i1+i2,2) .eq. red_or_black) .and.
+               if ( (modulo(i0+i1+i2,2) .eq. red_or_black) .and.
      &              (mask1(i0,i1,i2) .eq. 0) ) then
 
                   c = beta
@@ -1882,7 +1896,7 @@ c
       do i2 = ilower2,iupper2+1
          do i1 = ilower1,iupper1
             do i0 = ilower0,iupper0
-               if ( (mod(i0+i1+i2,2) .eq. red_or_black) .and.
+               if ( (modulo(i0+i1+i2,2) .eq. red_or_black) .and.
      &              (mask2(i0,i1,i2) .eq. 0) ) then
 
                   c = beta
@@ -19,9 +19,20 @@
 #include "ibtk/PETScSAMRAIVectorReal.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "CellData.h"
+#include "CellVariable.h"
+#include "Index.h"
 #include "IntVector.h"
+#include "Patch.h"
+#include "PatchData.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "SAMRAIVectorReal.h"
+#include "SideData.h"
+#include "SideGeometry.h"
+#include "SideVariable.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/Pointer.h"
 #include "tbox/Timer.h"
@@ -32,9 +43,12 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
@@ -104,6 +118,203 @@ static Timer* t_vec_dot_norm2;
 #define PSVR_CHECK3(v1, v2, v3)
 #define PSVR_CHECKN(v, N)
 #endif
+
+// The fused multi-vector kernels below only support vectors whose components
+// are all cell-centered or side-centered. Other vectors use the component-wise
+// SAMRAI operations.
+bool
+supports_fused_kernels(const SAMRAIVectorReal<NDIM, double>& x)
+{
+    for (int comp = 0; comp < x.getNumberOfComponents(); ++comp)
+    {
+        Pointer<CellVariable<NDIM, double> > cc_var = x.getComponentVariable(comp);
+        Pointer<SideVariable<NDIM, double> > sc_var = x.getComponentVariable(comp);
+        if (!cc_var && !sc_var) return false;
+    }
+    return true;
+} // supports_fused_kernels
+
+// Get the arrays storing the patch data with the given index (one array for
+// cell-centered data and NDIM arrays for side-centered data) and the boxes of
+// the patch interior in the index space of each array. Returns the number of
+// arrays.
+int
+get_patch_arrays(std::array<ArrayData<NDIM, double>*, NDIM>& arrays,
+                 std::array<Box<NDIM>, NDIM>& interior_boxes,
+                 const Patch<NDIM>& patch,
+                 const int data_idx)
+{
+    Pointer<PatchData<NDIM> > data = patch.getPatchData(data_idx);
+    Pointer<CellData<NDIM, double> > cc_data = data;
+    if (cc_data)
+    {
+        arrays[0] = &cc_data->getArrayData();
+        interior_boxes[0] = patch.getBox();
+        return 1;
+    }
+    Pointer<SideData<NDIM, double> > sc_data = data;
+    TBOX_ASSERT(sc_data);
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        arrays[axis] = &sc_data->getArrayData(axis);
+        interior_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch.getBox(), axis);
+    }
+    return NDIM;
+} // get_patch_arrays
+
+// Offset of index i from the beginning of the array (for each depth).
+inline std::ptrdiff_t
+array_offset(const ArrayData<NDIM, double>& array, const hier::Index<NDIM>& i)
+{
+    const Box<NDIM>& array_box = array.getBox();
+    std::ptrdiff_t offset = 0, stride = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        offset += (i(d) - array_box.lower()(d)) * stride;
+        stride *= array_box.numberCells(d);
+    }
+    return offset;
+} // array_offset
+
+// The box of the first index of each contiguous row of values in box.
+inline Box<NDIM>
+get_row_box(const Box<NDIM>& box)
+{
+    Box<NDIM> row_box(box);
+    row_box.upper()(0) = row_box.lower()(0);
+    return row_box;
+} // get_row_box
+
+// Compute val[k] = (x, y[k]) over the local part of the hierarchy with a single
+// traversal of the patches of x. Equivalent to calling x.dot(y[k], true) for
+// each k (the control volume weights of x are used if they are present). The
+// values of x are reused from cache while they are multiplied by each y[k].
+void
+fused_local_mdot(const SAMRAIVectorReal<NDIM, double>& x,
+                 const int nv,
+                 const Pointer<SAMRAIVectorReal<NDIM, double> >* y,
+                 PetscScalar* val)
+{
+    std::fill(val, val + nv, 0.0);
+    if (nv == 0) return;
+    Pointer<PatchHierarchy<NDIM> > hierarchy = x.getPatchHierarchy();
+    std::array<ArrayData<NDIM, double>*, NDIM> x_arrays, cvol_arrays;
+    std::vector<std::array<ArrayData<NDIM, double>*, NDIM> > y_arrays(nv);
+    std::array<Box<NDIM>, NDIM> interior_boxes, unused_boxes;
+    std::vector<double> xc_row;
+    for (int comp = 0; comp < x.getNumberOfComponents(); ++comp)
+    {
+        const int x_idx = x.getComponentDescriptorIndex(comp);
+        const int cvol_idx = x.getControlVolumeIndex(comp);
+        for (int ln = x.getCoarsestLevelNumber(); ln <= x.getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const int n_arrays = get_patch_arrays(x_arrays, interior_boxes, *patch, x_idx);
+                for (int k = 0; k < nv; ++k)
+                {
+                    get_patch_arrays(y_arrays[k], unused_boxes, *patch, y[k]->getComponentDescriptorIndex(comp));
+                }
+                if (cvol_idx >= 0) get_patch_arrays(cvol_arrays, unused_boxes, *patch, cvol_idx);
+                for (int a = 0; a < n_arrays; ++a)
+                {
+                    const Box<NDIM>& box = interior_boxes[a];
+                    const int n = box.numberCells(0);
+                    xc_row.resize(n);
+                    const Box<NDIM> row_box = get_row_box(box);
+                    for (int depth = 0; depth < x_arrays[a]->getDepth(); ++depth)
+                    {
+                        for (Box<NDIM>::Iterator b(row_box); b; b++)
+                        {
+                            const hier::Index<NDIM>& i = b();
+                            const double* const x_row = x_arrays[a]->getPointer(depth) + array_offset(*x_arrays[a], i);
+                            if (cvol_idx >= 0)
+                            {
+                                const ArrayData<NDIM, double>& cvol = *cvol_arrays[a];
+                                const double* const cvol_row =
+                                    cvol.getPointer(cvol.getDepth() == 1 ? 0 : depth) + array_offset(cvol, i);
+                                for (int m = 0; m < n; ++m) xc_row[m] = x_row[m] * cvol_row[m];
+                            }
+                            else
+                            {
+                                std::copy(x_row, x_row + n, xc_row.begin());
+                            }
+                            for (int k = 0; k < nv; ++k)
+                            {
+                                const ArrayData<NDIM, double>& y_array = *y_arrays[k][a];
+                                const double* const y_row = y_array.getPointer(depth) + array_offset(y_array, i);
+                                double sum = 0.0;
+                                for (int m = 0; m < n; ++m) sum += xc_row[m] * y_row[m];
+                                val[k] += sum;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return;
+} // fused_local_mdot
+
+// Compute y := y + sum_k alpha[k] x[k] over the patch interiors and ghost cells
+// with a single traversal of the patches of y, so that each row of y is read
+// and written once rather than once per x[k].
+void
+fused_maxpy(SAMRAIVectorReal<NDIM, double>& y,
+            const int nv,
+            const PetscScalar* const alpha,
+            const Pointer<SAMRAIVectorReal<NDIM, double> >* x)
+{
+    if (nv == 0) return;
+    Pointer<PatchHierarchy<NDIM> > hierarchy = y.getPatchHierarchy();
+    std::array<ArrayData<NDIM, double>*, NDIM> y_arrays;
+    std::vector<std::array<ArrayData<NDIM, double>*, NDIM> > x_arrays(nv);
+    std::array<Box<NDIM>, NDIM> unused_boxes;
+    for (int comp = 0; comp < y.getNumberOfComponents(); ++comp)
+    {
+        const int y_idx = y.getComponentDescriptorIndex(comp);
+        for (int ln = y.getCoarsestLevelNumber(); ln <= y.getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const int n_arrays = get_patch_arrays(y_arrays, unused_boxes, *patch, y_idx);
+                for (int k = 0; k < nv; ++k)
+                {
+                    get_patch_arrays(x_arrays[k], unused_boxes, *patch, x[k]->getComponentDescriptorIndex(comp));
+                }
+                for (int a = 0; a < n_arrays; ++a)
+                {
+                    // As in SAMRAI, only update the values stored by every array.
+                    Box<NDIM> box = y_arrays[a]->getBox();
+                    for (int k = 0; k < nv; ++k) box = box * x_arrays[k][a]->getBox();
+                    if (box.empty()) continue;
+                    const int n = box.numberCells(0);
+                    const Box<NDIM> row_box = get_row_box(box);
+                    for (int depth = 0; depth < y_arrays[a]->getDepth(); ++depth)
+                    {
+                        for (Box<NDIM>::Iterator b(row_box); b; b++)
+                        {
+                            const hier::Index<NDIM>& i = b();
+                            double* const y_row = y_arrays[a]->getPointer(depth) + array_offset(*y_arrays[a], i);
+                            for (int k = 0; k < nv; ++k)
+                            {
+                                const ArrayData<NDIM, double>& x_array = *x_arrays[k][a];
+                                const double* const x_row = x_array.getPointer(depth) + array_offset(x_array, i);
+                                const double alpha_k = alpha[k];
+                                for (int m = 0; m < n; ++m) y_row[m] += alpha_k * x_row[m];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return;
+} // fused_maxpy
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -313,11 +524,7 @@ PETScSAMRAIVectorReal::VecMDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscSca
     PetscFunctionBeginUser;
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
-    }
+    computeLocalMDot(x, nv, y, val);
     IBTK_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_dot);
     PetscFunctionReturn(0);
@@ -377,11 +584,7 @@ PETScSAMRAIVectorReal::VecMTDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscSc
     PetscFunctionBeginUser;
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
-    }
+    computeLocalMDot(x, nv, y, val);
     IBTK_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_t_dot);
     PetscFunctionReturn(0);
@@ -506,6 +709,16 @@ PETScSAMRAIVectorReal::VecMAXPY_SAMRAI(Vec y, PetscInt nv, const PetscScalar* al
     PetscFunctionBeginUser;
     PSVR_CHECK1(y);
     PSVR_CHECKN(x, nv);
+    if (supports_fused_kernels(*PSVR_CAST2(y)))
+    {
+        std::vector<Pointer<SAMRAIVectorReal<NDIM, double> > > x_vecs(nv);
+        for (PetscInt i = 0; i < nv; ++i) x_vecs[i] = PSVR_CAST2(x[i]);
+        fused_maxpy(*PSVR_CAST2(y), nv, alpha, x_vecs.data());
+        int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
+        CHKERRQ(ierr);
+        IBTK_TIMER_STOP(t_vec_maxpy);
+        PetscFunctionReturn(0);
+    }
     static const bool interior_only = false;
     for (PetscInt i = 0; i < nv; ++i)
     {
@@ -748,11 +961,7 @@ PETScSAMRAIVectorReal::VecMDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, Pe
     PetscFunctionBeginUser;
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
-    }
+    computeLocalMDot(x, nv, y, val);
     IBTK_TIMER_STOP(t_vec_m_dot_local);
     PetscFunctionReturn(0);
 }
@@ -764,11 +973,7 @@ PETScSAMRAIVectorReal::VecMTDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, P
     PetscFunctionBeginUser;
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
-    }
+    computeLocalMDot(x, nv, y, val);
     IBTK_TIMER_STOP(t_vec_m_t_dot_local);
     PetscFunctionReturn(0);
 }
@@ -790,12 +995,36 @@ PETScSAMRAIVectorReal::VecDotNorm2_SAMRAI(Vec s, Vec t, PetscScalar* dp, PetscSc
     IBTK_TIMER_START(t_vec_dot_norm2);
     PetscFunctionBeginUser;
     PSVR_CHECK2(s, t);
-    *dp = PSVR_CAST2(s)->dot(PSVR_CAST2(t));
-    *nm = PSVR_CAST2(t)->dot(PSVR_CAST2(t));
+    // Compute both inner products in one pass over t and with one reduction.
+    // Since the inner product is symmetric, (t, s) = (s, t).
+    const Vec st[2] = { s, t };
+    PetscScalar vals[2];
+    computeLocalMDot(t, 2, st, vals);
+    IBTK_MPI::sumReduction(vals, 2);
+    *dp = vals[0];
+    *nm = vals[1];
     IBTK_TIMER_STOP(t_vec_dot_norm2);
     PetscFunctionReturn(0);
 }
 
+void
+PETScSAMRAIVectorReal::computeLocalMDot(Vec x, PetscInt nv, const Vec* y, PetscScalar* val)
+{
+    if (supports_fused_kernels(*PSVR_CAST2(x)))
+    {
+        std::vector<Pointer<SAMRAIVectorReal<NDIM, double> > > y_vecs(nv);
+        for (PetscInt i = 0; i < nv; ++i) y_vecs[i] = PSVR_CAST2(y[i]);
+        fused_local_mdot(*PSVR_CAST2(x), nv, y_vecs.data(), val);
+        return;
+    }
+    static const bool local_only = true;
+    for (PetscInt i = 0; i < nv; ++i)
+    {
+        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+    }
+    return;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -25,10 +25,12 @@
 #include "libmesh/bounding_box.h"
 #endif
 #include "libmesh/dof_map.h"
+#include "libmesh/dof_object.h"
 #include "libmesh/elem.h"
 #include "libmesh/enum_elem_type.h"
 #include "libmesh/enum_order.h"
 #include "libmesh/enum_quadrature_type.h"
+#include "libmesh/equation_systems.h"
 #include "libmesh/explicit_system.h"
 #include "libmesh/fem_context.h"
 #include "libmesh/id_types.h"
@@ -54,12 +56,16 @@ IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -68,6 +74,308 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Version of the layout of the files written by collect_equation_systems_data().
+const std::int32_t EQUATION_SYSTEMS_DATA_VERSION = 1;
+
+// Name of the file containing the data of one group of processors.
+std::string
+equation_systems_data_file_name(const std::string& file_name, const int writer_num)
+{
+    return file_name + ".data." + std::to_string(writer_num);
+}
+
+template <typename T>
+inline void
+pack_value(std::vector<char>& buffer, const T& value)
+{
+    const char* const ptr = reinterpret_cast<const char*>(&value);
+    buffer.insert(buffer.end(), ptr, ptr + sizeof(T));
+}
+
+template <typename T>
+inline T
+unpack_value(const char*& ptr)
+{
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    ptr += sizeof(T);
+    return value;
+}
+
+inline void
+pack_string(std::vector<char>& buffer, const std::string& str)
+{
+    pack_value<std::uint64_t>(buffer, str.size());
+    buffer.insert(buffer.end(), str.begin(), str.end());
+}
+
+inline std::string
+unpack_string(const char*& ptr)
+{
+    const auto size = unpack_value<std::uint64_t>(ptr);
+    std::string str(ptr, ptr + size);
+    ptr += size;
+    return str;
+}
+
+// Get the DoF indices of a node or element in the order in which they are
+// stored in the data files.
+inline void
+get_dof_object_dofs(const libMesh::DofObject& dof_object,
+                    const unsigned int sys_num,
+                    std::vector<libMesh::dof_id_type>& dofs)
+{
+    dofs.clear();
+    for (unsigned int var = 0; var < dof_object.n_vars(sys_num); ++var)
+    {
+        for (unsigned int comp = 0; comp < dof_object.n_comp(sys_num, var); ++comp)
+        {
+            dofs.push_back(dof_object.dof_number(sys_num, var, comp));
+        }
+    }
+}
+
+/*
+ * Copy the values of all vectors of all systems at the DoFs of the local nodes
+ * and elements into a buffer. For each system the buffer contains the system
+ * name, the vector names (the solution is stored under the empty name), the
+ * number of nodes and elements and then, for each node or element, its type,
+ * id, number of DoFs, and values (ordered by vector and then by DoF). Since
+ * nodes and elements are identified by their ids the data can be read back
+ * with any partitioning.
+ */
+void
+pack_equation_systems_data(const libMesh::EquationSystems& equation_systems, std::vector<char>& buffer)
+{
+    const libMesh::MeshBase& mesh = equation_systems.get_mesh();
+    std::vector<libMesh::dof_id_type> dofs;
+    pack_value<std::uint32_t>(buffer, equation_systems.n_systems());
+    for (unsigned int sys_num = 0; sys_num < equation_systems.n_systems(); ++sys_num)
+    {
+        const libMesh::System& system = equation_systems.get_system(sys_num);
+        std::vector<std::string> vector_names{ "" };
+        std::vector<const libMesh::NumericVector<double>*> vectors{ system.solution.get() };
+        for (auto it = system.vectors_begin(); it != system.vectors_end(); ++it)
+        {
+            if (!it->second->initialized()) continue;
+            vector_names.push_back(it->first);
+            vectors.push_back(&*it->second);
+        }
+        pack_string(buffer, system.name());
+        pack_value<std::uint32_t>(buffer, vectors.size());
+        for (const std::string& vector_name : vector_names) pack_string(buffer, vector_name);
+
+        // The number of nodes and elements is filled in at the end.
+        const std::size_t n_dof_objects_pos = buffer.size();
+        std::uint64_t n_dof_objects = 0;
+        pack_value(buffer, n_dof_objects);
+        const auto pack_dof_object = [&](const libMesh::DofObject& dof_object, const char type)
+        {
+            get_dof_object_dofs(dof_object, sys_num, dofs);
+            if (dofs.empty()) return;
+            pack_value(buffer, type);
+            pack_value<std::uint64_t>(buffer, dof_object.id());
+            pack_value<std::uint32_t>(buffer, dofs.size());
+            for (const libMesh::NumericVector<double>* vec : vectors)
+            {
+                for (const libMesh::dof_id_type dof : dofs) pack_value<double>(buffer, (*vec)(dof));
+            }
+            ++n_dof_objects;
+        };
+        const auto node_end = mesh.local_nodes_end();
+        for (auto node_it = mesh.local_nodes_begin(); node_it != node_end; ++node_it)
+        {
+            pack_dof_object(**node_it, 'n');
+        }
+        const auto el_end = mesh.local_elements_end();
+        for (auto el_it = mesh.local_elements_begin(); el_it != el_end; ++el_it)
+        {
+            pack_dof_object(**el_it, 'e');
+        }
+        std::memcpy(&buffer[n_dof_objects_pos], &n_dof_objects, sizeof(n_dof_objects));
+    }
+}
+
+/*
+ * Set the values of the local DoFs of the vectors of one system from the data
+ * of that system written by pack_equation_systems_data() and advance the
+ * pointer past these data. Systems and vectors which do not exist are skipped.
+ */
+void
+unpack_system_data(libMesh::EquationSystems& equation_systems, const char*& ptr)
+{
+    const libMesh::MeshBase& mesh = equation_systems.get_mesh();
+    std::vector<libMesh::dof_id_type> dofs;
+    const std::string system_name = unpack_string(ptr);
+    libMesh::System* const system =
+        equation_systems.has_system(system_name) ? &equation_systems.get_system(system_name) : nullptr;
+    const auto n_vectors = unpack_value<std::uint32_t>(ptr);
+    std::vector<libMesh::NumericVector<double>*> vectors(n_vectors, nullptr);
+    for (std::uint32_t v = 0; v < n_vectors; ++v)
+    {
+        const std::string vector_name = unpack_string(ptr);
+        if (!system) continue;
+        if (vector_name.empty())
+            vectors[v] = system->solution.get();
+        else if (system->have_vector(vector_name))
+            vectors[v] = &system->get_vector(vector_name);
+    }
+
+    const auto n_dof_objects = unpack_value<std::uint64_t>(ptr);
+    for (std::uint64_t i = 0; i < n_dof_objects; ++i)
+    {
+        const auto type = unpack_value<char>(ptr);
+        const auto id = static_cast<libMesh::dof_id_type>(unpack_value<std::uint64_t>(ptr));
+        const auto n_dofs = unpack_value<std::uint32_t>(ptr);
+        const char* const values = ptr;
+        ptr += sizeof(double) * n_dofs * n_vectors;
+        if (!system) continue;
+
+        const libMesh::DofObject* const dof_object =
+            type == 'n' ? static_cast<const libMesh::DofObject*>(mesh.query_node_ptr(id)) :
+                          static_cast<const libMesh::DofObject*>(mesh.query_elem_ptr(id));
+        if (!dof_object || dof_object->processor_id() != mesh.processor_id()) continue;
+        get_dof_object_dofs(*dof_object, system->number(), dofs);
+        if (dofs.size() != n_dofs)
+        {
+            TBOX_ERROR("IBTK::read_equation_systems_data(): the data of system "
+                       << system_name << " does not match the current DoF layout." << std::endl);
+        }
+        for (std::uint32_t v = 0; v < n_vectors; ++v)
+        {
+            if (!vectors[v]) continue;
+            for (std::uint32_t j = 0; j < n_dofs; ++j)
+            {
+                double value;
+                std::memcpy(&value, values + sizeof(double) * (v * n_dofs + j), sizeof(double));
+                vectors[v]->set(dofs[j], value);
+            }
+        }
+    }
+}
+
+/*
+ * Split the data of one rank written by pack_equation_systems_data() by the
+ * ranks which own the nodes and elements in the current partitioning and
+ * append them to the buffers of those ranks. Each buffer is a sequence of
+ * system data, as read by unpack_system_data(). The data of nodes and elements
+ * which are not known on this rank (i.e., with a distributed mesh) are
+ * appended to the buffers of all ranks.
+ */
+void
+split_equation_systems_data(const libMesh::EquationSystems& equation_systems,
+                            const char* ptr,
+                            std::vector<std::vector<char> >& buffers)
+{
+    const libMesh::MeshBase& mesh = equation_systems.get_mesh();
+    const auto n_ranks = static_cast<libMesh::processor_id_type>(buffers.size());
+    std::vector<std::size_t> n_dof_objects_pos(n_ranks);
+    std::vector<std::uint64_t> n_dof_objects(n_ranks);
+    const auto n_systems = unpack_value<std::uint32_t>(ptr);
+    for (std::uint32_t k = 0; k < n_systems; ++k)
+    {
+        // The system header is copied to a buffer when the first node or
+        // element of the system is appended to it.
+        const char* const header_begin = ptr;
+        unpack_string(ptr);
+        const auto n_vectors = unpack_value<std::uint32_t>(ptr);
+        for (std::uint32_t v = 0; v < n_vectors; ++v) unpack_string(ptr);
+        const char* const header_end = ptr;
+        std::fill(n_dof_objects.begin(), n_dof_objects.end(), 0);
+        const auto append_dof_object = [&](const libMesh::processor_id_type dest, const char* begin, const char* end)
+        {
+            std::vector<char>& buffer = buffers[dest];
+            if (n_dof_objects[dest] == 0)
+            {
+                buffer.insert(buffer.end(), header_begin, header_end);
+                n_dof_objects_pos[dest] = buffer.size();
+                pack_value<std::uint64_t>(buffer, 0);
+            }
+            buffer.insert(buffer.end(), begin, end);
+            ++n_dof_objects[dest];
+            std::memcpy(&buffer[n_dof_objects_pos[dest]], &n_dof_objects[dest], sizeof(std::uint64_t));
+        };
+
+        const auto n_system_dof_objects = unpack_value<std::uint64_t>(ptr);
+        for (std::uint64_t i = 0; i < n_system_dof_objects; ++i)
+        {
+            const char* const dof_object_begin = ptr;
+            const auto type = unpack_value<char>(ptr);
+            const auto id = static_cast<libMesh::dof_id_type>(unpack_value<std::uint64_t>(ptr));
+            const auto n_dofs = unpack_value<std::uint32_t>(ptr);
+            ptr += sizeof(double) * n_dofs * n_vectors;
+
+            const libMesh::DofObject* const dof_object =
+                type == 'n' ? static_cast<const libMesh::DofObject*>(mesh.query_node_ptr(id)) :
+                              static_cast<const libMesh::DofObject*>(mesh.query_elem_ptr(id));
+            if (dof_object && dof_object->processor_id() < n_ranks)
+            {
+                append_dof_object(dof_object->processor_id(), dof_object_begin, ptr);
+            }
+            else
+            {
+                for (libMesh::processor_id_type dest = 0; dest < n_ranks; ++dest)
+                {
+                    append_dof_object(dest, dof_object_begin, ptr);
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Send each rank its buffer and receive the buffers sent to this rank by all
+ * ranks. Buffers may be larger than the largest message supported by MPI, so
+ * they are sent in chunks.
+ */
+std::vector<std::vector<char> >
+exchange_buffers(std::vector<std::vector<char> >& send_buffers, MPI_Comm comm)
+{
+    const int n_ranks = static_cast<int>(send_buffers.size());
+    std::vector<std::uint64_t> send_sizes(n_ranks), recv_sizes(n_ranks);
+    for (int k = 0; k < n_ranks; ++k) send_sizes[k] = send_buffers[k].size();
+    int ierr = MPI_Alltoall(send_sizes.data(), 1, MPI_UINT64_T, recv_sizes.data(), 1, MPI_UINT64_T, comm);
+    TBOX_ASSERT(ierr == MPI_SUCCESS);
+
+    const std::uint64_t max_chunk_size = std::numeric_limits<int>::max();
+    std::vector<std::vector<char> > recv_buffers(n_ranks);
+    std::vector<MPI_Request> requests;
+    for (int k = 0; k < n_ranks; ++k)
+    {
+        recv_buffers[k].resize(recv_sizes[k]);
+        for (std::uint64_t offset = 0; offset < recv_sizes[k]; offset += max_chunk_size)
+        {
+            requests.emplace_back();
+            ierr = MPI_Irecv(recv_buffers[k].data() + offset,
+                             static_cast<int>(std::min(max_chunk_size, recv_sizes[k] - offset)),
+                             MPI_CHAR,
+                             k,
+                             0,
+                             comm,
+                             &requests.back());
+            TBOX_ASSERT(ierr == MPI_SUCCESS);
+        }
+        for (std::uint64_t offset = 0; offset < send_sizes[k]; offset += max_chunk_size)
+        {
+            requests.emplace_back();
+            ierr = MPI_Isend(send_buffers[k].data() + offset,
+                             static_cast<int>(std::min(max_chunk_size, send_sizes[k] - offset)),
+                             MPI_CHAR,
+                             k,
+                             0,
+                             comm,
+                             &requests.back());
+            TBOX_ASSERT(ierr == MPI_SUCCESS);
+        }
+    }
+    ierr = MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+    TBOX_ASSERT(ierr == MPI_SUCCESS);
+    return recv_buffers;
+}
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 void
 setup_system_vectors(libMesh::EquationSystems* equation_systems,
@@ -570,6 +878,154 @@ get_global_element_bounding_boxes(const libMesh::MeshBase& mesh, const libMesh::
                   "work correctly.");
     return get_global_element_bounding_boxes(mesh, get_local_element_bounding_boxes(mesh, X_system));
 } // get_global_element_bounding_boxes
+
+std::vector<std::pair<std::string, std::vector<char> > >
+collect_equation_systems_data(const libMesh::EquationSystems& equation_systems,
+                              const std::string& file_name,
+                              const int ranks_per_writer)
+{
+    TBOX_ASSERT(ranks_per_writer > 0);
+    std::vector<char> buffer;
+    pack_equation_systems_data(equation_systems, buffer);
+    if (buffer.size() > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+    {
+        TBOX_ERROR("IBTK::collect_equation_systems_data():\n"
+                   << "  data of a single rank must be smaller than 2 GB" << std::endl);
+    }
+
+    // Collect the buffers of each group of ranks_per_writer ranks on the first
+    // rank of the group.
+    const libMesh::Parallel::Communicator& comm = equation_systems.comm();
+    const int rank = comm.rank();
+    const int n_ranks = comm.size();
+    const int writer_num = rank / ranks_per_writer;
+    const int n_writers = (n_ranks + ranks_per_writer - 1) / ranks_per_writer;
+    MPI_Comm group_comm;
+    int ierr = MPI_Comm_split(comm.get(), writer_num, rank, &group_comm);
+    TBOX_ASSERT(ierr == MPI_SUCCESS);
+    int group_rank = 0, group_size = 0;
+    MPI_Comm_rank(group_comm, &group_rank);
+    MPI_Comm_size(group_comm, &group_size);
+
+    const int buffer_size = static_cast<int>(buffer.size());
+    std::vector<int> buffer_sizes(group_size), buffer_offsets(group_size);
+    ierr = MPI_Gather(&buffer_size, 1, MPI_INT, buffer_sizes.data(), 1, MPI_INT, 0, group_comm);
+    TBOX_ASSERT(ierr == MPI_SUCCESS);
+
+    // The file starts with the version, the number of files, the number of
+    // blocks (i.e., ranks in the group), and the size of each block.
+    std::vector<char> file_data;
+    std::size_t header_size = 0;
+    if (group_rank == 0)
+    {
+        pack_value(file_data, EQUATION_SYSTEMS_DATA_VERSION);
+        pack_value<std::int32_t>(file_data, n_writers);
+        pack_value<std::int32_t>(file_data, group_size);
+        std::size_t total_size = 0;
+        for (int k = 0; k < group_size; ++k)
+        {
+            pack_value<std::uint64_t>(file_data, buffer_sizes[k]);
+            buffer_offsets[k] = static_cast<int>(total_size);
+            total_size += buffer_sizes[k];
+        }
+        if (total_size > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+        {
+            TBOX_ERROR("IBTK::collect_equation_systems_data():\n"
+                       << "  data of a single writer must be smaller than 2 GB: decrease ranks_per_writer"
+                       << std::endl);
+        }
+        header_size = file_data.size();
+        file_data.resize(header_size + total_size);
+    }
+    ierr = MPI_Gatherv(buffer.data(),
+                       buffer_size,
+                       MPI_CHAR,
+                       file_data.data() + header_size,
+                       buffer_sizes.data(),
+                       buffer_offsets.data(),
+                       MPI_CHAR,
+                       0,
+                       group_comm);
+    TBOX_ASSERT(ierr == MPI_SUCCESS);
+    MPI_Comm_free(&group_comm);
+
+    std::vector<std::pair<std::string, std::vector<char> > > files;
+    if (group_rank == 0)
+    {
+        files.emplace_back(equation_systems_data_file_name(file_name, writer_num), std::move(file_data));
+    }
+    return files;
+} // collect_equation_systems_data
+
+void
+read_equation_systems_data(libMesh::EquationSystems& equation_systems, const std::string& file_name)
+{
+    // The files are assigned to the ranks in a round-robin fashion. Each file
+    // is read by a single rank, which sends every rank only the data of the
+    // nodes and elements it owns. Since the number of files is stored in the
+    // files, it is read from the first file and broadcast to all ranks.
+    const libMesh::Parallel::Communicator& comm = equation_systems.comm();
+    const int rank = comm.rank();
+    const int n_ranks = comm.size();
+    std::vector<std::vector<char> > send_buffers(n_ranks);
+    const auto read_file = [&](const std::int32_t writer_num) -> std::int32_t
+    {
+        const std::string data_file_name = equation_systems_data_file_name(file_name, writer_num);
+        std::ifstream in(data_file_name, std::ios::binary);
+        if (!in)
+        {
+            TBOX_ERROR("IBTK::read_equation_systems_data(): unable to open the data file " << data_file_name
+                                                                                          << std::endl);
+        }
+        const std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+        const char* ptr = data.data();
+        if (unpack_value<std::int32_t>(ptr) != EQUATION_SYSTEMS_DATA_VERSION)
+        {
+            TBOX_ERROR("IBTK::read_equation_systems_data(): data file " << data_file_name
+                                                                       << " has an unknown version." << std::endl);
+        }
+        const auto n_writers = unpack_value<std::int32_t>(ptr);
+        const auto n_blocks = unpack_value<std::int32_t>(ptr);
+        std::vector<std::uint64_t> block_sizes(n_blocks);
+        for (auto& block_size : block_sizes) block_size = unpack_value<std::uint64_t>(ptr);
+        for (const std::uint64_t block_size : block_sizes)
+        {
+            split_equation_systems_data(equation_systems, ptr, send_buffers);
+            ptr += block_size;
+        }
+        return n_writers;
+    };
+
+    std::int32_t n_writers = 0;
+    if (rank == 0) n_writers = read_file(0);
+    int ierr = MPI_Bcast(&n_writers, 1, MPI_INT32_T, 0, comm.get());
+    TBOX_ASSERT(ierr == MPI_SUCCESS);
+    for (std::int32_t writer_num = rank; writer_num < n_writers; writer_num += n_ranks)
+    {
+        if (writer_num != 0) read_file(writer_num);
+    }
+
+    const std::vector<std::vector<char> > recv_buffers = exchange_buffers(send_buffers, comm.get());
+    send_buffers.clear();
+    for (const std::vector<char>& buffer : recv_buffers)
+    {
+        const char* ptr = buffer.data();
+        const char* const end = ptr + buffer.size();
+        while (ptr != end) unpack_system_data(equation_systems, ptr);
+    }
+
+    for (unsigned int sys_num = 0; sys_num < equation_systems.n_systems(); ++sys_num)
+    {
+        libMesh::System& system = equation_systems.get_system(sys_num);
+        system.solution->close();
+        for (auto it = system.vectors_begin(); it != system.vectors_end(); ++it)
+        {
+            if (it->second->initialized()) it->second->close();
+        }
+        system.update();
+    }
+} // read_equation_systems_data
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
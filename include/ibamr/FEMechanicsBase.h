@@ -38,6 +38,7 @@
 #include "libmesh/equation_systems.h"
 #include "libmesh/explicit_system.h"
 
+#include <future>
 #include <string>
 #include <utility>
 
@@ -54,6 +55,23 @@ namespace IBAMR
  *   <li>FEProjector: Input database passed along to the object responsible for
  *     computing projections onto the finite element space. See the
  *     documentation of IBTK::FEProjector for more information.</li>
+ *   <li>num_assembly_threads: Number of OpenMP threads used to assemble the
+ *     contributions of the PK1 stress functions to the interior force density.
+ *     Defaults to 1. Values larger than 1 require that the PK1 stress functions
+ *     be thread-safe.</li>
+ *   <li>cache_reference_geometry: Whether or not to precompute and store the
+ *     reference configuration geometry (Jacobians and inverse Jacobians) of
+ *     affine elements, which is then reused by all finite element calculations
+ *     on the interiors of elements (e.g., force assembly and L2 projections)
+ *     instead of being recomputed at every time step. See
+ *     IBTK::FEGeometryCache for more information. Defaults to false.</li>
+ *   <li>async_restart_write: Whether or not writeFEDataToRestartFile() should
+ *     write the finite element data in the background while the computation
+ *     continues. See writeFEDataToRestartFile() for more information. Defaults
+ *     to false.</li>
+ *   <li>restart_ranks_per_writer: Number of consecutive MPI ranks whose
+ *     finite element data is collected and written to a single file when
+ *     async_restart_write is true. Defaults to 1.</li>
  * </ol>
  */
 class FEMechanicsBase : public SAMRAI::tbox::Serializable
@@ -233,8 +251,30 @@ public:
      */
     using PK1StressFcnPtr = IBTK::TensorMeshFcnPtr;
 
+    /*!
+     * Typedef specifying interface for the linearization of a PK1 stress
+     * tensor function: the function must compute the derivative dPP of the
+     * stress at FF in the direction dFF. The remaining arguments are the same
+     * as those of the stress function itself.
+     */
+    using PK1StressJacobianFcnPtr =
+        void (*)(libMesh::TensorValue<double>& dPP,
+                 const libMesh::TensorValue<double>& FF,
+                 const libMesh::TensorValue<double>& dFF,
+                 const libMesh::Point& x,
+                 const libMesh::Point& X,
+                 libMesh::Elem* elem,
+                 const std::vector<const std::vector<double>*>& system_var_data,
+                 const std::vector<const std::vector<libMesh::VectorValue<double> >*>& system_grad_var_data,
+                 double data_time,
+                 void* ctx);
+
     /*!
      * Struct encapsulating PK1 stress tensor function data.
+     *
+     * The optional jacobian_fcn is used when computing linearized forces (see
+     * assembleLinearizedInteriorForceDensityRHS()). If it is not provided then
+     * the linearization is approximated by finite differences of fcn.
      */
     struct PK1StressFcnData
     {
@@ -242,8 +282,14 @@ public:
                          std::vector<IBTK::SystemData> system_data = {},
                          void* const ctx = nullptr,
                          const libMesh::QuadratureType& quad_type = libMesh::INVALID_Q_RULE,
-                         const libMesh::Order& quad_order = libMesh::INVALID_ORDER)
-            : fcn(fcn), system_data(std::move(system_data)), ctx(ctx), quad_type(quad_type), quad_order(quad_order)
+                         const libMesh::Order& quad_order = libMesh::INVALID_ORDER,
+                         PK1StressJacobianFcnPtr jacobian_fcn = nullptr)
+            : fcn(fcn),
+              system_data(std::move(system_data)),
+              ctx(ctx),
+              quad_type(quad_type),
+              quad_order(quad_order),
+              jacobian_fcn(jacobian_fcn)
         {
         }
 
@@ -252,6 +298,7 @@ public:
         void* ctx;
         libMesh::QuadratureType quad_type;
         libMesh::Order quad_order;
+        PK1StressJacobianFcnPtr jacobian_fcn;
     };
 
     /*!
@@ -270,6 +317,100 @@ public:
      */
     std::vector<PK1StressFcnData> getPK1StressFunction(unsigned int part = 0) const;
 
+    /*!
+     * Struct encapsulating the values at a batch of quadrature points that are
+     * passed to a batched PK1 stress function. All arrays are stored point by
+     * point: vectors are stored as NDIM consecutive values and tensors as
+     * NDIM * NDIM consecutive values in row-major order.
+     */
+    struct PK1StressBatch
+    {
+        /*!
+         * Number of quadrature points in the batch.
+         */
+        unsigned int n_points = 0;
+
+        /*!
+         * Deformation gradients FF = dx/dX.
+         */
+        const double* FF = nullptr;
+
+        /*!
+         * Current positions x.
+         */
+        const double* x = nullptr;
+
+        /*!
+         * Reference positions X.
+         */
+        const double* X = nullptr;
+
+        /*!
+         * Element containing each quadrature point.
+         */
+        libMesh::Elem* const* elems = nullptr;
+
+        /*!
+         * For each system registered with the function, the values of its
+         * interpolated variables (n_points times the number of variables).
+         */
+        std::vector<const double*> system_var_data;
+
+        /*!
+         * For each system registered with the function, the gradients of its
+         * interpolated variables (n_points times the number of gradient
+         * variables times NDIM).
+         */
+        std::vector<const double*> system_grad_var_data;
+    };
+
+    /*!
+     * Typedef specifying interface for batched PK1 stress tensor function. The
+     * function must write the stresses at all points of the batch to PP, which
+     * is zeroed before the call and uses the same layout as PK1StressBatch::FF.
+     */
+    using BatchedPK1StressFcnPtr = void (*)(double* PP, const PK1StressBatch& batch, double data_time, void* ctx);
+
+    /*!
+     * Struct encapsulating batched PK1 stress tensor function data.
+     */
+    struct BatchedPK1StressFcnData
+    {
+        BatchedPK1StressFcnData(BatchedPK1StressFcnPtr fcn = nullptr,
+                                std::vector<IBTK::SystemData> system_data = {},
+                                void* const ctx = nullptr,
+                                const libMesh::QuadratureType& quad_type = libMesh::INVALID_Q_RULE,
+                                const libMesh::Order& quad_order = libMesh::INVALID_ORDER)
+            : fcn(fcn), system_data(std::move(system_data)), ctx(ctx), quad_type(quad_type), quad_order(quad_order)
+        {
+        }
+
+        BatchedPK1StressFcnPtr fcn;
+        std::vector<IBTK::SystemData> system_data;
+        void* ctx;
+        libMesh::QuadratureType quad_type;
+        libMesh::Order quad_order;
+    };
+
+    /*!
+     * Register a function to compute the first Piola-Kirchhoff stress tensor at
+     * many quadrature points at once. This is an alternative to
+     * registerPK1StressFunction() for constitutive laws that benefit from
+     * being evaluated over contiguous arrays (e.g., so that the compiler can
+     * vectorize them): each call covers the interior quadrature points of a
+     * block of elements, or the quadrature points of a single element side.
+     *
+     * @note       Batched PK1 stress functions contribute to the interior
+     *             force density only. They are not supported by force
+     *             splitting or stress normalization in IBFEMethod.
+     */
+    virtual void registerBatchedPK1StressFunction(const BatchedPK1StressFcnData& data, unsigned int part = 0);
+
+    /*!
+     * Get the batched PK1 stress function data.
+     */
+    std::vector<BatchedPK1StressFcnData> getBatchedPK1StressFunction(unsigned int part = 0) const;
+
     /*!
      * Typedef specifying interface for Lagrangian body force distribution
      * function.
@@ -496,9 +637,28 @@ public:
      *     fe_mechanics_base->writeFEDataToRestartFile(restart_dump_dirname, iteration_num);
      * }
      * @endcode
+     *
+     * If async_restart_write is set in the input database then only the
+     * (small) libMesh header describing the systems is written by libMesh. The
+     * values of all system vectors are copied into memory buffers, collected
+     * on one rank out of every restart_ranks_per_writer ranks, and written by
+     * a background thread on those ranks while the computation continues. The
+     * data is stored by node and element ids so it may be read back with a
+     * different number of processors: on restart, each data file is read by
+     * a single rank and broadcast (see IBTK::collect_equation_systems_data()
+     * and IBTK::read_equation_systems_data()). Only one write may be in
+     * progress at a time: this function and the destructor wait for the
+     * previous write to finish.
      */
     virtual void writeFEDataToRestartFile(const std::string& restart_dump_dirname, unsigned int time_step_number);
 
+    /*!
+     * Wait for the data written by the last call to writeFEDataToRestartFile()
+     * to be on disk. This function does nothing unless async_restart_write is
+     * set in the input database.
+     */
+    void waitForFEDataRestartFileWrite();
+
 protected:
     /*!
      * Do the actual work in initializeFEEquationSystems.
@@ -547,6 +707,23 @@ protected:
                                                  double data_time,
                                                  unsigned int part);
 
+    /*!
+     * Assemble the RHS for the linearization of the interior elastic force
+     * density about the configuration X_vec in the direction dX_vec, i.e., the
+     * action of the Jacobian of the elastic force on dX_vec. The surface terms
+     * are treated in the same way as in assembleInteriorForceDensityRHS().
+     *
+     * The linearized stresses are computed by the jacobian_fcn of each PK1
+     * stress function or, if it is not provided, by centered differences of
+     * the stress function at each quadrature point. Pressure contributions are
+     * not included and batched PK1 stress functions are not supported.
+     */
+    virtual void assembleLinearizedInteriorForceDensityRHS(libMesh::PetscVector<double>& dF_rhs_vec,
+                                                           libMesh::PetscVector<double>& dX_vec,
+                                                           libMesh::PetscVector<double>& X_vec,
+                                                           double data_time,
+                                                           unsigned int part);
+
     /*!
      * Initialize the physical coordinates using the supplied coordinate mapping
      * function.  If no function is provided, the initial coordinates are taken
@@ -702,6 +879,8 @@ protected:
     std::vector<libMesh::Order> d_default_quad_order_stress, d_default_quad_order_force, d_default_quad_order_pressure;
     bool d_use_consistent_mass_matrix = true;
     bool d_allow_rules_with_negative_weights = true;
+    int d_num_assembly_threads = 1;
+    bool d_cache_reference_geometry = false;
     bool d_include_normal_stress_in_weak_form = false;
     bool d_include_tangential_stress_in_weak_form = false;
     bool d_include_normal_surface_forces_in_weak_form = true;
@@ -721,6 +900,7 @@ protected:
      * Functions used to compute the first Piola-Kirchhoff stress tensor.
      */
     std::vector<std::vector<PK1StressFcnData> > d_PK1_stress_fcn_data;
+    std::vector<std::vector<BatchedPK1StressFcnData> > d_batched_PK1_stress_fcn_data;
 
     /*!
      * Functions used to compute additional body and surface forces on the
@@ -771,6 +951,25 @@ protected:
      */
     std::string d_libmesh_restart_file_extension;
 
+    /*!
+     * Whether or not to write restart data asynchronously and the number of
+     * ranks whose data is written by one rank in that case.
+     */
+    bool d_async_restart_write = false;
+    int d_restart_ranks_per_writer = 1;
+
+    /*!
+     * Whether or not the restart data we are reading was written
+     * asynchronously.
+     */
+    bool d_async_restart_read = false;
+
+    /*!
+     * Result of the pending asynchronous restart write (an error message,
+     * which is empty on success), if any.
+     */
+    std::future<std::string> d_pending_restart_write;
+
 private:
     /*!
      * Implementation of class constructor.
@@ -171,6 +171,9 @@ class IBFEDirectForcingKinematics;
  *   <li><code>spread_use_nodal_quadrature</code>: Same as above, but for spreading.
  *   <li><code>IB_use_nodal_quadrature</code>: overriding alias for the two previous
  *   entries - has the same default.</li>
+ *   <li><code>LEInteractor</code>: a sub-database passed to
+ *   IBTK::LEInteractor::setFromDatabase(), e.g., to enable threaded
+ *   spreading.</li>
  * </ul>
  *
  * <h2>Options Controlling libMesh Partitioning</h2>
@@ -669,6 +672,26 @@ public:
      */
     void computeLagrangianForce(double data_time) override;
 
+    /*!
+     * Compute the linearization of the Lagrangian force about the structure
+     * configuration at the specified time in the direction dX = dt * U, in
+     * which U is the velocity of the structure at the specified time. The
+     * result replaces the force at the specified time.
+     *
+     * This provides the action of the Jacobian of the IB force operator
+     * without finite differencing the complete force: calling
+     * interpolateVelocity(), this function, and then spreadForce() (all with
+     * the same data time) applies dt * S A S^* to an Eulerian velocity field,
+     * in which S is the spreading operator and A is the Jacobian of the
+     * elastic force. See
+     * FEMechanicsBase::assembleLinearizedInteriorForceDensityRHS() for how the
+     * stresses are linearized.
+     *
+     * @note Direct forcing kinematics, pressure parts, and surface forces are
+     * not included in the linearization.
+     */
+    void computeLinearizedLagrangianForce(double dt, double data_time);
+
     /*!
      * Spread the Lagrangian force to the Cartesian grid at the specified time
      * within the current time interval.
@@ -966,7 +989,7 @@ protected:
     int d_max_level_number = IBTK::invalid_level_number;
 
     /// CFL-like number used to determine when we should call
-    /// reinitElementMappings() based on maximum structure point displacement.
+    /// updateElementMappings() based on maximum structure point displacement.
     /// More exactly: this class will call that function if the maximum
     /// displacement of the structure (calculated by comparing the position
     /// vector as of the last reassociation to the current position vector)
@@ -1133,6 +1156,15 @@ private:
      * scratch hierarchy).
      */
     void reinitElementMappings();
+
+    /*!
+     * Convenience function that updates the patch-to-element mappings on all
+     * relevant FEDataManagers after the structure has moved. Unlike
+     * reinitElementMappings(), this only reassociates elements that have moved
+     * into different Cartesian grid cells and hence must not be used after
+     * regridding.
+     */
+    void updateElementMappings();
 };
 } // namespace IBAMR
 
@@ -600,6 +600,8 @@ protected:
     IBTK::LDataManager* d_l_data_manager;
     std::string d_interp_kernel_fcn = "IB_4", d_spread_kernel_fcn = "IB_4";
     bool d_error_if_points_leave_domain = false;
+    bool d_use_morton_ordering = false;
+    bool d_use_incremental_redistribution = false;
     SAMRAI::hier::IntVector<NDIM> d_ghosts;
 
     /*
@@ -92,6 +92,17 @@ public:
                                      const SpringForceFcnPtr spring_force_fcn_ptr,
                                      const SpringForceDerivFcnPtr spring_force_deriv_fcn_ptr = nullptr);
 
+    /*!
+     * \brief Copy the spring parameters stored in the IBSpringForceSpec objects
+     * on the specified level of the patch hierarchy.
+     *
+     * The stiffnesses, resting lengths, and other parameters of the springs are
+     * copied into contiguous arrays when the level data are initialized. This
+     * method must be called after modifying the parameters of existing springs
+     * for the changes to take effect before the next regrid.
+     */
+    void resetSpringParameters(int level_number, IBTK::LDataManager* l_data_manager);
+
     /*!
      * \brief Set a uniform body force that is applied on each point in the
      * structure with the given structure_id.
@@ -196,7 +207,20 @@ private:
         std::vector<int> petsc_global_mastr_node_idxs, petsc_global_slave_node_idxs;
         std::vector<SpringForceFcnPtr> force_fcns;
         std::vector<SpringForceDerivFcnPtr> force_deriv_fcns;
-        std::vector<const double*> parameters;
+
+        /*
+         * The parameters of spring k are stored in parameters[parameter_offsets[k]],
+         * ..., parameters[parameter_offsets[k + 1] - 1].
+         */
+        std::vector<double> parameters;
+        std::vector<int> parameter_offsets;
+
+        /*
+         * The springs that use default_spring_force() are stored first. Their
+         * stiffnesses and resting lengths are also stored separately.
+         */
+        int num_default_springs = 0;
+        std::vector<double> stiffnesses, rest_lengths;
     };
     std::vector<SpringData> d_spring_data;
 
@@ -24,6 +24,7 @@
 
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
+#include "ibtk/LMesh.h"
 
 #include "CartesianGridGeometry.h"
 #include "IntVector.h"
@@ -68,7 +69,28 @@ public:
     // parameters are passed in the double* params.
     using NonBddForceFcnPtr = void (*)(double* D, const SAMRAI::tbox::Array<double> params, double* out_force);
 
+    // Nonbonded force function pointer that takes the parameters as a plain
+    // array, so that no parameter array is copied for each pair of nodes.
+    using NonBddRawForceFcnPtr = void (*)(const double* D, const double* params, double* out_force);
+
     // Class constructor.
+    //
+    // The input database must provide interaction_radius, regrid_alpha, and
+    // parameters. interaction_radius and regrid_alpha are given in units of
+    // the grid spacing of the level: the force function is evaluated for (at
+    // least) every pair of nodes that are less than interaction_radius grid
+    // cells apart in each direction, so the force function must vanish
+    // beyond that distance.
+    //
+    // The input database may also set use_neighbor_list = TRUE to evaluate
+    // forces from a Verlet neighbor list. The list holds every pair of nodes
+    // that are less than interaction_radius + neighbor_list_skin grid cells
+    // apart in each direction (neighbor_list_skin is also given in units of
+    // the grid spacing). The list is rebuilt on all processors as soon as a
+    // node on any processor has moved more than half of the skin in some
+    // direction or the Lagrangian data have been redistributed. The ghost cell
+    // width of the Lagrangian index data must be at least interaction_radius +
+    // neighbor_list_skin + 2*regrid_alpha cells.
     NonbondedForceEvaluator(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
                             SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > grid_geometry);
 
@@ -76,7 +98,7 @@ public:
     void evaluateForces(int mstr_petsc_idx,
                         int search_petsc_idx,
                         SAMRAI::tbox::Pointer<IBTK::LData> X_data,
-                        std::vector<int> cell_offset,
+                        const std::vector<int>& cell_offset,
                         SAMRAI::tbox::Pointer<IBTK::LData> F_data);
 
     // Implementation of computeLagrangianForce.
@@ -91,6 +113,11 @@ public:
     // Register the force function used
     void registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr);
 
+    // Register the force function used, taking the parameters as a plain
+    // array. This takes precedence over a function registered with the other
+    // overload.
+    void registerForceFcnPtr(NonBddRawForceFcnPtr force_fcn_ptr);
+
 private:
     // Default constructor, not implemented.
     NonbondedForceEvaluator() = delete;
@@ -101,6 +128,15 @@ private:
     // Assignment operator, not implemented.
     NonbondedForceEvaluator& operator=(const NonbondedForceEvaluator& that) = delete;
 
+    // Build the neighbor list for the specified level.
+    void buildNeighborList(SAMRAI::tbox::Pointer<IBTK::LData> X_data,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                           int level_number,
+                           IBTK::LDataManager* l_data_manager);
+
+    // Evaluate the force function for the vector D between two nodes.
+    void evaluateForceFcn(double* D, double* out_force) const;
+
     // interaction radius:
     double d_interaction_radius;
 
@@ -115,7 +151,33 @@ private:
 
     // spring force function pointer, to evaluate the force between particles:
     // TODO: Add species, make this a map from species1 x species2 -> Force Function Pointer
-    NonBddForceFcnPtr d_force_fcn_ptr;
+    NonBddForceFcnPtr d_force_fcn_ptr = nullptr;
+    NonBddRawForceFcnPtr d_raw_force_fcn_ptr = nullptr;
+
+    // neighbor list settings:
+    bool d_use_neighbor_list = false;
+    double d_neighbor_list_skin = 0.0;
+
+    // A pair of nodes in the neighbor list, given by their local PETSc indices
+    // and the periodic shift of the search node.
+    struct NeighborPair
+    {
+        int mstr_petsc_idx, search_petsc_idx;
+        double shift[NDIM];
+    };
+
+    // Neighbor list data maintained separately for each level of the patch
+    // hierarchy. Pairs in which both nodes are local are stored in
+    // local_pairs; pairs whose search node is a ghost node are stored in
+    // nonlocal_pairs, and only the force on the master node is computed for
+    // them since the other processor computes the force on the search node.
+    struct NeighborList
+    {
+        SAMRAI::tbox::Pointer<IBTK::LMesh> mesh;
+        std::vector<double> X_build;
+        std::vector<NeighborPair> local_pairs, nonlocal_pairs;
+    };
+    std::vector<NeighborList> d_neighbor_lists;
 };
 } // namespace IBAMR
 
@@ -69,7 +69,19 @@
 #include "libmesh/variant_filter_iterator.h"
 #include "libmesh/vector_value.h"
 
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <limits>
+#include <memory>
 #include <utility>
+#include <vector>
+
+#ifdef IBTK_HAVE_OPENMP
+#include <omp.h>
+#endif
 
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
@@ -85,6 +97,115 @@ namespace
 const int FE_MECHANICS_BASE_VERSION = 1;
 
 static Timer* t_assemble_interior_force_density_rhs;
+static Timer* t_assemble_linearized_interior_force_density_rhs;
+
+/**
+ * Get the current thread number, which is zero if IBAMR was compiled without
+ * OpenMP.
+ */
+inline int
+get_thread_num()
+{
+#ifdef IBTK_HAVE_OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+// Maximum number of elements whose interior quadrature points are passed to a
+// batched PK1 stress function in a single call.
+const unsigned int BATCHED_PK1_MAX_ELEMS = 64;
+
+/*
+ * Storage for the values at a batch of quadrature points in the layout
+ * expected by batched PK1 stress functions.
+ */
+class PK1StressBatchBuffer
+{
+public:
+    void clear()
+    {
+        d_FF.clear();
+        d_x.clear();
+        d_X.clear();
+        d_elems.clear();
+        for (auto& var_data : d_var_data) var_data.clear();
+        for (auto& grad_var_data : d_grad_var_data) grad_var_data.clear();
+    }
+
+    unsigned int size() const
+    {
+        return static_cast<unsigned int>(d_elems.size());
+    }
+
+    void addPoint(const TensorValue<double>& FF,
+                  const VectorValue<double>& x,
+                  const libMesh::Point& X,
+                  Elem* const elem,
+                  const std::vector<const std::vector<double>*>& var_data,
+                  const std::vector<const std::vector<VectorValue<double> >*>& grad_var_data)
+    {
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            for (unsigned int j = 0; j < NDIM; ++j)
+            {
+                d_FF.push_back(FF(i, j));
+            }
+            d_x.push_back(x(i));
+            d_X.push_back(X(i));
+        }
+        d_elems.push_back(elem);
+        d_var_data.resize(var_data.size());
+        for (std::size_t k = 0; k < var_data.size(); ++k)
+        {
+            d_var_data[k].insert(d_var_data[k].end(), var_data[k]->begin(), var_data[k]->end());
+        }
+        d_grad_var_data.resize(grad_var_data.size());
+        for (std::size_t k = 0; k < grad_var_data.size(); ++k)
+        {
+            for (const VectorValue<double>& grad : *grad_var_data[k])
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    d_grad_var_data[k].push_back(grad(d));
+                }
+            }
+        }
+    }
+
+    /*
+     * Evaluate the sum of the stresses computed by all of the provided
+     * functions at the points of the batch. Stresses are stored in the same
+     * layout as the deformation gradients.
+     */
+    const std::vector<double>&
+    evaluate(const std::vector<FEMechanicsBase::BatchedPK1StressFcnData>& fcns, const double data_time)
+    {
+        FEMechanicsBase::PK1StressBatch batch;
+        batch.n_points = size();
+        batch.FF = d_FF.data();
+        batch.x = d_x.data();
+        batch.X = d_X.data();
+        batch.elems = d_elems.data();
+        for (const auto& var_data : d_var_data) batch.system_var_data.push_back(var_data.data());
+        for (const auto& grad_var_data : d_grad_var_data) batch.system_grad_var_data.push_back(grad_var_data.data());
+
+        d_PP.assign(d_FF.size(), 0.0);
+        for (const auto& fcn_data : fcns)
+        {
+            d_PP_scratch.assign(d_FF.size(), 0.0);
+            fcn_data.fcn(d_PP_scratch.data(), batch, data_time, fcn_data.ctx);
+            for (std::size_t i = 0; i < d_PP.size(); ++i) d_PP[i] += d_PP_scratch[i];
+        }
+        return d_PP;
+    }
+
+private:
+    std::vector<double> d_FF, d_x, d_X, d_PP, d_PP_scratch;
+    std::vector<Elem*> d_elems;
+    std::vector<std::vector<double> > d_var_data, d_grad_var_data;
+};
 
 inline boundary_id_type
 get_dirichlet_bdry_ids(const std::vector<boundary_id_type>& bdry_ids)
@@ -190,6 +311,66 @@ get_Grad_U(libMesh::TensorValue<double>& Grad_U,
         }
     }
 }
+
+/*
+ * Get the step h used to difference a function of (FF + h dFF, x + h dx), in
+ * which dx is an increment of the displacement and dFF is its gradient. FF and
+ * dFF are dimensionless, so the step is chosen relative to them. If the
+ * increment is a rigid translation (dFF = 0) then the step is instead chosen
+ * relative to x and dx, which both have units of length. Returns zero if the
+ * increment is zero.
+ */
+double
+get_linearization_step(const TensorValue<double>& FF,
+                       const TensorValue<double>& dFF,
+                       const VectorValue<double>& x,
+                       const VectorValue<double>& dx)
+{
+    const double eps = std::cbrt(std::numeric_limits<double>::epsilon());
+    const double dFF_norm = dFF.norm();
+    if (dFF_norm > 0.0) return eps * std::max(1.0, FF.norm()) / dFF_norm;
+    const double dx_norm = dx.norm();
+    if (dx_norm > 0.0) return eps * std::max(x.norm(), dx_norm) / dx_norm;
+    return 0.0;
+}
+
+/*
+ * Compute the directional derivative dPP of the PK1 stress in the direction
+ * (dFF, dx). If the stress function does not provide its linearization then a
+ * centered difference of the stress function is used: since this only
+ * requires the stress at a single point (instead of a complete force
+ * evaluation) the step size can be chosen relative to FF.
+ */
+void
+compute_linearized_PK1_stress(TensorValue<double>& dPP,
+                              const FEMechanicsBase::PK1StressFcnData& pk1,
+                              const TensorValue<double>& FF,
+                              const TensorValue<double>& dFF,
+                              const VectorValue<double>& x,
+                              const VectorValue<double>& dx,
+                              const libMesh::Point& X,
+                              Elem* const elem,
+                              const std::vector<const std::vector<double>*>& var_data,
+                              const std::vector<const std::vector<VectorValue<double> >*>& grad_var_data,
+                              const double data_time)
+{
+    if (pk1.jacobian_fcn)
+    {
+        pk1.jacobian_fcn(dPP, FF, dFF, x, X, elem, var_data, grad_var_data, data_time, pk1.ctx);
+        return;
+    }
+
+    const double h = get_linearization_step(FF, dFF, x, dx);
+    if (h == 0.0)
+    {
+        dPP.zero();
+        return;
+    }
+    TensorValue<double> PP_plus, PP_minus;
+    pk1.fcn(PP_plus, FF + h * dFF, x + h * dx, X, elem, var_data, grad_var_data, data_time, pk1.ctx);
+    pk1.fcn(PP_minus, FF - h * dFF, x - h * dx, X, elem, var_data, grad_var_data, data_time, pk1.ctx);
+    dPP = (PP_plus - PP_minus) / (2.0 * h);
+}
 } // namespace
 
 #define COORDS_SYSTEM_NAME_VAL "IB coordinates system"
@@ -243,6 +424,7 @@ FEMechanicsBase::FEMechanicsBase(const std::string& object_name,
 
 FEMechanicsBase::~FEMechanicsBase()
 {
+    waitForFEDataRestartFileWrite();
     if (d_registered_for_restart)
     {
         RestartManager::getManager()->unregisterRestartItem(d_object_name);
@@ -316,6 +498,28 @@ FEMechanicsBase::getPK1StressFunction(unsigned int part) const
     return d_PK1_stress_fcn_data[part];
 }
 
+void
+FEMechanicsBase::registerBatchedPK1StressFunction(const BatchedPK1StressFcnData& data, const unsigned int part)
+{
+    TBOX_ASSERT(part < d_meshes.size());
+    d_batched_PK1_stress_fcn_data[part].push_back(data);
+    if (data.quad_type == INVALID_Q_RULE)
+    {
+        d_batched_PK1_stress_fcn_data[part].back().quad_type = d_default_quad_type_stress[part];
+    }
+    if (data.quad_order == INVALID_ORDER)
+    {
+        d_batched_PK1_stress_fcn_data[part].back().quad_order = d_default_quad_order_stress[part];
+    }
+}
+
+std::vector<FEMechanicsBase::BatchedPK1StressFcnData>
+FEMechanicsBase::getBatchedPK1StressFunction(unsigned int part) const
+{
+    TBOX_ASSERT(part < d_meshes.size());
+    return d_batched_PK1_stress_fcn_data[part];
+}
+
 void
 FEMechanicsBase::registerLagBodyForceFunction(const LagBodyForceFcnData& data, const unsigned int part)
 {
@@ -469,21 +673,72 @@ FEMechanicsBase::putToDatabase(Pointer<Database> db)
     db->putInteger("FE_MECHANICS_BASE_VERSION", FE_MECHANICS_BASE_VERSION);
     db->putBool("d_use_consistent_mass_matrix", d_use_consistent_mass_matrix);
     db->putString("d_libmesh_partitioner_type", enum_to_string<LibmeshPartitionerType>(d_libmesh_partitioner_type));
+    db->putBool("d_async_restart_write", d_async_restart_write);
 }
 
 void
 FEMechanicsBase::writeFEDataToRestartFile(const std::string& restart_dump_dirname, unsigned int time_step_number)
 {
+    // Only one asynchronous write may be in progress at a time.
+    waitForFEDataRestartFileWrite();
+
+    // Names and contents of the files to be written in the background by this
+    // processor.
+    std::vector<std::pair<std::string, std::vector<char> > > async_files;
     for (unsigned int part = 0; part < d_meshes.size(); ++part)
     {
         const std::string& file_name =
             libmesh_restart_file_name(restart_dump_dirname, time_step_number, part, d_libmesh_restart_file_extension);
         const XdrMODE xdr_mode = (d_libmesh_restart_file_extension == "xdr" ? ENCODE : WRITE);
-        const int write_mode = EquationSystems::WRITE_DATA | EquationSystems::WRITE_ADDITIONAL_DATA;
+        if (!d_async_restart_write)
+        {
+            const int write_mode = EquationSystems::WRITE_DATA | EquationSystems::WRITE_ADDITIONAL_DATA;
+            d_equation_systems[part]->write(file_name,
+                                            xdr_mode,
+                                            write_mode,
+                                            /*partition_agnostic*/ true);
+            continue;
+        }
+
+        // Only write the header (i.e., the description of the systems and
+        // their vectors) with libMesh: the vector data is collected on the
+        // writing ranks and written later.
         d_equation_systems[part]->write(file_name,
                                         xdr_mode,
-                                        write_mode,
+                                        EquationSystems::WRITE_ADDITIONAL_DATA,
                                         /*partition_agnostic*/ true);
+        auto part_files =
+            IBTK::collect_equation_systems_data(*d_equation_systems[part], file_name, d_restart_ranks_per_writer);
+        std::move(part_files.begin(), part_files.end(), std::back_inserter(async_files));
+    }
+
+    // The background thread only does file I/O, so it does not need any
+    // particular level of thread support from MPI.
+    if (!async_files.empty())
+    {
+        d_pending_restart_write = std::async(std::launch::async,
+                                             [async_files = std::move(async_files)]() -> std::string
+                                             {
+                                                 for (const auto& file : async_files)
+                                                 {
+                                                     std::ofstream out(file.first, std::ios::binary);
+                                                     out.write(file.second.data(), file.second.size());
+                                                     if (!out) return "unable to write " + file.first;
+                                                 }
+                                                 return std::string();
+                                             });
+    }
+}
+
+void
+FEMechanicsBase::waitForFEDataRestartFileWrite()
+{
+    if (!d_pending_restart_write.valid()) return;
+    const std::string error = d_pending_restart_write.get();
+    if (!error.empty())
+    {
+        TBOX_ERROR(d_object_name << "::waitForFEDataRestartFileWrite():\n"
+                                 << "  " << error << std::endl);
     }
 }
 
@@ -511,12 +766,17 @@ FEMechanicsBase::doInitializeFEEquationSystems()
             const std::string& file_name = libmesh_restart_file_name(
                 d_libmesh_restart_read_dir, d_libmesh_restart_restore_number, part, d_libmesh_restart_file_extension);
             const XdrMODE xdr_mode = (d_libmesh_restart_file_extension == "xdr" ? DECODE : READ);
+            // If the data was written asynchronously then the libMesh file
+            // only contains the header.
             const int read_mode =
-                EquationSystems::READ_HEADER | EquationSystems::READ_DATA | EquationSystems::READ_ADDITIONAL_DATA;
+                d_async_restart_read ?
+                    EquationSystems::READ_HEADER | EquationSystems::READ_ADDITIONAL_DATA :
+                    EquationSystems::READ_HEADER | EquationSystems::READ_DATA | EquationSystems::READ_ADDITIONAL_DATA;
             equation_systems.read(file_name,
                                   xdr_mode,
                                   read_mode,
                                   /*partition_agnostic*/ true);
+            if (d_async_restart_read) IBTK::read_equation_systems_data(equation_systems, file_name);
         }
         else
         {
@@ -656,6 +916,10 @@ FEMechanicsBase::doInitializeFEData(const bool use_present_data)
                 }
             }
         }
+
+        // The reference configuration geometry is recomputed here since the
+        // mesh may have been repartitioned.
+        d_fe_data[part]->setUseGeometryCache(d_cache_reference_geometry);
     }
 }
 
@@ -930,6 +1194,303 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
         std::vector<PK1StressFcnData> current_pk1(remaining_pk1.begin(), next_group_start);
         remaining_pk1.erase(remaining_pk1.begin(), next_group_start);
 
+        // Extract the FE systems and DOF maps, and setup the FE objects.
+        //
+        // NOTE: The FE objects and quadrature rules are reinitialized for each
+        // element, so each thread needs its own copies. These are all set up
+        // here since registering systems is not thread-safe.
+        const DofMap& F_dof_map = F_system.get_dof_map();
+        FEDataManager::SystemDofMapCache& F_dof_map_cache = *d_fe_data[part]->getDofMapCache(getForceSystemName());
+        FEType F_fe_type = F_dof_map.variable_type(0);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            TBOX_ASSERT(F_dof_map.variable_type(d) == F_fe_type);
+        }
+        auto& X_system = equation_systems.get_system<ExplicitSystem>(getCurrentCoordinatesSystemName());
+        std::vector<int> vars(NDIM);
+        for (unsigned int d = 0; d < NDIM; ++d) vars[d] = d;
+
+        const int num_threads = d_num_assembly_threads;
+        std::vector<std::unique_ptr<QBase> > qrules(num_threads), qrules_face(num_threads);
+        std::vector<std::unique_ptr<FEDataInterpolation> > fes(num_threads);
+        std::vector<std::vector<size_t> > PK1_fcn_system_idxs(num_threads);
+        size_t X_sys_idx = 0;
+        for (int thread_num = 0; thread_num < num_threads; ++thread_num)
+        {
+            qrules[thread_num] = QBase::build(exemplar_pk1.quad_type, dim, exemplar_pk1.quad_order);
+            qrules[thread_num]->allow_rules_with_negative_weights = d_allow_rules_with_negative_weights;
+            qrules_face[thread_num] = QBase::build(exemplar_pk1.quad_type, dim - 1, exemplar_pk1.quad_order);
+            qrules_face[thread_num]->allow_rules_with_negative_weights = d_allow_rules_with_negative_weights;
+            fes[thread_num] = std::make_unique<FEDataInterpolation>(dim, d_fe_data[part]);
+            FEDataInterpolation& fe = *fes[thread_num];
+            fe.attachQuadratureRule(qrules[thread_num].get());
+            fe.attachQuadratureRuleFace(qrules_face[thread_num].get());
+            fe.evalNormalsFace();
+            fe.evalQuadraturePoints();
+            fe.evalQuadraturePointsFace();
+            fe.evalQuadratureWeights();
+            fe.evalQuadratureWeightsFace();
+            fe.registerSystem(F_system, std::vector<int>(), vars); // compute dphi for the force system
+            X_sys_idx = fe.registerInterpolatedSystem(X_system, vars, vars, &X_vec);
+            fe.setupInterpolatedSystemDataIndexes(
+                PK1_fcn_system_idxs[thread_num], exemplar_pk1.system_data, &equation_systems);
+            fe.init();
+        }
+
+        // Loop over the elements to compute the right-hand side vector.  This
+        // is computed via
+        //
+        //    rhs_k = -int{PP(s,t) grad phi_k(s)}ds + int{PP(s,t) N(s,t)
+        //    phi_k(s)}dA(s)
+        //
+        // This right-hand side vector is used to solve for the nodal values of
+        // the interior elastic force density.
+        //
+        // The elements in [elem_begin, elem_end) are assembled into F_rhs_soln
+        // using the FE objects of thread thread_num.
+        const auto assemble_elements = [&](const int thread_num,
+                                           const std::vector<Elem*>& elems,
+                                           const std::size_t elem_begin,
+                                           const std::size_t elem_end,
+                                           double* const F_rhs_soln)
+        {
+            FEDataInterpolation& fe = *fes[thread_num];
+            const QBase& qrule = *qrules[thread_num];
+            const QBase& qrule_face = *qrules_face[thread_num];
+            const std::vector<libMesh::Point>& q_point = fe.getQuadraturePoints();
+            const std::vector<double>& JxW = fe.getQuadratureWeights();
+            const std::vector<std::vector<VectorValue<double> > >& dphi = fe.getDphi(F_fe_type);
+
+            const std::vector<libMesh::Point>& q_point_face = fe.getQuadraturePointsFace();
+            const std::vector<double>& JxW_face = fe.getQuadratureWeightsFace();
+            const std::vector<libMesh::Point>& normal_face = fe.getNormalsFace();
+            const std::vector<std::vector<double> >& phi_face = fe.getPhiFace(F_fe_type);
+
+            const std::vector<std::vector<std::vector<double> > >& fe_interp_var_data = fe.getVarInterpolation();
+            const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data =
+                fe.getGradVarInterpolation();
+
+            std::vector<const std::vector<double>*> PK1_var_data;
+            std::vector<const std::vector<VectorValue<double> >*> PK1_grad_var_data;
+            std::array<DenseVector<double>, NDIM> F_rhs_e;
+            std::vector<libMesh::dof_id_type> dof_id_scratch;
+
+            TensorValue<double> PP, FF, FF_inv_trans;
+            VectorValue<double> F, F_qp, n, x;
+            for (std::size_t e_idx = elem_begin; e_idx < elem_end; ++e_idx)
+            {
+                Elem* const elem = elems[e_idx];
+                fe.reinit(elem);
+
+                // NOTE: The DoF caches are filled on demand and the system
+                // vectors are accessed through libMesh, neither of which is
+                // thread-safe.
+                const boost::multi_array<libMesh::dof_id_type, 2>* F_dof_indices_ptr = nullptr;
+#ifdef IBTK_HAVE_OPENMP
+#pragma omp critical(fe_mechanics_assemble_interior_force_density_rhs)
+#endif
+                {
+                    F_dof_indices_ptr = &F_dof_map_cache.dof_indices(elem);
+                    fe.collectDataForInterpolation(elem);
+                }
+                const auto& F_dof_indices = *F_dof_indices_ptr;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    F_rhs_e[d].resize(static_cast<int>(F_dof_indices[d].size()));
+                }
+                fe.interpolate(elem);
+                const unsigned int n_qp = qrule.n_points();
+                const size_t n_basis = dphi.size();
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    const libMesh::Point& X = q_point[qp];
+                    const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+                    const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
+                    get_x_and_FF(x, FF, x_data, grad_x_data);
+
+                    // Compute the value of the first Piola-Kirchhoff stress
+                    // tensor at the quadrature point and add the corresponding
+                    // forces to the right-hand-side vector.
+                    fe.setInterpolatedDataPointers(
+                        PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs[thread_num], elem, qp);
+                    for (const PK1StressFcnData& pk1 : current_pk1)
+                    {
+                        pk1.fcn(PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, pk1.ctx);
+                        for (unsigned int basis_n = 0; basis_n < n_basis; ++basis_n)
+                        {
+                            F_qp = -PP * dphi[basis_n][qp] * JxW[qp];
+                            for (unsigned int i = 0; i < NDIM; ++i)
+                            {
+                                F_rhs_e[i](basis_n) += F_qp(i);
+                            }
+                        }
+                    }
+                }
+
+                // Loop over the element boundaries.
+                for (unsigned int side = 0; side < elem->n_sides(); ++side)
+                {
+                    // Skip non-physical boundaries.
+                    if (!is_physical_bdry(elem, side, boundary_info, F_dof_map)) continue;
+
+                    // Determine if we need to integrate surface forces along
+                    // this part of the physical boundary; if not, skip the
+                    // present side.
+                    const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, F_dof_map);
+                    const bool integrate_normal_stress =
+                        (d_include_normal_stress_in_weak_form && !at_dirichlet_bdry) ||
+                        (!d_include_normal_stress_in_weak_form && at_dirichlet_bdry);
+                    const bool integrate_tangential_stress =
+                        (d_include_tangential_stress_in_weak_form && !at_dirichlet_bdry) ||
+                        (!d_include_tangential_stress_in_weak_form && at_dirichlet_bdry);
+                    if (!integrate_normal_stress && !integrate_tangential_stress) continue;
+
+                    fe.reinit(elem, side);
+                    fe.interpolate(elem, side);
+                    const unsigned int n_qp_face = qrule_face.n_points();
+                    const size_t n_basis_face = phi_face.size();
+                    for (unsigned int qp = 0; qp < n_qp_face; ++qp)
+                    {
+                        const libMesh::Point& X = q_point_face[qp];
+                        const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+                        const std::vector<VectorValue<double> >& grad_x_data =
+                            fe_interp_grad_var_data[qp][X_sys_idx];
+                        get_x_and_FF(x, FF, x_data, grad_x_data);
+                        tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
+
+                        F.zero();
+
+                        // Compute the value of the first Piola-Kirchhoff stress
+                        // tensor at the quadrature point and add the
+                        // corresponding traction force to the right-hand-side
+                        // vector.
+                        fe.setInterpolatedDataPointers(
+                            PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs[thread_num], elem, qp);
+                        for (const PK1StressFcnData& pk1 : current_pk1)
+                        {
+                            pk1.fcn(PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, pk1.ctx);
+                            F += PP * normal_face[qp];
+                        }
+
+                        n = (FF_inv_trans * normal_face[qp]).unit();
+
+                        if (!integrate_normal_stress)
+                        {
+                            F -= (F * n) * n; // remove the normal component.
+                        }
+
+                        if (!integrate_tangential_stress)
+                        {
+                            F -= (F - (F * n) * n); // remove the tangential component.
+                        }
+
+                        // Add the boundary forces to the right-hand-side vector.
+                        for (unsigned int basis_face_n = 0; basis_face_n < n_basis_face; ++basis_face_n)
+                        {
+                            F_qp = F * phi_face[basis_face_n][qp] * JxW_face[qp];
+                            for (unsigned int i = 0; i < NDIM; ++i)
+                            {
+                                F_rhs_e[i](basis_face_n) += F_qp(i);
+                            }
+                        }
+                    }
+                }
+
+                // Apply constraints (e.g., enforce periodic boundary
+                // conditions) and add the elemental contributions to the
+                // vector.
+                for (unsigned int var_n = 0; var_n < NDIM; ++var_n)
+                {
+                    copy_dof_ids_to_vector(var_n, F_dof_indices, dof_id_scratch);
+                    F_dof_map.constrain_element_vector(F_rhs_e[var_n], dof_id_scratch);
+                    for (unsigned int j = 0; j < dof_id_scratch.size(); ++j)
+                    {
+                        F_rhs_soln[F_rhs_vec.map_global_to_local_index(dof_id_scratch[j])] += F_rhs_e[var_n](j);
+                    }
+                }
+            }
+        };
+
+        std::vector<Elem*> local_elems;
+        const auto el_begin = mesh.active_local_elements_begin();
+        const auto el_end = mesh.active_local_elements_end();
+        for (auto el_it = el_begin; el_it != el_end; ++el_it)
+        {
+            local_elems.push_back(*el_it);
+        }
+        if (num_threads == 1)
+        {
+            assemble_elements(0, local_elems, 0, local_elems.size(), F_rhs_local_soln);
+        }
+        else
+        {
+            // The elements are split into num_threads contiguous ranges, each
+            // of which is assembled into its own copy of the local form of the
+            // right-hand side, and these copies are then summed in a fixed
+            // order. The ranges are distributed over however many threads
+            // OpenMP actually provides, so every element is assembled even if
+            // fewer threads are available, and the results depend neither on
+            // thread scheduling nor on the number of threads.
+            int F_rhs_local_size;
+            ierr = VecGetLocalSize(F_rhs_vec_local, &F_rhs_local_size);
+            IBTK_CHKERRQ(ierr);
+            std::vector<std::vector<double> > F_rhs_range_soln(num_threads);
+            const std::size_t n_elems = local_elems.size();
+#ifdef IBTK_HAVE_OPENMP
+#pragma omp parallel num_threads(num_threads)
+#endif
+            {
+                const int thread_num = get_thread_num();
+#ifdef IBTK_HAVE_OPENMP
+#pragma omp for schedule(static)
+#endif
+                for (int range = 0; range < num_threads; ++range)
+                {
+                    F_rhs_range_soln[range].assign(F_rhs_local_size, 0.0);
+                    assemble_elements(thread_num,
+                                      local_elems,
+                                      (n_elems * range) / num_threads,
+                                      (n_elems * (range + 1)) / num_threads,
+                                      F_rhs_range_soln[range].data());
+                }
+            }
+#ifdef IBTK_HAVE_OPENMP
+#pragma omp parallel for num_threads(num_threads)
+#endif
+            for (int i = 0; i < F_rhs_local_size; ++i)
+            {
+                for (int range = 0; range < num_threads; ++range)
+                {
+                    F_rhs_local_soln[i] += F_rhs_range_soln[range][i];
+                }
+            }
+        }
+    }
+
+    // Batched PK1 stress functions are grouped in the same way, but their
+    // stresses are evaluated at the interior quadrature points of up to
+    // BATCHED_PK1_MAX_ELEMS elements at a time. The elemental right-hand sides
+    // are kept until the stresses for the whole block are available.
+    const std::vector<BatchedPK1StressFcnData> all_batched_pk1 = getBatchedPK1StressFunction(part);
+    std::vector<BatchedPK1StressFcnData> remaining_batched_pk1;
+    std::copy_if(all_batched_pk1.begin(),
+                 all_batched_pk1.end(),
+                 std::back_inserter(remaining_batched_pk1),
+                 [](const BatchedPK1StressFcnData& data) { return data.fcn != nullptr; });
+    while (remaining_batched_pk1.size() > 0)
+    {
+        const BatchedPK1StressFcnData exemplar_pk1 = remaining_batched_pk1.front();
+        const auto next_group_start = std::partition(remaining_batched_pk1.begin(),
+                                                     remaining_batched_pk1.end(),
+                                                     [&](const BatchedPK1StressFcnData& pk1)
+                                                     {
+                                                         return pk1.system_data == exemplar_pk1.system_data &&
+                                                                pk1.quad_type == exemplar_pk1.quad_type &&
+                                                                pk1.quad_order == exemplar_pk1.quad_order;
+                                                     });
+        const std::vector<BatchedPK1StressFcnData> current_pk1(remaining_batched_pk1.begin(), next_group_start);
+        remaining_batched_pk1.erase(remaining_batched_pk1.begin(), next_group_start);
+
         // Extract the FE systems and DOF maps, and setup the FE object.
         const DofMap& F_dof_map = F_system.get_dof_map();
         FEDataManager::SystemDofMapCache& F_dof_map_cache = *d_fe_data[part]->getDofMapCache(getForceSystemName());
@@ -976,57 +1537,106 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
         std::vector<const std::vector<double>*> PK1_var_data;
         std::vector<const std::vector<VectorValue<double> >*> PK1_grad_var_data;
 
-        // Loop over the elements to compute the right-hand side vector.  This
-        // is computed via
-        //
-        //    rhs_k = -int{PP(s,t) grad phi_k(s)}ds + int{PP(s,t) N(s,t)
-        //    phi_k(s)}dA(s)
-        //
-        // This right-hand side vector is used to solve for the nodal values of
-        // the interior elastic force density.
-        TensorValue<double> PP, FF, FF_inv_trans;
+        // Data for the current block of elements. For each element, we store
+        // dphi * JxW at all quadrature points so that the interior
+        // contributions can be added once the stresses are known.
+        PK1StressBatchBuffer batch, face_batch;
+        std::vector<Elem*> block_elems;
+        std::vector<const boost::multi_array<libMesh::dof_id_type, 2>*> block_dof_indices;
+        std::vector<std::array<DenseVector<double>, NDIM> > block_F_rhs_e(BATCHED_PK1_MAX_ELEMS);
+        std::vector<std::vector<VectorValue<double> > > block_dphi_JxW(BATCHED_PK1_MAX_ELEMS);
+        std::vector<unsigned int> block_n_qp, block_qp_offset;
+        const auto assemble_block = [&]()
+        {
+            const std::vector<double>& PP_data = batch.evaluate(current_pk1, data_time);
+            TensorValue<double> PP;
+            VectorValue<double> F_qp;
+            for (std::size_t b = 0; b < block_elems.size(); ++b)
+            {
+                const std::vector<VectorValue<double> >& dphi_JxW = block_dphi_JxW[b];
+                const unsigned int n_qp = block_n_qp[b];
+                const std::size_t n_basis = n_qp > 0 ? dphi_JxW.size() / n_qp : 0;
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    const double* const PP_qp = &PP_data[(block_qp_offset[b] + qp) * NDIM * NDIM];
+                    for (unsigned int i = 0; i < NDIM; ++i)
+                    {
+                        for (unsigned int j = 0; j < NDIM; ++j)
+                        {
+                            PP(i, j) = PP_qp[i * NDIM + j];
+                        }
+                    }
+                    for (std::size_t basis_n = 0; basis_n < n_basis; ++basis_n)
+                    {
+                        F_qp = -PP * dphi_JxW[qp * n_basis + basis_n];
+                        for (unsigned int i = 0; i < NDIM; ++i)
+                        {
+                            block_F_rhs_e[b][i](basis_n) += F_qp(i);
+                        }
+                    }
+                }
+
+                // Apply constraints (e.g., enforce periodic boundary
+                // conditions) and add the elemental contributions to the
+                // global vector.
+                for (unsigned int var_n = 0; var_n < NDIM; ++var_n)
+                {
+                    copy_dof_ids_to_vector(var_n, *block_dof_indices[b], dof_id_scratch);
+                    F_dof_map.constrain_element_vector(block_F_rhs_e[b][var_n], dof_id_scratch);
+                    for (unsigned int j = 0; j < dof_id_scratch.size(); ++j)
+                    {
+                        F_rhs_local_soln[F_rhs_vec.map_global_to_local_index(dof_id_scratch[j])] +=
+                            block_F_rhs_e[b][var_n](j);
+                    }
+                }
+            }
+            batch.clear();
+            block_elems.clear();
+            block_dof_indices.clear();
+            block_n_qp.clear();
+            block_qp_offset.clear();
+        };
+
+        TensorValue<double> FF, FF_inv_trans;
         VectorValue<double> F, F_qp, n, x;
+        std::vector<VectorValue<double> > n_face;
         const auto el_begin = mesh.active_local_elements_begin();
         const auto el_end = mesh.active_local_elements_end();
         for (auto el_it = el_begin; el_it != el_end; ++el_it)
         {
             auto elem = *el_it;
+            const std::size_t b = block_elems.size();
             const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
+            block_elems.push_back(elem);
+            block_dof_indices.push_back(&F_dof_indices);
             for (unsigned int d = 0; d < NDIM; ++d)
             {
-                F_rhs_e[d].resize(static_cast<int>(F_dof_indices[d].size()));
+                block_F_rhs_e[b][d].resize(static_cast<int>(F_dof_indices[d].size()));
             }
             fe.reinit(elem);
             fe.collectDataForInterpolation(elem);
             fe.interpolate(elem);
             const unsigned int n_qp = qrule->n_points();
             const size_t n_basis = dphi.size();
+            block_qp_offset.push_back(batch.size());
+            block_n_qp.push_back(n_qp);
+            block_dphi_JxW[b].resize(n_qp * n_basis);
             for (unsigned int qp = 0; qp < n_qp; ++qp)
             {
-                const libMesh::Point& X = q_point[qp];
                 const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
                 const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
                 get_x_and_FF(x, FF, x_data, grad_x_data);
-
-                // Compute the value of the first Piola-Kirchhoff stress tensor
-                // at the quadrature point and add the corresponding forces to
-                // the right-hand-side vector.
                 fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
-                for (const PK1StressFcnData& pk1 : current_pk1)
+                batch.addPoint(FF, x, q_point[qp], elem, PK1_var_data, PK1_grad_var_data);
+                for (unsigned int basis_n = 0; basis_n < n_basis; ++basis_n)
                 {
-                    pk1.fcn(PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, pk1.ctx);
-                    for (unsigned int basis_n = 0; basis_n < n_basis; ++basis_n)
-                    {
-                        F_qp = -PP * dphi[basis_n][qp] * JxW[qp];
-                        for (unsigned int i = 0; i < NDIM; ++i)
-                        {
-                            F_rhs_e[i](basis_n) += F_qp(i);
-                        }
-                    }
+                    block_dphi_JxW[b][qp * n_basis + basis_n] = dphi[basis_n][qp] * JxW[qp];
                 }
             }
 
-            // Loop over the element boundaries.
+            // Loop over the element boundaries. The FE object is reinitialized
+            // for each side, so the stresses along each side are evaluated
+            // right away.
             for (unsigned int side = 0; side < elem->n_sides(); ++side)
             {
                 // Skip non-physical boundaries.
@@ -1046,27 +1656,34 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
                 fe.interpolate(elem, side);
                 const unsigned int n_qp_face = qrule_face->n_points();
                 const size_t n_basis_face = phi_face.size();
+                face_batch.clear();
+                n_face.resize(n_qp_face);
                 for (unsigned int qp = 0; qp < n_qp_face; ++qp)
                 {
-                    const libMesh::Point& X = q_point_face[qp];
                     const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
                     const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
                     get_x_and_FF(x, FF, x_data, grad_x_data);
                     tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
-
-                    F.zero();
-
-                    // Compute the value of the first Piola-Kirchhoff stress
-                    // tensor at the quadrature point and add the corresponding
-                    // traction force to the right-hand-side vector.
+                    n_face[qp] = (FF_inv_trans * normal_face[qp]).unit();
                     fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
-                    for (const PK1StressFcnData& pk1 : current_pk1)
+                    face_batch.addPoint(FF, x, q_point_face[qp], elem, PK1_var_data, PK1_grad_var_data);
+                }
+                const std::vector<double>& PP_data = face_batch.evaluate(current_pk1, data_time);
+                for (unsigned int qp = 0; qp < n_qp_face; ++qp)
+                {
+                    // Compute the traction force corresponding to the first
+                    // Piola-Kirchhoff stress tensor at the quadrature point.
+                    const double* const PP_qp = &PP_data[qp * NDIM * NDIM];
+                    F.zero();
+                    for (unsigned int i = 0; i < NDIM; ++i)
                     {
-                        pk1.fcn(PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, pk1.ctx);
-                        F += PP * normal_face[qp];
+                        for (unsigned int j = 0; j < NDIM; ++j)
+                        {
+                            F(i) += PP_qp[i * NDIM + j] * normal_face[qp](j);
+                        }
                     }
 
-                    n = (FF_inv_trans * normal_face[qp]).unit();
+                    n = n_face[qp];
 
                     if (!integrate_normal_stress)
                     {
@@ -1084,24 +1701,15 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
                         F_qp = F * phi_face[basis_face_n][qp] * JxW_face[qp];
                         for (unsigned int i = 0; i < NDIM; ++i)
                         {
-                            F_rhs_e[i](basis_face_n) += F_qp(i);
+                            block_F_rhs_e[b][i](basis_face_n) += F_qp(i);
                         }
                     }
                 }
             }
 
-            // Apply constraints (e.g., enforce periodic boundary conditions)
-            // and add the elemental contributions to the global vector.
-            for (unsigned int var_n = 0; var_n < NDIM; ++var_n)
-            {
-                copy_dof_ids_to_vector(var_n, F_dof_indices, dof_id_scratch);
-                F_dof_map.constrain_element_vector(F_rhs_e[var_n], dof_id_scratch);
-                for (unsigned int j = 0; j < dof_id_scratch.size(); ++j)
-                {
-                    F_rhs_local_soln[F_rhs_vec.map_global_to_local_index(dof_id_scratch[j])] += F_rhs_e[var_n](j);
-                }
-            }
+            if (block_elems.size() == BATCHED_PK1_MAX_ELEMS) assemble_block();
         }
+        if (!block_elems.empty()) assemble_block();
     }
 
     // Now account for any additional force contributions.
@@ -1358,6 +1966,230 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
     IBAMR_TIMER_STOP(t_assemble_interior_force_density_rhs);
 }
 
+void
+FEMechanicsBase::assembleLinearizedInteriorForceDensityRHS(PetscVector<double>& dF_rhs_vec,
+                                                           PetscVector<double>& dX_vec,
+                                                           PetscVector<double>& X_vec,
+                                                           const double data_time,
+                                                           const unsigned int part)
+{
+    IBAMR_TIMER_START(t_assemble_linearized_interior_force_density_rhs);
+    for (const BatchedPK1StressFcnData& pk1 : getBatchedPK1StressFunction(part))
+    {
+        if (pk1.fcn)
+        {
+            TBOX_ERROR(d_object_name << "::assembleLinearizedInteriorForceDensityRHS():\n"
+                                     << "  batched PK1 stress functions cannot be linearized" << std::endl);
+        }
+    }
+
+    // Extract the mesh.
+    EquationSystems& equation_systems = *d_equation_systems[part];
+    MeshBase& mesh = equation_systems.get_mesh();
+    const BoundaryInfo& boundary_info = mesh.get_boundary_info();
+    const unsigned int dim = mesh.mesh_dimension();
+
+    // Extract the FE systems and DOF maps.
+    auto& F_system = equation_systems.get_system<ExplicitSystem>(getForceSystemName());
+    const DofMap& F_dof_map = F_system.get_dof_map();
+    FEDataManager::SystemDofMapCache& F_dof_map_cache = *d_fe_data[part]->getDofMapCache(getForceSystemName());
+    FEType F_fe_type = F_dof_map.variable_type(0);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        TBOX_ASSERT(F_dof_map.variable_type(d) == F_fe_type);
+    }
+    auto& X_system = equation_systems.get_system<ExplicitSystem>(getCurrentCoordinatesSystemName());
+    std::vector<int> vars(NDIM);
+    for (unsigned int d = 0; d < NDIM; ++d) vars[d] = d;
+
+    // Setup global and elemental right-hand-side vectors.
+    int ierr;
+    TBOX_ASSERT(dF_rhs_vec.type() == GHOSTED);
+    Vec dF_rhs_vec_local;
+    ierr = VecGhostGetLocalForm(dF_rhs_vec.vec(), &dF_rhs_vec_local);
+    IBTK_CHKERRQ(ierr);
+    double* dF_rhs_local_soln = nullptr;
+    ierr = VecGetArray(dF_rhs_vec_local, &dF_rhs_local_soln);
+    IBTK_CHKERRQ(ierr);
+    std::array<DenseVector<double>, NDIM> dF_rhs_e;
+    std::vector<libMesh::dof_id_type> dof_id_scratch;
+
+    for (const PK1StressFcnData& pk1 : getPK1StressFunction(part))
+    {
+        if (!pk1.fcn) continue;
+
+        // Setup the FE object. The linearization direction dX is interpolated
+        // in the same way as the current configuration.
+        FEDataInterpolation fe(dim, d_fe_data[part]);
+        std::unique_ptr<QBase> qrule = QBase::build(pk1.quad_type, dim, pk1.quad_order);
+        qrule->allow_rules_with_negative_weights = d_allow_rules_with_negative_weights;
+        std::unique_ptr<QBase> qrule_face = QBase::build(pk1.quad_type, dim - 1, pk1.quad_order);
+        qrule_face->allow_rules_with_negative_weights = d_allow_rules_with_negative_weights;
+        fe.attachQuadratureRule(qrule.get());
+        fe.attachQuadratureRuleFace(qrule_face.get());
+        fe.evalNormalsFace();
+        fe.evalQuadraturePoints();
+        fe.evalQuadraturePointsFace();
+        fe.evalQuadratureWeights();
+        fe.evalQuadratureWeightsFace();
+        fe.registerSystem(F_system, std::vector<int>(), vars); // compute dphi for the force system
+        const size_t X_sys_idx = fe.registerInterpolatedSystem(X_system, vars, vars, &X_vec);
+        const size_t dX_sys_idx = fe.registerInterpolatedSystem(X_system, vars, vars, &dX_vec);
+        std::vector<size_t> PK1_fcn_system_idxs;
+        fe.setupInterpolatedSystemDataIndexes(PK1_fcn_system_idxs, pk1.system_data, &equation_systems);
+        fe.init();
+
+        const std::vector<libMesh::Point>& q_point = fe.getQuadraturePoints();
+        const std::vector<double>& JxW = fe.getQuadratureWeights();
+        const std::vector<std::vector<VectorValue<double> > >& dphi = fe.getDphi(F_fe_type);
+
+        const std::vector<libMesh::Point>& q_point_face = fe.getQuadraturePointsFace();
+        const std::vector<double>& JxW_face = fe.getQuadratureWeightsFace();
+        const std::vector<libMesh::Point>& normal_face = fe.getNormalsFace();
+        const std::vector<std::vector<double> >& phi_face = fe.getPhiFace(F_fe_type);
+
+        const std::vector<std::vector<std::vector<double> > >& fe_interp_var_data = fe.getVarInterpolation();
+        const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data =
+            fe.getGradVarInterpolation();
+
+        std::vector<const std::vector<double>*> PK1_var_data;
+        std::vector<const std::vector<VectorValue<double> >*> PK1_grad_var_data;
+
+        // Get the configuration and the linearization direction at a
+        // quadrature point.
+        TensorValue<double> FF, dFF, dPP, PP, FF_inv_trans;
+        VectorValue<double> x, dx, dF, dF_qp;
+        const auto get_x_dx_FF_dFF = [&](const unsigned int qp)
+        {
+            get_x_and_FF(x, FF, fe_interp_var_data[qp][X_sys_idx], fe_interp_grad_var_data[qp][X_sys_idx]);
+            get_x_and_FF(dx, dFF, fe_interp_var_data[qp][dX_sys_idx], fe_interp_grad_var_data[qp][dX_sys_idx]);
+            for (unsigned int i = NDIM; i < LIBMESH_DIM; ++i) dFF(i, i) = 0.0;
+        };
+
+        // Loop over the elements to compute the right-hand side vector. This
+        // is the linearization of the right-hand side assembled by
+        // assembleInteriorForceDensityRHS():
+        //
+        //    rhs_k = -int{dPP(s,t) grad phi_k(s)}ds + int{dPP(s,t) N(s,t)
+        //    phi_k(s)}dA(s)
+        //
+        // in which dPP is the directional derivative of PP in the direction
+        // dFF = grad dX.
+        const auto el_begin = mesh.active_local_elements_begin();
+        const auto el_end = mesh.active_local_elements_end();
+        for (auto el_it = el_begin; el_it != el_end; ++el_it)
+        {
+            Elem* const elem = *el_it;
+            const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                dF_rhs_e[d].resize(static_cast<int>(F_dof_indices[d].size()));
+            }
+            fe.reinit(elem);
+            fe.collectDataForInterpolation(elem);
+            fe.interpolate(elem);
+            const unsigned int n_qp = qrule->n_points();
+            const size_t n_basis = dphi.size();
+            for (unsigned int qp = 0; qp < n_qp; ++qp)
+            {
+                get_x_dx_FF_dFF(qp);
+                fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
+                compute_linearized_PK1_stress(
+                    dPP, pk1, FF, dFF, x, dx, q_point[qp], elem, PK1_var_data, PK1_grad_var_data, data_time);
+                for (unsigned int basis_n = 0; basis_n < n_basis; ++basis_n)
+                {
+                    dF_qp = -dPP * dphi[basis_n][qp] * JxW[qp];
+                    for (unsigned int i = 0; i < NDIM; ++i)
+                    {
+                        dF_rhs_e[i](basis_n) += dF_qp(i);
+                    }
+                }
+            }
+
+            // Loop over the element boundaries.
+            for (unsigned int side = 0; side < elem->n_sides(); ++side)
+            {
+                // Skip non-physical boundaries and the parts of the physical
+                // boundary along which no surface forces are integrated.
+                if (!is_physical_bdry(elem, side, boundary_info, F_dof_map)) continue;
+                const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, F_dof_map);
+                const bool integrate_normal_stress =
+                    (d_include_normal_stress_in_weak_form && !at_dirichlet_bdry) ||
+                    (!d_include_normal_stress_in_weak_form && at_dirichlet_bdry);
+                const bool integrate_tangential_stress =
+                    (d_include_tangential_stress_in_weak_form && !at_dirichlet_bdry) ||
+                    (!d_include_tangential_stress_in_weak_form && at_dirichlet_bdry);
+                if (!integrate_normal_stress && !integrate_tangential_stress) continue;
+
+                fe.reinit(elem, side);
+                fe.interpolate(elem, side);
+                const unsigned int n_qp_face = qrule_face->n_points();
+                const size_t n_basis_face = phi_face.size();
+                for (unsigned int qp = 0; qp < n_qp_face; ++qp)
+                {
+                    const libMesh::Point& X = q_point_face[qp];
+                    get_x_dx_FF_dFF(qp);
+                    fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
+                    if (integrate_normal_stress && integrate_tangential_stress)
+                    {
+                        compute_linearized_PK1_stress(
+                            dPP, pk1, FF, dFF, x, dx, X, elem, PK1_var_data, PK1_grad_var_data, data_time);
+                        dF = dPP * normal_face[qp];
+                    }
+                    else
+                    {
+                        // The removed component of the traction depends on
+                        // the deformed normal, so difference the complete
+                        // traction.
+                        const auto traction = [&](const double h)
+                        {
+                            const TensorValue<double> FF_h = FF + h * dFF;
+                            pk1.fcn(PP, FF_h, x + h * dx, X, elem, PK1_var_data, PK1_grad_var_data, data_time, pk1.ctx);
+                            VectorValue<double> F = PP * normal_face[qp];
+                            tensor_inverse_transpose(FF_inv_trans, FF_h, NDIM);
+                            const VectorValue<double> n = (FF_inv_trans * normal_face[qp]).unit();
+                            if (!integrate_normal_stress) F -= (F * n) * n;
+                            if (!integrate_tangential_stress) F = (F * n) * n;
+                            return F;
+                        };
+                        const double h = get_linearization_step(FF, dFF, x, dx);
+                        if (h == 0.0) continue;
+                        dF = (traction(h) - traction(-h)) / (2.0 * h);
+                    }
+
+                    for (unsigned int basis_face_n = 0; basis_face_n < n_basis_face; ++basis_face_n)
+                    {
+                        dF_qp = dF * phi_face[basis_face_n][qp] * JxW_face[qp];
+                        for (unsigned int i = 0; i < NDIM; ++i)
+                        {
+                            dF_rhs_e[i](basis_face_n) += dF_qp(i);
+                        }
+                    }
+                }
+            }
+
+            // Apply constraints (e.g., enforce periodic boundary conditions)
+            // and add the elemental contributions to the vector.
+            for (unsigned int var_n = 0; var_n < NDIM; ++var_n)
+            {
+                copy_dof_ids_to_vector(var_n, F_dof_indices, dof_id_scratch);
+                F_dof_map.constrain_element_vector(dF_rhs_e[var_n], dof_id_scratch);
+                for (unsigned int j = 0; j < dof_id_scratch.size(); ++j)
+                {
+                    dF_rhs_local_soln[dF_rhs_vec.map_global_to_local_index(dof_id_scratch[j])] +=
+                        dF_rhs_e[var_n](j);
+                }
+            }
+        }
+    }
+
+    ierr = VecRestoreArray(dF_rhs_vec_local, &dF_rhs_local_soln);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostRestoreLocalForm(dF_rhs_vec.vec(), &dF_rhs_vec_local);
+    IBTK_CHKERRQ(ierr);
+    IBAMR_TIMER_STOP(t_assemble_linearized_interior_force_density_rhs);
+}
+
 void
 FEMechanicsBase::initializeCoordinates(const unsigned int part)
 {
@@ -1587,6 +2419,7 @@ FEMechanicsBase::commonConstructor(const std::string& object_name,
     d_coordinate_mapping_fcn_data.resize(n_parts);
     d_initial_velocity_fcn_data.resize(n_parts);
     d_PK1_stress_fcn_data.resize(n_parts);
+    d_batched_PK1_stress_fcn_data.resize(n_parts);
     d_lag_body_force_fcn_data.resize(n_parts);
     d_lag_surface_pressure_fcn_data.resize(n_parts);
     d_lag_surface_force_fcn_data.resize(n_parts);
@@ -1685,7 +2518,9 @@ FEMechanicsBase::commonConstructor(const std::string& object_name,
     // Setup timers.
     auto set_timer = [&](const char* name) { return TimerManager::getManager()->getTimer(name); };
     IBAMR_DO_ONCE(t_assemble_interior_force_density_rhs =
-                      set_timer("IBAMR::FEMechanicsBase::assembleInteriorForceDensityRHS()"););
+                      set_timer("IBAMR::FEMechanicsBase::assembleInteriorForceDensityRHS()");
+                  t_assemble_linearized_interior_force_density_rhs =
+                      set_timer("IBAMR::FEMechanicsBase::assembleLinearizedInteriorForceDensityRHS()"););
 }
 
 void
@@ -1720,6 +2555,21 @@ FEMechanicsBase::getFromInput(const Pointer<Database>& db, bool /*is_from_restar
         d_use_consistent_mass_matrix = db->getBool("use_consistent_mass_matrix");
     if (db->isBool("allow_rules_with_negative_weights"))
         d_allow_rules_with_negative_weights = db->getBool("allow_rules_with_negative_weights");
+    if (db->isInteger("num_assembly_threads")) d_num_assembly_threads = db->getInteger("num_assembly_threads");
+    if (d_num_assembly_threads < 1)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  num_assembly_threads must be positive" << std::endl);
+    }
+#ifndef IBTK_HAVE_OPENMP
+    if (d_num_assembly_threads > 1)
+    {
+        TBOX_WARNING(d_object_name << "::getFromInput():\n"
+                                   << "  num_assembly_threads > 1 requires OpenMP; using one thread" << std::endl);
+        d_num_assembly_threads = 1;
+    }
+#endif
+    if (db->isBool("cache_reference_geometry")) d_cache_reference_geometry = db->getBool("cache_reference_geometry");
 
     // Pressure settings.
     if (db->isDouble("static_pressure_kappa")) d_static_pressure_kappa = db->getDouble("static_pressure_kappa");
@@ -1741,6 +2591,14 @@ FEMechanicsBase::getFromInput(const Pointer<Database>& db, bool /*is_from_restar
     }
     if (db->isString("libmesh_partitioner_type"))
         d_libmesh_partitioner_type = string_to_enum<LibmeshPartitionerType>(db->getString("libmesh_partitioner_type"));
+    if (db->isBool("async_restart_write")) d_async_restart_write = db->getBool("async_restart_write");
+    if (db->isInteger("restart_ranks_per_writer"))
+        d_restart_ranks_per_writer = db->getInteger("restart_ranks_per_writer");
+    if (d_restart_ranks_per_writer < 1)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  restart_ranks_per_writer must be positive" << std::endl);
+    }
 
     // Other settings.
     if (db->keyExists("do_log"))
@@ -1770,6 +2628,7 @@ FEMechanicsBase::getFromRestart()
     }
     d_use_consistent_mass_matrix = db->getBool("d_use_consistent_mass_matrix");
     d_libmesh_partitioner_type = string_to_enum<LibmeshPartitionerType>(db->getString("d_libmesh_partitioner_type"));
+    if (db->keyExists("d_async_restart_write")) d_async_restart_read = db->getBool("d_async_restart_write");
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
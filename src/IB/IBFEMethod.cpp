@@ -163,6 +163,7 @@ static Timer* t_preprocess_integrate_data;
 static Timer* t_postprocess_integrate_data;
 static Timer* t_interpolate_velocity;
 static Timer* t_compute_lagrangian_force;
+static Timer* t_compute_linearized_lagrangian_force;
 static Timer* t_spread_force;
 static Timer* t_compute_lagrangian_fluid_source;
 static Timer* t_spread_fluid_source;
@@ -575,7 +576,7 @@ IBFEMethod::preprocessIntegrateData(double current_time, double new_time, int nu
 
     d_started_time_integration = true;
 
-    // Determine if we need to execute reinitElementMappings().
+    // Determine if we need to execute updateElementMappings().
     bool do_reinit_element_mappings = false;
     for (unsigned int part = 0; part < d_meshes.size(); ++part)
     {
@@ -597,7 +598,7 @@ IBFEMethod::preprocessIntegrateData(double current_time, double new_time, int nu
             break;
         }
     }
-    if (do_reinit_element_mappings) reinitElementMappings();
+    if (do_reinit_element_mappings) updateElementMappings();
 
     // Update direct forcing data.
     for (unsigned int part = 0; part < d_meshes.size(); ++part)
@@ -710,22 +711,34 @@ IBFEMethod::interpolateVelocity(const int u_data_idx,
     std::vector<PetscVector<double>*> U_rhs_vecs = d_U_IB_vecs->getIBGhosted("tmp");
     std::vector<PetscVector<double>*> X_IB_ghost_vecs = d_X_IB_vecs->getIBGhosted("tmp");
     batch_vec_copy(X_vecs, X_IB_ghost_vecs);
-    batch_vec_ghost_update(X_IB_ghost_vecs, INSERT_VALUES, SCATTER_FORWARD);
+    batch_vec_ghost_update_begin(X_IB_ghost_vecs, INSERT_VALUES, SCATTER_FORWARD);
 
-    // Build the right-hand-sides to compute the interpolated data.
+    // Build the right-hand-sides to compute the interpolated data. Elements
+    // whose position DoFs are all locally owned are processed while the ghost
+    // data is being communicated.
     std::vector<Pointer<RefineSchedule<NDIM> > > no_fill(u_ghost_fill_scheds.size());
-    for (unsigned int part = 0; part < d_meshes.size(); ++part)
+    for (const FEDataManager::ElementSubset elem_subset : { FEDataManager::LOCAL_ELEMS, FEDataManager::NONLOCAL_ELEMS })
     {
-        if (d_part_is_active[part])
+        if (elem_subset == FEDataManager::NONLOCAL_ELEMS)
         {
-            d_active_fe_data_managers[part]->interpWeighted(u_data_idx,
-                                                            *U_rhs_vecs[part],
-                                                            *X_IB_ghost_vecs[part],
-                                                            getVelocitySystemName(),
-                                                            no_fill,
-                                                            data_time,
-                                                            /*close_F*/ false,
-                                                            /*close_X*/ false);
+            batch_vec_ghost_update_end(X_IB_ghost_vecs, INSERT_VALUES, SCATTER_FORWARD);
+        }
+        for (unsigned int part = 0; part < d_meshes.size(); ++part)
+        {
+            if (d_part_is_active[part])
+            {
+                FEDataManager* const fe_data_manager = d_active_fe_data_managers[part];
+                fe_data_manager->interpWeighted(u_data_idx,
+                                                *U_rhs_vecs[part],
+                                                *X_IB_ghost_vecs[part],
+                                                getVelocitySystemName(),
+                                                fe_data_manager->getDefaultInterpSpec(),
+                                                no_fill,
+                                                data_time,
+                                                /*close_F*/ false,
+                                                /*close_X*/ false,
+                                                elem_subset);
+            }
         }
     }
 
@@ -994,6 +1007,46 @@ IBFEMethod::computeLagrangianForce(const double data_time)
     return;
 } // computeLagrangianForce
 
+void
+IBFEMethod::computeLinearizedLagrangianForce(const double dt, const double data_time)
+{
+    IBAMR_TIMER_START(t_compute_linearized_lagrangian_force);
+    const std::string data_time_str = get_data_time_str(data_time, d_current_time, d_new_time);
+    batch_vec_ghost_update(d_X_vecs->get(data_time_str), INSERT_VALUES, SCATTER_FORWARD);
+
+    // The linearization direction dX = dt * U is stored in the temporary
+    // position vectors.
+    for (unsigned part = 0; part < d_meshes.size(); ++part)
+    {
+        int ierr = VecAXPBY(d_X_vecs->get("tmp", part).vec(), dt, 0.0, d_U_vecs->get(data_time_str, part).vec());
+        IBTK_CHKERRQ(ierr);
+    }
+    batch_vec_ghost_update(d_X_vecs->get("tmp"), INSERT_VALUES, SCATTER_FORWARD);
+
+    d_F_vecs->zero("RHS Vector");
+    for (unsigned part = 0; part < d_meshes.size(); ++part)
+    {
+        assembleLinearizedInteriorForceDensityRHS(d_F_vecs->get("RHS Vector", part),
+                                                  d_X_vecs->get("tmp", part),
+                                                  d_X_vecs->get(data_time_str, part),
+                                                  data_time,
+                                                  part);
+    }
+    batch_vec_ghost_update(d_F_vecs->get("RHS Vector"), ADD_VALUES, SCATTER_REVERSE);
+    for (unsigned part = 0; part < d_meshes.size(); ++part)
+    {
+        d_active_fe_data_managers[part]->computeL2Projection(d_F_vecs->get("solution", part),
+                                                             d_F_vecs->get("RHS Vector", part),
+                                                             getForceSystemName(),
+                                                             d_use_consistent_mass_matrix,
+                                                             /*close_U*/ false,
+                                                             /*close_F*/ false);
+    }
+    d_F_vecs->copy("solution", { data_time_str });
+    IBAMR_TIMER_STOP(t_compute_linearized_lagrangian_force);
+    return;
+} // computeLinearizedLagrangianForce
+
 void
 IBFEMethod::spreadForce(const int f_data_idx,
                         RobinPhysBdryPatchStrategy* f_phys_bdry_op,
@@ -1003,12 +1056,13 @@ IBFEMethod::spreadForce(const int f_data_idx,
     IBAMR_TIMER_START(t_spread_force);
     const std::string data_time_str = get_data_time_str(data_time, d_current_time, d_new_time);
 
-    // Communicate ghost data.
+    // Start communicating ghost data. This is completed after spreading from
+    // the elements whose DoFs are all locally owned.
     std::vector<PetscVector<double>*> X_IB_ghost_vecs = d_X_IB_vecs->getIBGhosted("tmp");
     std::vector<PetscVector<double>*> F_IB_ghost_vecs = d_F_IB_vecs->getIBGhosted("tmp");
     batch_vec_copy({ d_X_vecs->get(data_time_str), d_F_vecs->get(data_time_str) },
                    { X_IB_ghost_vecs, F_IB_ghost_vecs });
-    batch_vec_ghost_update({ X_IB_ghost_vecs, F_IB_ghost_vecs }, INSERT_VALUES, SCATTER_FORWARD);
+    batch_vec_ghost_update_begin({ X_IB_ghost_vecs, F_IB_ghost_vecs }, INSERT_VALUES, SCATTER_FORWARD);
 
     // set up a new data index for computing forces on the active hierarchy.
     Pointer<PatchHierarchy<NDIM> > hierarchy =
@@ -1032,13 +1086,27 @@ IBFEMethod::spreadForce(const int f_data_idx,
                                    0.0,
                                    /*interior_only*/ false);
 
-    // Spread interior force density values.
-    for (unsigned int part = 0; part < d_meshes.size(); ++part)
+    // Spread interior force density values. Elements with nonlocal DoFs are
+    // processed once the ghost data is available.
+    for (const FEDataManager::ElementSubset elem_subset : { FEDataManager::LOCAL_ELEMS, FEDataManager::NONLOCAL_ELEMS })
     {
-        if (!d_part_is_active[part]) continue;
-        PetscVector<double>* X_ghost_vec = X_IB_ghost_vecs[part];
-        PetscVector<double>* F_ghost_vec = F_IB_ghost_vecs[part];
-        d_active_fe_data_managers[part]->spread(f_scratch_data_idx, *F_ghost_vec, *X_ghost_vec, getForceSystemName());
+        if (elem_subset == FEDataManager::NONLOCAL_ELEMS)
+        {
+            batch_vec_ghost_update_end({ X_IB_ghost_vecs, F_IB_ghost_vecs }, INSERT_VALUES, SCATTER_FORWARD);
+        }
+        for (unsigned int part = 0; part < d_meshes.size(); ++part)
+        {
+            if (!d_part_is_active[part]) continue;
+            PetscVector<double>* X_ghost_vec = X_IB_ghost_vecs[part];
+            PetscVector<double>* F_ghost_vec = F_IB_ghost_vecs[part];
+            FEDataManager* const fe_data_manager = d_active_fe_data_managers[part];
+            fe_data_manager->spread(f_scratch_data_idx,
+                                    *F_ghost_vec,
+                                    *X_ghost_vec,
+                                    getForceSystemName(),
+                                    fe_data_manager->getDefaultSpreadSpec(),
+                                    elem_subset);
+        }
     }
 
     // Handle any transmission conditions.
@@ -1579,6 +1647,8 @@ IBFEMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                 BoxPartitioner partitioner(*d_hierarchy,
                                            equation_systems.get_system(getCurrentCoordinatesSystemName()));
                 partitioner.repartition(mesh);
+                // The geometry cache only stores local elements.
+                d_fe_data[part]->setUseGeometryCache(d_cache_reference_geometry);
             }
         }
 
@@ -1871,6 +1941,14 @@ IBFEMethod::doInitializeFEData(const bool use_present_data)
     // Initialize FE equation systems.
     for (unsigned int part = 0; part < d_meshes.size(); ++part)
     {
+        if (!d_batched_PK1_stress_fcn_data[part].empty() &&
+            (d_stress_normalization_part[part] || d_split_normal_force || d_split_tangential_force))
+        {
+            TBOX_ERROR(d_object_name << "::initializeFEData():\n"
+                                     << "  batched PK1 stress functions are not supported with force splitting or "
+                                        "stress normalization (part "
+                                     << part << ")" << std::endl);
+        }
         EquationSystems& equation_systems = *d_equation_systems[part];
         if (d_stress_normalization_part[part])
         {
@@ -2914,6 +2992,8 @@ IBFEMethod::commonConstructor(const Pointer<Database>& input_db, int max_levels)
                   t_postprocess_integrate_data = set_timer("IBAMR::IBFEMethod::postprocessIntegrateData()");
                   t_interpolate_velocity = set_timer("IBAMR::IBFEMethod::interpolateVelocity()");
                   t_compute_lagrangian_force = set_timer("IBAMR::IBFEMethod::computeLagrangianForce()");
+                  t_compute_linearized_lagrangian_force =
+                      set_timer("IBAMR::IBFEMethod::computeLinearizedLagrangianForce()");
                   t_spread_force = set_timer("IBAMR::IBFEMethod::spreadForce()");
                   t_compute_lagrangian_fluid_source = set_timer("IBAMR::IBFEMethod::computeLagrangianFluidSource()");
                   t_spread_fluid_source = set_timer("IBAMR::IBFEMethod::spreadFluidSource()");
@@ -3036,6 +3116,9 @@ IBFEMethod::getFromInput(const Pointer<Database>& db, bool /*is_from_restart*/)
     else if (db->isBool("IB_allow_rules_with_negative_weights"))
         d_default_spread_spec.allow_rules_with_negative_weights = db->getBool("IB_allow_rules_with_negative_weights");
 
+    // Settings shared by all Lagrangian-Eulerian interaction routines.
+    if (db->isDatabase("LEInteractor")) LEInteractor::setFromDatabase(db->getDatabase("LEInteractor"));
+
     // Force computation settings.
     if (db->isBool("split_normal_force"))
         d_split_normal_force = db->getBool("split_normal_force");
@@ -3182,6 +3265,22 @@ IBFEMethod::reinitElementMappings()
     }
 }
 
+void
+IBFEMethod::updateElementMappings()
+{
+    // Store the coordinates at which we performed the last update.
+    d_X_vecs->copy("solution", { "last_patch_elem_assoc" });
+    for (unsigned int part = 0; part < d_meshes.size(); ++part)
+    {
+        d_primary_fe_data_managers[part]->updateElementMappings();
+        if (d_use_scratch_hierarchy)
+        {
+            d_scratch_fe_data_managers[part]->setPatchHierarchy(d_secondary_hierarchy->getSecondaryHierarchy());
+            d_scratch_fe_data_managers[part]->updateElementMappings();
+        }
+    }
+}
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
@@ -32,10 +32,14 @@
 
 #include "libmesh/enum_fe_family.h"
 #include "libmesh/enum_order.h"
+#include "libmesh/dof_map.h"
 #include "libmesh/equation_systems.h"
+#include "libmesh/fe_type.h"
+#include "libmesh/numeric_vector.h"
 #include "libmesh/system.h"
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
@@ -44,12 +48,6 @@
 
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
-namespace libMesh
-{
-template <typename T>
-class NumericVector;
-} // namespace libMesh
-
 using namespace libMesh;
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -268,12 +266,39 @@ IBFEPostProcessor::interpolateVariables(const double data_time)
         d_fe_data_manager->buildIBGhostedVector(d_fe_data_manager->getCurrentCoordinatesSystemName());
     copy_and_synch(*d_fe_data_manager->getSolutionVector(d_fe_data_manager->getCurrentCoordinatesSystemName()),
                    *X_ghost_vec);
+    // Interpolation systems with the same finite element type have the same
+    // DoF layout and L2 mass matrix, so all of them use the L2 projection
+    // solver (and initial guesses) of the first such system instead of each
+    // assembling their own. Each variable still gets its own interpWeighted()
+    // pass over the mesh: every variable has its own one-variable system,
+    // scratch data, and interp spec, and interpWeighted() handles a single
+    // patch data index and system at a time. X_ghost_vec is already
+    // synchronized, so it does not need to be closed again for each variable.
+    std::map<FEType, std::string> projection_system_names;
     for (unsigned int k = 0; k < num_eulerian_vars; ++k)
     {
         System* system = d_scalar_interp_var_systems[k];
         const std::string& system_name = system->name();
+        const std::string& projection_system_name =
+            projection_system_names.emplace(system->get_dof_map().variable_type(0), system_name).first->second;
         const int scratch_idx = d_scalar_interp_scratch_idxs[k];
-        d_fe_data_manager->interp(scratch_idx, *system->solution, *X_ghost_vec, system_name, d_scalar_interp_specs[k]);
+        const FEDataManager::InterpSpec& interp_spec = d_scalar_interp_specs[k];
+        std::unique_ptr<NumericVector<double> > F_rhs_vec = system->solution->zero_clone();
+        d_fe_data_manager->interpWeighted(scratch_idx,
+                                          *F_rhs_vec,
+                                          *X_ghost_vec,
+                                          system_name,
+                                          interp_spec,
+                                          {},
+                                          data_time,
+                                          /*close_F*/ true,
+                                          /*close_X*/ false);
+        d_fe_data_manager->computeL2Projection(*system->solution,
+                                               *F_rhs_vec,
+                                               projection_system_name,
+                                               interp_spec.use_consistent_mass_matrix,
+                                               /*close_U*/ true,
+                                               /*close_F*/ false);
     }
 
     // Deallocate Eulerian scratch space.
@@ -168,6 +168,8 @@ IBMethod::IBMethod(std::string object_name, Pointer<Database> input_db, bool reg
                                                 d_ghosts,
                                                 d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
+    d_l_data_manager->setUseMortonOrdering(d_use_morton_ordering);
+    d_l_data_manager->setUseIncrementalRedistribution(d_use_incremental_redistribution);
 
     // Create the instrument panel object.
     d_instrument_panel =
@@ -2062,8 +2064,12 @@ IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
     }
     TBOX_ASSERT(LEInteractor::isKnownKernel(d_interp_kernel_fcn));
     TBOX_ASSERT(LEInteractor::isKnownKernel(d_spread_kernel_fcn));
+    if (db->isDatabase("LEInteractor")) LEInteractor::setFromDatabase(db->getDatabase("LEInteractor"));
     if (db->keyExists("error_if_points_leave_domain"))
         d_error_if_points_leave_domain = db->getBool("error_if_points_leave_domain");
+    if (db->keyExists("use_morton_ordering")) d_use_morton_ordering = db->getBool("use_morton_ordering");
+    if (db->keyExists("use_incremental_redistribution"))
+        d_use_incremental_redistribution = db->getBool("use_incremental_redistribution");
     if (db->keyExists("force_jac_mffd")) d_force_jac_mffd = db->getBool("force_jac_mffd");
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
@@ -111,6 +111,141 @@ resetLocalOrNonlocalPETScIndices(std::vector<int>& inds,
     }
     return;
 } // resetLocalOrNonlocalPETScIndices
+
+// Returns the parameters of spring k, or nullptr if it has none.
+inline const double*
+get_spring_parameters(const double* const parameters, const int* const parameter_offsets, const int k)
+{
+    return parameter_offsets[k] == parameter_offsets[k + 1] ? nullptr : parameters + parameter_offsets[k];
+} // get_spring_parameters
+
+// Evaluates the default linear spring law.  This is inlined into
+// compute_spring_forces().
+struct DefaultSpringForce
+{
+    inline double operator()(const int k, const double R) const
+    {
+        const double params[2] = { stiffnesses[k], rest_lengths[k] };
+        return default_spring_force(R, params, -1, -1);
+    }
+
+    inline void prefetch(const int k, const int n) const
+    {
+        PREFETCH_READ_NTA_BLOCK(stiffnesses + k, n);
+        PREFETCH_READ_NTA_BLOCK(rest_lengths + k, n);
+    }
+
+    const double* stiffnesses;
+    const double* rest_lengths;
+};
+
+// Evaluates user-registered spring laws through their function pointers.
+struct RegisteredSpringForce
+{
+    inline double operator()(const int k, const double R) const
+    {
+        return (force_fcns[k])(
+            R, get_spring_parameters(parameters, parameter_offsets, k), lag_mastr_node_idxs[k], lag_slave_node_idxs[k]);
+    }
+
+    inline void prefetch(const int k, const int n) const
+    {
+        PREFETCH_READ_NTA_BLOCK(lag_mastr_node_idxs + k, n);
+        PREFETCH_READ_NTA_BLOCK(lag_slave_node_idxs + k, n);
+        PREFETCH_READ_NTA_BLOCK(force_fcns + k, n);
+        PREFETCH_READ_NTA_BLOCK(parameter_offsets + k, n);
+    }
+
+    const SpringForceFcnPtr* force_fcns;
+    const double* parameters;
+    const int* parameter_offsets;
+    const int* lag_mastr_node_idxs;
+    const int* lag_slave_node_idxs;
+};
+
+// Accumulates the force generated by spring k.
+template <class SpringLaw>
+inline void
+compute_spring_force(const int k,
+                     const int mastr_idx,
+                     const int slave_idx,
+                     const SpringLaw& spring_law,
+                     const double* const X_node,
+                     double* const F_node)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(mastr_idx != slave_idx);
+#endif
+    double F[NDIM], D[NDIM];
+    D[0] = X_node[slave_idx + 0] - X_node[mastr_idx + 0];
+    D[1] = X_node[slave_idx + 1] - X_node[mastr_idx + 1];
+#if (NDIM == 3)
+    D[2] = X_node[slave_idx + 2] - X_node[mastr_idx + 2];
+#endif
+#if (NDIM == 2)
+    const double R = std::sqrt(D[0] * D[0] + D[1] * D[1]);
+#endif
+#if (NDIM == 3)
+    const double R = std::sqrt(D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
+#endif
+    if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) return;
+    const double T_over_R = spring_law(k, R) / R;
+    F[0] = T_over_R * D[0];
+    F[1] = T_over_R * D[1];
+#if (NDIM == 3)
+    F[2] = T_over_R * D[2];
+#endif
+    F_node[mastr_idx + 0] += F[0];
+    F_node[mastr_idx + 1] += F[1];
+#if (NDIM == 3)
+    F_node[mastr_idx + 2] += F[2];
+#endif
+    F_node[slave_idx + 0] -= F[0];
+    F_node[slave_idx + 1] -= F[1];
+#if (NDIM == 3)
+    F_node[slave_idx + 2] -= F[2];
+#endif
+    return;
+} // compute_spring_force
+
+// Accumulates the forces generated by springs k_begin, ..., k_end - 1, which
+// all use the same spring law.
+template <class SpringLaw>
+void
+compute_spring_forces(const int k_begin,
+                      const int k_end,
+                      const int* const petsc_mastr_node_idxs,
+                      const int* const petsc_slave_node_idxs,
+                      const SpringLaw& spring_law,
+                      const double* const X_node,
+                      double* const F_node)
+{
+    static const int BLOCKSIZE = 16; // this parameter needs to be tuned
+    const int num_springs = k_end - k_begin;
+    int kblock = 0;
+    for (; kblock < (num_springs - 1) / BLOCKSIZE;
+         ++kblock) // ensure that the last block is NOT handled by this first loop
+    {
+        const int k_next_block = k_begin + BLOCKSIZE * (kblock + 1);
+        PREFETCH_READ_NTA_BLOCK(petsc_mastr_node_idxs + k_next_block, BLOCKSIZE);
+        PREFETCH_READ_NTA_BLOCK(petsc_slave_node_idxs + k_next_block, BLOCKSIZE);
+        spring_law.prefetch(k_next_block, BLOCKSIZE);
+        for (int kunroll = 0; kunroll < BLOCKSIZE; ++kunroll)
+        {
+            const int k = k_begin + kblock * BLOCKSIZE + kunroll;
+            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_mastr_node_idxs[k + 1]);
+            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_slave_node_idxs[k + 1]);
+            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_mastr_node_idxs[k + 1]);
+            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_slave_node_idxs[k + 1]);
+            compute_spring_force(k, petsc_mastr_node_idxs[k], petsc_slave_node_idxs[k], spring_law, X_node, F_node);
+        }
+    }
+    for (int k = k_begin + kblock * BLOCKSIZE; k < k_end; ++k)
+    {
+        compute_spring_force(k, petsc_mastr_node_idxs[k], petsc_slave_node_idxs[k], spring_law, X_node, F_node);
+    }
+    return;
+} // compute_spring_forces
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -139,6 +274,84 @@ IBStandardForceGen::registerSpringForceFunction(const int force_fcn_index,
     return;
 } // registerSpringForceFunction
 
+void
+IBStandardForceGen::resetSpringParameters(const int level_number, LDataManager* const l_data_manager)
+{
+    if (!l_data_manager->levelContainsLagrangianData(level_number)) return;
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(level_number < static_cast<int>(d_spring_data.size()));
+#endif
+    SpringData& spring_data = d_spring_data[level_number];
+    const int num_springs = static_cast<int>(spring_data.force_fcns.size());
+    const int num_default_springs = spring_data.num_default_springs;
+
+    // Collect the parameters of the local springs, which are visited in the
+    // same order as in initializeSpringLevelData().
+    const Pointer<LMesh> mesh = l_data_manager->getLMesh(level_number);
+    const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+    std::vector<const std::vector<double>*> spring_params(num_springs, nullptr);
+    int current_default_spring = 0, current_other_spring = num_default_springs;
+    for (const auto& node_idx : local_nodes)
+    {
+        const IBSpringForceSpec* const force_spec = node_idx->getNodeDataItem<IBSpringForceSpec>();
+        if (!force_spec) continue;
+
+        const std::vector<int>& fcn = force_spec->getForceFunctionIndices();
+        const std::vector<std::vector<double> >& params = force_spec->getParameters();
+        const unsigned int num_node_springs = force_spec->getNumberOfSprings();
+#if !defined(NDEBUG)
+        TBOX_ASSERT(params.empty() || num_node_springs == params.size());
+#endif
+        for (unsigned int k = 0; k < num_node_springs; ++k)
+        {
+            const SpringForceFcnPtr force_fcn = d_spring_force_fcn_map[fcn[k]];
+            const int current_spring =
+                force_fcn == &default_spring_force ? current_default_spring++ : current_other_spring++;
+#if !defined(NDEBUG)
+            TBOX_ASSERT(spring_data.force_fcns[current_spring] == force_fcn);
+#endif
+            if (!params.empty()) spring_params[current_spring] = &params[k];
+        }
+    }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(current_default_spring == num_default_springs);
+    TBOX_ASSERT(current_other_spring == num_springs);
+#endif
+
+    // Copy the parameters into contiguous arrays.
+    std::vector<double>& parameters = spring_data.parameters;
+    std::vector<int>& parameter_offsets = spring_data.parameter_offsets;
+    parameter_offsets.resize(num_springs + 1);
+    parameter_offsets[0] = 0;
+    for (int k = 0; k < num_springs; ++k)
+    {
+        const int num_params = spring_params[k] ? static_cast<int>(spring_params[k]->size()) : 0;
+        parameter_offsets[k + 1] = parameter_offsets[k] + num_params;
+    }
+    parameters.resize(parameter_offsets[num_springs]);
+    for (int k = 0; k < num_springs; ++k)
+    {
+        if (!spring_params[k]) continue;
+        std::copy(spring_params[k]->begin(), spring_params[k]->end(), parameters.begin() + parameter_offsets[k]);
+    }
+
+    // The default spring law uses only the stiffness and the resting length.
+    std::vector<double>& stiffnesses = spring_data.stiffnesses;
+    std::vector<double>& rest_lengths = spring_data.rest_lengths;
+    stiffnesses.resize(num_default_springs);
+    rest_lengths.resize(num_default_springs);
+    for (int k = 0; k < num_default_springs; ++k)
+    {
+#if !defined(NDEBUG)
+        TBOX_ASSERT(parameter_offsets[k + 1] - parameter_offsets[k] >= 2);
+#endif
+        stiffnesses[k] = parameters[parameter_offsets[k]];
+        rest_lengths[k] = parameters[parameter_offsets[k] + 1];
+    }
+    return;
+} // resetSpringParameters
+
 void
 IBStandardForceGen::setUniformBodyForce(IBTK::Vector F, int structure_id, int level_number)
 {
@@ -522,7 +735,8 @@ IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
         const std::vector<int>& petsc_global_slave_node_idxs = d_spring_data[level_number].petsc_global_slave_node_idxs;
         const std::vector<SpringForceFcnPtr>& force_fcns = d_spring_data[level_number].force_fcns;
         const std::vector<SpringForceDerivFcnPtr>& force_deriv_fcns = d_spring_data[level_number].force_deriv_fcns;
-        const std::vector<const double*>& parameters = d_spring_data[level_number].parameters;
+        const std::vector<double>& parameters = d_spring_data[level_number].parameters;
+        const std::vector<int>& parameter_offsets = d_spring_data[level_number].parameter_offsets;
         const double* const X_node = X_ghost_data->getGhostedLocalFormVecArray()->data();
         MatrixNd dF_dX;
         Vector D;
@@ -539,7 +753,7 @@ IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
             int petsc_global_slave_idx = petsc_global_slave_node_idxs[k];
             const SpringForceFcnPtr force_fcn = force_fcns[k];
             const SpringForceDerivFcnPtr force_deriv_fcn = force_deriv_fcns[k];
-            const double* const params = parameters[k];
+            const double* const params = get_spring_parameters(parameters.data(), parameter_offsets.data(), k);
             for (unsigned int i = 0; i < NDIM; ++i)
             {
                 D(i) = X_node[petsc_slave_idx + i] - X_node[petsc_mastr_idx + i];
@@ -726,20 +940,27 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
     std::vector<int>& petsc_global_slave_node_idxs = d_spring_data[level_number].petsc_global_slave_node_idxs;
     std::vector<SpringForceFcnPtr>& force_fcns = d_spring_data[level_number].force_fcns;
     std::vector<SpringForceDerivFcnPtr>& force_deriv_fcns = d_spring_data[level_number].force_deriv_fcns;
-    std::vector<const double*>& parameters = d_spring_data[level_number].parameters;
 
     // The LMesh object provides the set of local Lagrangian nodes.
     const Pointer<LMesh> mesh = l_data_manager->getLMesh(level_number);
     const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
     const int num_local_nodes = static_cast<int>(local_nodes.size());
 
-    // Determine how many springs are associated with the present MPI process.
+    // Determine how many springs are associated with the present MPI process,
+    // and how many of those use the default spring law.
     unsigned int total_num_springs = 0;
+    int num_default_springs = 0;
     for (const auto& node_idx : local_nodes)
     {
         const IBSpringForceSpec* const force_spec = node_idx->getNodeDataItem<IBSpringForceSpec>();
-        if (force_spec) total_num_springs += force_spec->getNumberOfSprings();
+        if (!force_spec) continue;
+        total_num_springs += force_spec->getNumberOfSprings();
+        for (const int fcn_idx : force_spec->getForceFunctionIndices())
+        {
+            if (d_spring_force_fcn_map[fcn_idx] == &default_spring_force) ++num_default_springs;
+        }
     }
+    d_spring_data[level_number].num_default_springs = num_default_springs;
 
     // Resize arrays for storing cached values used to compute spring forces.
     lag_mastr_node_idxs.resize(total_num_springs);
@@ -750,10 +971,12 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
     petsc_global_slave_node_idxs.resize(total_num_springs);
     force_fcns.resize(total_num_springs);
     force_deriv_fcns.resize(total_num_springs);
-    parameters.resize(total_num_springs);
 
     // Setup the data structures used to compute spring forces.
-    int current_spring = 0;
+    //
+    // NOTE: Springs that use the default spring law are stored contiguously
+    // before all other springs.
+    int current_default_spring = 0, current_other_spring = num_default_springs;
     for (const auto& node_idx : local_nodes)
     {
         const IBSpringForceSpec* const force_spec = node_idx->getNodeDataItem<IBSpringForceSpec>();
@@ -766,25 +989,27 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
         const int petsc_idx = node_idx->getGlobalPETScIndex();
         const std::vector<int>& slv = force_spec->getSlaveNodeIndices();
         const std::vector<int>& fcn = force_spec->getForceFunctionIndices();
-        const std::vector<std::vector<double> >& params = force_spec->getParameters();
         const unsigned int num_springs = force_spec->getNumberOfSprings();
 #if !defined(NDEBUG)
         TBOX_ASSERT(num_springs == slv.size());
         TBOX_ASSERT(num_springs == fcn.size());
-        TBOX_ASSERT(num_springs == params.size());
 #endif
         for (unsigned int k = 0; k < num_springs; ++k)
         {
+            const SpringForceFcnPtr force_fcn = d_spring_force_fcn_map[fcn[k]];
+            const int current_spring =
+                force_fcn == &default_spring_force ? current_default_spring++ : current_other_spring++;
             lag_mastr_node_idxs[current_spring] = lag_idx;
             lag_slave_node_idxs[current_spring] = slv[k];
             petsc_mastr_node_idxs[current_spring] = petsc_idx;
-            force_fcns[current_spring] = d_spring_force_fcn_map[fcn[k]];
+            force_fcns[current_spring] = force_fcn;
             force_deriv_fcns[current_spring] = d_spring_force_deriv_fcn_map[fcn[k]];
-            parameters[current_spring] = params.empty() ? nullptr : &params[k][0];
-            ++current_spring;
         }
     }
 
+    // Copy the spring parameters.
+    resetSpringParameters(level_number, l_data_manager);
+
     // Map the Lagrangian slave node indices to the PETSc indices corresponding
     // to the present data distribution.
     petsc_slave_node_idxs = lag_slave_node_idxs;
@@ -826,102 +1051,32 @@ IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
     const int* const petsc_slave_node_idxs =
         uses_springs ? &d_spring_data[level_number].petsc_slave_node_idxs[0] : nullptr;
     const SpringForceFcnPtr* const force_fcns = uses_springs ? &d_spring_data[level_number].force_fcns[0] : nullptr;
-    const double** const parameters = uses_springs ? &d_spring_data[level_number].parameters[0] : nullptr;
+    const double* const parameters = d_spring_data[level_number].parameters.data();
+    const int* const parameter_offsets = d_spring_data[level_number].parameter_offsets.data();
+    const double* const stiffnesses = d_spring_data[level_number].stiffnesses.data();
+    const double* const rest_lengths = d_spring_data[level_number].rest_lengths.data();
     double* const F_node = F_data->getLocalFormVecArray()->data();
     const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
 
-    static const int BLOCKSIZE = 16; // this parameter needs to be tuned
-    int k, kblock, kunroll, mastr_idx, slave_idx;
-    double F[NDIM], D[NDIM], R, T_over_R;
-    kblock = 0;
-    for (; kblock < (num_springs - 1) / BLOCKSIZE;
-         ++kblock) // ensure that the last block is NOT handled by this first loop
-    {
-        PREFETCH_READ_NTA_BLOCK(lag_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(lag_slave_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_slave_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(force_fcns + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(parameters + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        for (kunroll = 0; kunroll < BLOCKSIZE; ++kunroll)
-        {
-            k = kblock * BLOCKSIZE + kunroll;
-            mastr_idx = petsc_mastr_node_idxs[k];
-            slave_idx = petsc_slave_node_idxs[k];
-#if !defined(NDEBUG)
-            TBOX_ASSERT(mastr_idx != slave_idx);
-#endif
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_slave_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_slave_node_idxs[k + 1]);
-            PREFETCH_READ_NTA(parameters[k + 1]);
-            D[0] = X_node[slave_idx + 0] - X_node[mastr_idx + 0];
-            D[1] = X_node[slave_idx + 1] - X_node[mastr_idx + 1];
-#if (NDIM == 3)
-            D[2] = X_node[slave_idx + 2] - X_node[mastr_idx + 2];
-#endif
-#if (NDIM == 2)
-            R = std::sqrt(D[0] * D[0] + D[1] * D[1]);
-#endif
-#if (NDIM == 3)
-            R = std::sqrt(D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
-#endif
-            if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) continue;
-            T_over_R = (force_fcns[k])(R, parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]) / R;
-            F[0] = T_over_R * D[0];
-            F[1] = T_over_R * D[1];
-#if (NDIM == 3)
-            F[2] = T_over_R * D[2];
-#endif
-            F_node[mastr_idx + 0] += F[0];
-            F_node[mastr_idx + 1] += F[1];
-#if (NDIM == 3)
-            F_node[mastr_idx + 2] += F[2];
-#endif
-            F_node[slave_idx + 0] -= F[0];
-            F_node[slave_idx + 1] -= F[1];
-#if (NDIM == 3)
-            F_node[slave_idx + 2] -= F[2];
-#endif
-        }
-    }
-    for (k = kblock * BLOCKSIZE; k < num_springs; ++k)
-    {
-        mastr_idx = petsc_mastr_node_idxs[k];
-        slave_idx = petsc_slave_node_idxs[k];
-#if !defined(NDEBUG)
-        TBOX_ASSERT(mastr_idx != slave_idx);
-#endif
-        D[0] = X_node[slave_idx + 0] - X_node[mastr_idx + 0];
-        D[1] = X_node[slave_idx + 1] - X_node[mastr_idx + 1];
-#if (NDIM == 3)
-        D[2] = X_node[slave_idx + 2] - X_node[mastr_idx + 2];
-#endif
-#if (NDIM == 2)
-        R = std::sqrt(D[0] * D[0] + D[1] * D[1]);
-#endif
-#if (NDIM == 3)
-        R = std::sqrt(D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
-#endif
-        if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) continue;
-        T_over_R = (force_fcns[k])(R, parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]) / R;
-        F[0] = T_over_R * D[0];
-        F[1] = T_over_R * D[1];
-#if (NDIM == 3)
-        F[2] = T_over_R * D[2];
-#endif
-        F_node[mastr_idx + 0] += F[0];
-        F_node[mastr_idx + 1] += F[1];
-#if (NDIM == 3)
-        F_node[mastr_idx + 2] += F[2];
-#endif
-        F_node[slave_idx + 0] -= F[0];
-        F_node[slave_idx + 1] -= F[1];
-#if (NDIM == 3)
-        F_node[slave_idx + 2] -= F[2];
-#endif
-    }
+    // Springs that use the default spring law are stored first so that the
+    // law can be inlined.  All remaining springs are evaluated through their
+    // registered force functions.
+    const int num_default_springs = d_spring_data[level_number].num_default_springs;
+    compute_spring_forces(0,
+                          num_default_springs,
+                          petsc_mastr_node_idxs,
+                          petsc_slave_node_idxs,
+                          DefaultSpringForce{ stiffnesses, rest_lengths },
+                          X_node,
+                          F_node);
+    compute_spring_forces(num_default_springs,
+                          num_springs,
+                          petsc_mastr_node_idxs,
+                          petsc_slave_node_idxs,
+                          RegisteredSpringForce{
+                              force_fcns, parameters, parameter_offsets, lag_mastr_node_idxs, lag_slave_node_idxs },
+                          X_node,
+                          F_node);
 
     F_data->restoreArrays();
     X_data->restoreArrays();
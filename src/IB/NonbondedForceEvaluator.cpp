@@ -15,9 +15,11 @@
 
 #include "ibamr/NonbondedForceEvaluator.h"
 
+#include "ibtk/IBTK_MPI.h"
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
 #include "ibtk/LIndexSetData.h"
+#include "ibtk/LMesh.h"
 #include "ibtk/LNode.h"
 #include "ibtk/LNodeSet.h"
 #include "ibtk/LNodeSetData.h"
@@ -37,11 +39,17 @@
 #include "petscvec.h"
 #include <petscsys.h>
 
+IBTK_DISABLE_EXTRA_WARNINGS
+#include <boost/multi_array.hpp>
+IBTK_ENABLE_EXTRA_WARNINGS
+
 #include <assert.h>
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <string>
+#include <vector>
 
 #include "ibamr/app_namespaces.h" // IWYU pragma: keep
 
@@ -82,13 +90,21 @@ NonbondedForceEvaluator::NonbondedForceEvaluator(Pointer<Database> input_db,
 
     // get parameters for force function
     d_parameters = input_db->getDoubleArray("parameters");
+
+    // get neighbor list settings
+    if (input_db->keyExists("use_neighbor_list")) d_use_neighbor_list = input_db->getBool("use_neighbor_list");
+    if (input_db->keyExists("neighbor_list_skin")) d_neighbor_list_skin = input_db->getDouble("neighbor_list_skin");
+    if (d_neighbor_list_skin < 0.0)
+    {
+        TBOX_ERROR("neighbor_list_skin for NonbondedForceEvaluator must be nonnegative.");
+    }
 }
 
 void
 NonbondedForceEvaluator::evaluateForces(int mstr_petsc_idx,
                                         int search_petsc_idx,
                                         Pointer<LData> X_data,
-                                        std::vector<int> cell_offset,
+                                        const std::vector<int>& cell_offset,
                                         Pointer<LData> F_data)
 {
     //   Function to add nonbonded forces from the interaction between the nodes at
@@ -131,13 +147,14 @@ NonbondedForceEvaluator::evaluateForces(int mstr_petsc_idx,
     R = std::sqrt(R);
 
     double nonbdd_force[NDIM];
-    (d_force_fcn_ptr)(D, d_parameters, nonbdd_force);
+    evaluateForceFcn(D, nonbdd_force);
     for (int k = 0; k < NDIM; ++k)
     {
         force[mstr_petsc_idx * NDIM + k] += nonbdd_force[k];
         force[search_petsc_idx * NDIM + k] += -1.0 * nonbdd_force[k];
     }
     VecRestoreArray(F_data->getVec(), &force);
+    VecRestoreArray(X_data->getVec(), &position);
     return;
 } // evaluateForces
 
@@ -159,7 +176,84 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
     const double* const x_lower = grid_geom->getXLower();
     const double* const x_upper = grid_geom->getXUpper();
 
+    if (d_use_neighbor_list)
+    {
+        if (d_neighbor_lists.size() <= static_cast<std::size_t>(level_number))
+        {
+            d_neighbor_lists.resize(level_number + 1);
+        }
+        NeighborList& neighbor_list = d_neighbor_lists[level_number];
+
+        // The ghost node positions are needed to compute forces from nodes on
+        // other processors.
+        X_data->beginGhostUpdate();
+        X_data->endGhostUpdate();
+        const boost::multi_array_ref<double, 2>& X_array = *X_data->getGhostedLocalFormVecArray();
+        const double* const X = X_array.data();
+        const std::size_t num_values = X_array.num_elements();
+
+        // The list must be rebuilt whenever the data have been redistributed
+        // (because the local PETSc indices may have changed) or some node has
+        // moved more than half of the skin distance in some direction since
+        // the list was built. The lists on all processors must be rebuilt
+        // together since each one contains pairs with nodes owned by other
+        // processors.
+        bool rebuild_list = !neighbor_list.mesh ||
+                            neighbor_list.mesh.getPointer() != l_data_manager->getLMesh(level_number).getPointer() ||
+                            neighbor_list.X_build.size() != num_values;
+        const double* const dx_coarsest = grid_geom->getDx();
+        const IntVector<NDIM>& ratio = hierarchy->getPatchLevel(level_number)->getRatio();
+        double max_displacement[NDIM];
+        for (int k = 0; k < NDIM; ++k) max_displacement[k] = 0.5 * d_neighbor_list_skin * dx_coarsest[k] / ratio(k);
+        for (std::size_t i = 0; i < num_values && !rebuild_list; i += NDIM)
+        {
+            for (int k = 0; k < NDIM; ++k)
+            {
+                rebuild_list = rebuild_list || std::abs(X[i + k] - neighbor_list.X_build[i + k]) > max_displacement[k];
+            }
+        }
+        X_data->restoreArrays();
+        rebuild_list = IBTK_MPI::maxReduction(static_cast<int>(rebuild_list)) != 0;
+        if (rebuild_list) buildNeighborList(X_data, hierarchy, level_number, l_data_manager);
+
+        // Accumulate the forces on the local nodes.
+        const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
+        double* const F_node = F_data->getLocalFormVecArray()->data();
+        double D[NDIM], nonbdd_force[NDIM];
+        for (const NeighborPair& pair : neighbor_list.local_pairs)
+        {
+            for (int k = 0; k < NDIM; ++k)
+            {
+                D[k] = X_node[pair.mstr_petsc_idx * NDIM + k] - X_node[pair.search_petsc_idx * NDIM + k] -
+                       pair.shift[k];
+            }
+            evaluateForceFcn(D, nonbdd_force);
+            for (int k = 0; k < NDIM; ++k)
+            {
+                F_node[pair.mstr_petsc_idx * NDIM + k] += nonbdd_force[k];
+                F_node[pair.search_petsc_idx * NDIM + k] -= nonbdd_force[k];
+            }
+        }
+        for (const NeighborPair& pair : neighbor_list.nonlocal_pairs)
+        {
+            for (int k = 0; k < NDIM; ++k)
+            {
+                D[k] = X_node[pair.mstr_petsc_idx * NDIM + k] - X_node[pair.search_petsc_idx * NDIM + k] -
+                       pair.shift[k];
+            }
+            evaluateForceFcn(D, nonbdd_force);
+            for (int k = 0; k < NDIM; ++k)
+            {
+                F_node[pair.mstr_petsc_idx * NDIM + k] += nonbdd_force[k];
+            }
+        }
+        X_data->restoreArrays();
+        F_data->restoreArrays();
+        return;
+    }
+
     // we will grow the search box by interaction_radius + 2.0*regrid_alpha
+    // (both in units of the grid spacing)
     IntVector<NDIM> grow_amount(static_cast<int>(ceil(d_interaction_radius + 2.0 * d_regrid_alpha)));
     const int lag_node_idx_current_idx = l_data_manager->getLNodePatchDescriptorIndex();
 
@@ -242,6 +336,141 @@ NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
     return;
 } // registerForceFcnPtr
 
+void
+NonbondedForceEvaluator::registerForceFcnPtr(NonBddRawForceFcnPtr force_fcn_ptr)
+{
+    // set the nonbonded force function pointer to the given force function pointer
+    d_raw_force_fcn_ptr = force_fcn_ptr;
+    return;
+} // registerForceFcnPtr
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+NonbondedForceEvaluator::evaluateForceFcn(double* D, double* out_force) const
+{
+    if (d_raw_force_fcn_ptr)
+    {
+        (d_raw_force_fcn_ptr)(D, d_parameters.getPointer(), out_force);
+    }
+    else
+    {
+        (d_force_fcn_ptr)(D, d_parameters, out_force);
+    }
+    return;
+} // evaluateForceFcn
+
+void
+NonbondedForceEvaluator::buildNeighborList(Pointer<LData> X_data,
+                                           const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                           const int level_number,
+                                           LDataManager* const l_data_manager)
+{
+    NeighborList& neighbor_list = d_neighbor_lists[level_number];
+    neighbor_list.local_pairs.clear();
+    neighbor_list.nonlocal_pairs.clear();
+
+    // Keep the positions and the mesh used to build the list so that we can
+    // later determine whether the list is still valid.
+    const boost::multi_array_ref<double, 2>& X_array = *X_data->getGhostedLocalFormVecArray();
+    const double* const X_node = X_array.data();
+    neighbor_list.X_build.assign(X_node, X_node + X_array.num_elements());
+    neighbor_list.mesh = l_data_manager->getLMesh(level_number);
+    const int num_local_nodes = static_cast<int>(X_data->getLocalNodeCount());
+
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+    const double* const x_lower = grid_geom->getXLower();
+    const double* const x_upper = grid_geom->getXUpper();
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    const Box<NDIM> domain_box = Box<NDIM>::refine(grid_geom->getPhysicalDomain()[0], level->getRatio());
+    const int lag_node_idx_current_idx = l_data_manager->getLNodePatchDescriptorIndex();
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<LNodeSetData> current_idx_data = patch->getPatchData(lag_node_idx_current_idx);
+        const Box<NDIM>& patch_box = patch->getBox();
+        const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+        const double* const patch_dx = patch_geom->getDx();
+
+        // The list contains the pairs of nodes that are less than
+        // interaction_radius + neighbor_list_skin cells apart in each
+        // direction. Since the nodes may have moved up to regrid_alpha cells
+        // out of the cells in which they are stored, the search region must
+        // also include that margin.
+        double list_radius[NDIM];
+        IntVector<NDIM> grow_amount;
+        for (int k = 0; k < NDIM; ++k)
+        {
+            list_radius[k] = (d_interaction_radius + d_neighbor_list_skin) * patch_dx[k];
+            grow_amount(k) =
+                static_cast<int>(std::ceil(d_interaction_radius + d_neighbor_list_skin + 2.0 * d_regrid_alpha));
+            if (grow_amount(k) > current_idx_data->getGhostCellWidth()(k))
+            {
+                TBOX_ERROR("NonbondedForceEvaluator::buildNeighborList():\n"
+                           << "  the neighbor list search region is wider than the ghost cell width of the "
+                              "Lagrangian index data.\n"
+                           << "  reduce interaction_radius, neighbor_list_skin, or regrid_alpha, or increase the "
+                              "ghost cell width.\n");
+            }
+        }
+
+        for (LNodeSetData::CellIterator cit(patch_box); cit; cit++)
+        {
+            const hier::Index<NDIM>& mstr_cell_idx = *cit;
+            const LNodeSet* const mstr_node_set = current_idx_data->getItem(mstr_cell_idx);
+            if (!mstr_node_set) continue;
+            const Box<NDIM> search_box = Box<NDIM>::grow(Box<NDIM>(mstr_cell_idx, mstr_cell_idx), grow_amount);
+            for (LNodeSetData::CellIterator scit(search_box); scit; scit++)
+            {
+                const hier::Index<NDIM>& search_cell_idx = *scit;
+                const LNodeSet* const search_node_set = current_idx_data->getItem(search_cell_idx);
+                if (!search_node_set) continue;
+
+                // Periodic shift of the nodes in this search cell.
+                NeighborPair pair;
+                for (int k = 0; k < NDIM; ++k)
+                {
+                    const double offset = std::floor(static_cast<double>(search_cell_idx(k) - domain_box.lower(k)) /
+                                                     static_cast<double>(domain_box.numberCells(k)));
+                    pair.shift[k] = offset * (x_upper[k] - x_lower[k]);
+                }
+
+                for (const auto& mstr_node_idx : *mstr_node_set)
+                {
+                    const int mstr_lag_idx = mstr_node_idx->getLagrangianIndex();
+                    pair.mstr_petsc_idx = mstr_node_idx->getLocalPETScIndex();
+                    for (const auto& search_node_idx : *search_node_set)
+                    {
+                        pair.search_petsc_idx = search_node_idx->getLocalPETScIndex();
+                        const bool search_node_is_local = pair.search_petsc_idx < num_local_nodes;
+
+                        // Pairs of local nodes are found from both sides, so
+                        // we keep only one of them.  Pairs involving a ghost
+                        // node are found only once on this processor.
+                        if (search_node_is_local && mstr_lag_idx >= search_node_idx->getLagrangianIndex()) continue;
+
+                        bool in_range = true;
+                        for (int k = 0; k < NDIM && in_range; ++k)
+                        {
+                            const double D = X_node[pair.mstr_petsc_idx * NDIM + k] -
+                                             X_node[pair.search_petsc_idx * NDIM + k] - pair.shift[k];
+                            in_range = std::abs(D) < list_radius[k];
+                        }
+                        if (!in_range) continue;
+
+                        if (search_node_is_local)
+                            neighbor_list.local_pairs.push_back(pair);
+                        else
+                            neighbor_list.nonlocal_pairs.push_back(pair);
+                    }
+                }
+            }
+        }
+    }
+    X_data->restoreArrays();
+    return;
+} // buildNeighborList
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
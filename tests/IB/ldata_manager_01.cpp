@@ -0,0 +1,278 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+#include <VariableDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/LNodeSetData.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <utility>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify the options of LDataManager that change how Lagrangian data are
+// stored: the local PETSc indices of the nodes in each patch must be
+// contiguous and follow a Morton curve through the cells of the patch,
+// repeated interpolation from unmoved nodes must reuse the cached delta
+// function weights, and regridding without node migration must keep the
+// existing parallel data structures and node ordering.
+
+namespace
+{
+// A square array of nodes that covers several patches.
+int num_nodes_per_side;
+
+void
+generate_structure(const unsigned int& /*strct_num*/,
+                   const int& /*ln*/,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn,
+                   void* /*ctx*/)
+{
+    const double ds = 0.5 / num_nodes_per_side;
+    num_vertices = num_nodes_per_side * num_nodes_per_side;
+    vertex_posn.resize(num_vertices);
+    for (int j = 0; j < num_nodes_per_side; ++j)
+    {
+        for (int i = 0; i < num_nodes_per_side; ++i)
+        {
+            vertex_posn[j * num_nodes_per_side + i] = IBTK::Point(0.25 + (i + 0.5) * ds, 0.25 + (j + 0.5) * ds);
+        }
+    }
+    return;
+}
+
+// Count the nodes in the patch interiors on the level and the nodes whose
+// local PETSc index does not directly follow that of the previous node of the
+// patch along the Morton curve.
+void
+check_morton_ordering(int& num_nodes,
+                      int& num_nodes_out_of_order,
+                      Pointer<PatchHierarchy<NDIM> > hierarchy,
+                      const int level_number,
+                      LDataManager* const l_data_manager)
+{
+    num_nodes = 0;
+    num_nodes_out_of_order = 0;
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    const int lag_node_index_idx = l_data_manager->getLNodePatchDescriptorIndex();
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<LNodeSetData> idx_data = patch->getPatchData(lag_node_index_idx);
+        const hier::Index<NDIM>& ghost_lower = idx_data->getGhostBox().lower();
+        std::vector<std::pair<std::uint64_t, int> > patch_nodes;
+        for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box); it != idx_data->data_end(); ++it)
+        {
+            patch_nodes.emplace_back(IndexUtilities::getMortonIndex(it.getCellIndex(), ghost_lower),
+                                     (*it)->getLocalPETScIndex());
+        }
+        std::stable_sort(patch_nodes.begin(),
+                         patch_nodes.end(),
+                         [](const std::pair<std::uint64_t, int>& a, const std::pair<std::uint64_t, int>& b) {
+                             return a.first < b.first;
+                         });
+        for (unsigned int k = 1; k < patch_nodes.size(); ++k)
+        {
+            if (patch_nodes[k].second != patch_nodes[k - 1].second + 1) ++num_nodes_out_of_order;
+        }
+        num_nodes += static_cast<int>(patch_nodes.size());
+    }
+    num_nodes = IBTK_MPI::sumReduction(num_nodes);
+    num_nodes_out_of_order = IBTK_MPI::sumReduction(num_nodes_out_of_order);
+    return;
+}
+
+// Collect the local PETSc indices of the nodes in the patch interiors on the
+// level, keyed on their Lagrangian indices.
+std::map<int, int>
+get_local_petsc_indices(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                        const int level_number,
+                        LDataManager* const l_data_manager)
+{
+    std::map<int, int> local_petsc_indices;
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    const int lag_node_index_idx = l_data_manager->getLNodePatchDescriptorIndex();
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<LNodeSetData> idx_data = patch->getPatchData(lag_node_index_idx);
+        for (LNodeSetData::DataIterator it = idx_data->data_begin(patch->getBox()); it != idx_data->data_end(); ++it)
+        {
+            local_petsc_indices[(*it)->getLagrangianIndex()] = (*it)->getLocalPETScIndex();
+        }
+    }
+    return local_petsc_indices;
+}
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        num_nodes_per_side = input_db->getInteger("NUM_NODES_PER_SIDE");
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        ib_initializer->setStructureNamesOnLevel(input_db->getInteger("MAX_LEVELS") - 1, { "square" });
+        ib_initializer->registerInitStructureFunction(generate_structure);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+
+        // Create a scalar Eulerian quantity to interpolate.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<CellVariable<NDIM, double> > q_var = new CellVariable<NDIM, double>("q");
+        const int q_idx = var_db->registerVariableAndContext(
+            q_var, var_db->getContext("q"), ib_method_ops->getLDataManager()->getGhostCellWidth());
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        LDataManager* const l_data_manager = ib_method_ops->getLDataManager();
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        std::ofstream out;
+        if (IBTK_MPI::getRank() == 0) out.open("output");
+
+        // Check the ordering of the local PETSc indices.
+        int num_nodes, num_nodes_out_of_order;
+        check_morton_ordering(num_nodes, num_nodes_out_of_order, patch_hierarchy, finest_ln, l_data_manager);
+        if (IBTK_MPI::getRank() == 0)
+        {
+            out << "number of nodes in patch interiors: " << num_nodes << '\n';
+            out << "number of nodes out of Morton order: " << num_nodes_out_of_order << '\n';
+        }
+
+        // Interpolate twice without moving the nodes: the first interpolation
+        // computes the weights of every node and the second one reuses them.
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(finest_ln);
+        level->allocatePatchData(q_idx);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<CellData<NDIM, double> > q_data = level->getPatch(p())->getPatchData(q_idx);
+            q_data->fillAll(1.0);
+        }
+        Pointer<LData> Q_data = l_data_manager->createLData("Q", finest_ln, 1);
+        Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, finest_ln);
+        LEInteractor::clearWeightCache();
+        for (int k = 0; k < 2; ++k)
+        {
+            l_data_manager->interp(q_idx, Q_data, X_data, finest_ln);
+            const auto num_hits = IBTK_MPI::sumReduction(static_cast<int>(LEInteractor::getNumberOfWeightCacheHits()));
+            const auto num_misses =
+                IBTK_MPI::sumReduction(static_cast<int>(LEInteractor::getNumberOfWeightCacheMisses()));
+            if (IBTK_MPI::getRank() == 0)
+            {
+                out << "interpolation " << k << ": weight cache hits: " << num_hits
+                    << " weight cache misses: " << num_misses << '\n';
+            }
+        }
+        level->deallocatePatchData(q_idx);
+
+        // Regrid without moving the nodes. Since no node changes processors,
+        // the AO, the local ordering, and the LData vectors are all kept.
+        AO old_ao = l_data_manager->getAO(finest_ln);
+        const std::map<int, int> old_local_petsc_indices =
+            get_local_petsc_indices(patch_hierarchy, finest_ln, l_data_manager);
+        Vec old_X_vec = X_data->getVec();
+        time_integrator->regridHierarchy();
+        const int num_new_aos = IBTK_MPI::sumReduction(static_cast<int>(l_data_manager->getAO(finest_ln) != old_ao));
+        const std::map<int, int> new_local_petsc_indices =
+            get_local_petsc_indices(patch_hierarchy, finest_ln, l_data_manager);
+        int num_renumbered_nodes = 0;
+        for (const auto& index_pair : new_local_petsc_indices)
+        {
+            const auto old_it = old_local_petsc_indices.find(index_pair.first);
+            if (old_it == old_local_petsc_indices.end() || old_it->second != index_pair.second) ++num_renumbered_nodes;
+        }
+        num_renumbered_nodes = IBTK_MPI::sumReduction(num_renumbered_nodes);
+        X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, finest_ln);
+        const int num_new_vecs = IBTK_MPI::sumReduction(static_cast<int>(X_data->getVec() != old_X_vec));
+        if (IBTK_MPI::getRank() == 0)
+        {
+            out << "number of processors with a new AO after regridding: " << num_new_aos << '\n';
+            out << "number of nodes with a new local PETSc index after regridding: " << num_renumbered_nodes << '\n';
+            out << "number of processors with new LData vectors after regridding: " << num_new_vecs << '\n';
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,228 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+#include <petscvec.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBLagrangianForceStrategy.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibamr/NonbondedForceEvaluator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify that NonbondedForceEvaluator computes the same forces with and
+// without the Verlet neighbor list while the nodes are advected by a flow
+// (and so move between cells, trigger regrids, and trigger rebuilds of the
+// neighbor list) over many time steps.
+
+namespace
+{
+// Two concentric rings of nodes that are much closer to each other than the
+// interaction radius.
+int num_nodes_per_ring;
+
+void
+generate_structure(const unsigned int& /*strct_num*/,
+                   const int& /*ln*/,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn,
+                   void* /*ctx*/)
+{
+    const double dx = 1.0 / 32.0;
+    num_vertices = 2 * num_nodes_per_ring;
+    vertex_posn.resize(num_vertices);
+    for (int ring = 0; ring < 2; ++ring)
+    {
+        const double r = 0.2 + 0.5 * ring * dx;
+        for (int k = 0; k < num_nodes_per_ring; ++k)
+        {
+            const double theta = 2.0 * M_PI * k / num_nodes_per_ring;
+            vertex_posn[ring * num_nodes_per_ring + k] =
+                IBTK::Point(0.5 + r * std::cos(theta), 0.5 + r * std::sin(theta));
+        }
+    }
+    return;
+}
+
+// Soft repulsive force with compact support: params[0] is the cutoff distance
+// and params[1] is the stiffness.
+void
+soft_repulsion(const double* D, const double* params, double* out_force)
+{
+    double R = 0.0;
+    for (int d = 0; d < NDIM; ++d) R += D[d] * D[d];
+    R = std::sqrt(R);
+    for (int d = 0; d < NDIM; ++d)
+    {
+        out_force[d] = (R > 0.0 && R < params[0]) ? params[1] * (1.0 - R / params[0]) * D[d] / R : 0.0;
+    }
+    return;
+}
+
+// Force strategy which computes the force both without and with the neighbor
+// list and records the largest difference relative to the largest force.
+class ComparisonForce : public IBLagrangianForceStrategy
+{
+public:
+    ComparisonForce(Pointer<NonbondedForceEvaluator> direct_force, Pointer<NonbondedForceEvaluator> list_force)
+        : d_direct_force(direct_force), d_list_force(list_force)
+    {
+    }
+
+    void computeLagrangianForce(Pointer<LData> F_data,
+                                Pointer<LData> X_data,
+                                Pointer<LData> U_data,
+                                const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                const int level_number,
+                                const double data_time,
+                                LDataManager* const l_data_manager) override
+    {
+        d_direct_force->computeLagrangianForce(
+            F_data, X_data, U_data, hierarchy, level_number, data_time, l_data_manager);
+
+        Pointer<LData> F_list_data = l_data_manager->createLData("F_list", level_number, NDIM);
+        VecSet(F_list_data->getVec(), 0.0);
+        d_list_force->computeLagrangianForce(
+            F_list_data, X_data, U_data, hierarchy, level_number, data_time, l_data_manager);
+
+        double F_max = 0.0, diff_max = 0.0;
+        VecNorm(F_data->getVec(), NORM_INFINITY, &F_max);
+        VecAXPY(F_list_data->getVec(), -1.0, F_data->getVec());
+        VecNorm(F_list_data->getVec(), NORM_INFINITY, &diff_max);
+        d_max_rel_diff = std::max(d_max_rel_diff, F_max > 0.0 ? diff_max / F_max : diff_max);
+    }
+
+    Pointer<NonbondedForceEvaluator> d_direct_force, d_list_force;
+    double d_max_rel_diff = 0.0;
+};
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        num_nodes_per_ring = input_db->getInteger("NUM_NODES_PER_RING");
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        ib_initializer->setStructureNamesOnLevel(0, { "rings" });
+        ib_initializer->registerInitStructureFunction(generate_structure);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+
+        Pointer<Database> nonbonded_db = app_initializer->getComponentDatabase("NonbondedForceEvaluator");
+        Pointer<NonbondedForceEvaluator> direct_force = new NonbondedForceEvaluator(nonbonded_db, grid_geometry);
+        direct_force->registerForceFcnPtr(soft_repulsion);
+        nonbonded_db->putBool("use_neighbor_list", true);
+        Pointer<NonbondedForceEvaluator> list_force = new NonbondedForceEvaluator(nonbonded_db, grid_geometry);
+        list_force->registerForceFcnPtr(soft_repulsion);
+        Pointer<ComparisonForce> comparison_force = new ComparisonForce(direct_force, list_force);
+        ib_method_ops->registerIBLagrangianForceFunction(comparison_force);
+
+        // Create Eulerian initial condition specification objects.
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        // Main time step loop.
+        double loop_time = time_integrator->getIntegratorTime();
+        const double loop_time_end = time_integrator->getEndTime();
+        int num_steps = 0;
+        while (!IBTK::rel_equal_eps(loop_time, loop_time_end) && time_integrator->stepsRemaining())
+        {
+            const double dt = time_integrator->getMaximumTimeStepSize();
+            time_integrator->advanceHierarchy(dt);
+            loop_time += dt;
+            ++num_steps;
+        }
+        const int num_nodes = ib_method_ops->getLDataManager()->getNumberOfNodes(0);
+
+        // The forces are summed in different orders, so they only agree to
+        // roundoff.
+        if (IBTK_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "number of nodes: " << num_nodes << '\n';
+            out << "number of time steps: " << num_steps << '\n';
+            out << "max relative difference with and without the neighbor list: " << comparison_force->d_max_rel_diff
+                << '\n';
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
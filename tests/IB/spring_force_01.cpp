@@ -0,0 +1,339 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+#include <petscvec.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBLagrangianForceStrategy.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/IBSpringForceFunctions.h>
+#include <ibamr/IBSpringForceSpec.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LMesh.h>
+#include <ibtk/LNode.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <utility>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify that IBStandardForceGen computes the same spring forces when the
+// springs use a mix of the default spring law and a user-registered law as
+// when every spring is evaluated through a function pointer. The two laws are
+// interleaved along the structure and the spring parameters vary from spring
+// to spring, so that a spring evaluated with the wrong law or with the wrong
+// parameters would change the force. The nodes are advected by a flow so that
+// the spring data are also reinitialized after regrids. Finally, the
+// stiffnesses are doubled in place and IBStandardForceGen::resetSpringParameters()
+// is called, which must exactly double the forces.
+
+namespace
+{
+// A closed, wavy ring of nodes. Every node is connected to its two nearest
+// neighbors on each side.
+int num_nodes;
+double stiffness;
+
+void
+generate_structure(const unsigned int& /*strct_num*/,
+                   const int& /*ln*/,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn,
+                   void* /*ctx*/)
+{
+    num_vertices = num_nodes;
+    vertex_posn.resize(num_vertices);
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        const double theta = 2.0 * M_PI * k / num_nodes;
+        const double r = 0.2 + 0.02 * std::sin(3.0 * theta);
+        vertex_posn[k] = IBTK::Point(0.5 + r * std::cos(theta), 0.5 + r * std::sin(theta));
+    }
+    return;
+}
+
+void
+generate_springs(
+    const unsigned int& /*strct_num*/,
+    const int& /*ln*/,
+    std::multimap<int, IBRedundantInitializer::Edge>& spring_map,
+    std::map<IBRedundantInitializer::Edge, IBRedundantInitializer::SpringSpec, IBRedundantInitializer::EdgeComp>&
+        spring_spec,
+    void* /*ctx*/)
+{
+    const double ds = 2.0 * M_PI * 0.2 / num_nodes;
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        for (int offset = 1; offset <= 2; ++offset)
+        {
+            IBRedundantInitializer::Edge e;
+            e.first = k;
+            e.second = (k + offset) % num_nodes;
+            if (e.first > e.second) std::swap(e.first, e.second);
+            spring_map.insert(std::make_pair(e.first, e));
+            IBRedundantInitializer::SpringSpec spec_data;
+            spec_data.parameters.resize(2);
+            spec_data.parameters[0] = stiffness * (1.0 + 0.5 * std::sin(static_cast<double>(k + offset)));
+            spec_data.parameters[1] = 0.5 * offset * ds * (1.0 + 0.1 * (k % 5));
+            spec_data.force_fcn_idx = (k + offset) % 3 == 0 ? 1 : 0;
+            spring_spec.insert(std::make_pair(e, spec_data));
+        }
+    }
+    return;
+}
+
+// The same linear law as default_spring_force(). Since it is a different
+// function, IBStandardForceGen evaluates it through a function pointer.
+double
+linear_spring_force(double R, const double* params, int /*lag_mastr_idx*/, int /*lag_slave_idx*/)
+{
+    return params[0] * (R - params[1]);
+}
+
+// Force strategy which computes the spring forces with several force
+// generators and records the largest difference from the reference generator
+// relative to the largest force.
+class ComparisonForce : public IBLagrangianForceStrategy
+{
+public:
+    ComparisonForce(Pointer<IBStandardForceGen> reference_force, std::vector<Pointer<IBStandardForceGen> > test_forces)
+        : d_reference_force(reference_force), d_test_forces(std::move(test_forces))
+    {
+        d_max_rel_diff.resize(d_test_forces.size(), 0.0);
+    }
+
+    std::vector<Pointer<IBStandardForceGen> > getForceGenerators() const
+    {
+        std::vector<Pointer<IBStandardForceGen> > force_gens = { d_reference_force };
+        force_gens.insert(force_gens.end(), d_test_forces.begin(), d_test_forces.end());
+        return force_gens;
+    }
+
+    void initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                             const int level_number,
+                             const double init_data_time,
+                             const bool initial_time,
+                             LDataManager* const l_data_manager) override
+    {
+        d_reference_force->initializeLevelData(hierarchy, level_number, init_data_time, initial_time, l_data_manager);
+        for (const auto& test_force : d_test_forces)
+        {
+            test_force->initializeLevelData(hierarchy, level_number, init_data_time, initial_time, l_data_manager);
+        }
+    }
+
+    void computeLagrangianForce(Pointer<LData> F_data,
+                                Pointer<LData> X_data,
+                                Pointer<LData> U_data,
+                                const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                const int level_number,
+                                const double data_time,
+                                LDataManager* const l_data_manager) override
+    {
+        Pointer<LData> F_ref_data = l_data_manager->createLData("F_ref", level_number, NDIM);
+        VecSet(F_ref_data->getVec(), 0.0);
+        d_reference_force->computeLagrangianForce(
+            F_ref_data, X_data, U_data, hierarchy, level_number, data_time, l_data_manager);
+        double F_max = 0.0;
+        VecNorm(F_ref_data->getVec(), NORM_INFINITY, &F_max);
+        d_max_F = std::max(d_max_F, F_max);
+
+        Pointer<LData> F_test_data = l_data_manager->createLData("F_test", level_number, NDIM);
+        for (unsigned int k = 0; k < d_test_forces.size(); ++k)
+        {
+            VecSet(F_test_data->getVec(), 0.0);
+            d_test_forces[k]->computeLagrangianForce(
+                F_test_data, X_data, U_data, hierarchy, level_number, data_time, l_data_manager);
+            double diff_max = 0.0;
+            VecAXPY(F_test_data->getVec(), -1.0, F_ref_data->getVec());
+            VecNorm(F_test_data->getVec(), NORM_INFINITY, &diff_max);
+            d_max_rel_diff[k] = std::max(d_max_rel_diff[k], F_max > 0.0 ? diff_max / F_max : diff_max);
+        }
+        VecAXPY(F_data->getVec(), 1.0, F_ref_data->getVec());
+    }
+
+    Pointer<IBStandardForceGen> d_reference_force;
+    std::vector<Pointer<IBStandardForceGen> > d_test_forces;
+    double d_max_F = 0.0;
+    std::vector<double> d_max_rel_diff;
+};
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        num_nodes = input_db->getInteger("NUM_NODES");
+        stiffness = input_db->getDouble("STIFFNESS");
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        ib_initializer->setStructureNamesOnLevel(0, { "ring" });
+        ib_initializer->registerInitStructureFunction(generate_structure);
+        ib_initializer->registerInitSpringDataFunction(generate_springs);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+
+        // The reference evaluates every spring through a function pointer. The
+        // first test generator mixes the inlined default law with the
+        // registered law, and the second one uses the default law for every
+        // spring.
+        Pointer<IBStandardForceGen> reference_force = new IBStandardForceGen();
+        reference_force->registerSpringForceFunction(0, &linear_spring_force, &default_spring_force_deriv);
+        reference_force->registerSpringForceFunction(1, &linear_spring_force, &default_spring_force_deriv);
+        Pointer<IBStandardForceGen> mixed_force = new IBStandardForceGen();
+        mixed_force->registerSpringForceFunction(1, &linear_spring_force, &default_spring_force_deriv);
+        Pointer<IBStandardForceGen> default_force = new IBStandardForceGen();
+        default_force->registerSpringForceFunction(1, &default_spring_force, &default_spring_force_deriv);
+        Pointer<ComparisonForce> comparison_force =
+            new ComparisonForce(reference_force, { mixed_force, default_force });
+        ib_method_ops->registerIBLagrangianForceFunction(comparison_force);
+
+        // Create Eulerian initial condition specification objects.
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        // Main time step loop.
+        double loop_time = time_integrator->getIntegratorTime();
+        const double loop_time_end = time_integrator->getEndTime();
+        while (!IBTK::rel_equal_eps(loop_time, loop_time_end) && time_integrator->stepsRemaining())
+        {
+            const double dt = time_integrator->getMaximumTimeStepSize();
+            time_integrator->advanceHierarchy(dt);
+            loop_time += dt;
+        }
+
+        // Double the stiffnesses in place and refresh the copies kept by the
+        // force generators. Since only the stiffnesses change, every generator
+        // must then compute exactly twice the original reference force.
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        int num_springs = 0;
+        double max_rescaled_rel_diff = 0.0;
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            if (!l_data_manager->levelContainsLagrangianData(ln)) continue;
+            Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+            Pointer<LData> U_data = l_data_manager->getLData(LDataManager::VEL_DATA_NAME, ln);
+            const double time = time_integrator->getIntegratorTime();
+            Pointer<LData> F_ref_data = l_data_manager->createLData("F_ref", ln, NDIM);
+            VecSet(F_ref_data->getVec(), 0.0);
+            comparison_force->d_reference_force->computeLagrangianForce(
+                F_ref_data, X_data, U_data, patch_hierarchy, ln, time, l_data_manager);
+            double F_max = 0.0;
+            VecNorm(F_ref_data->getVec(), NORM_INFINITY, &F_max);
+
+            for (LNode* const node : l_data_manager->getLMesh(ln)->getLocalNodes())
+            {
+                IBSpringForceSpec* const force_spec = node->getNodeDataItem<IBSpringForceSpec>();
+                if (!force_spec) continue;
+                num_springs += force_spec->getNumberOfSprings();
+                for (std::vector<double>& params : force_spec->getParameters()) params[0] *= 2.0;
+            }
+
+            Pointer<LData> F_test_data = l_data_manager->createLData("F_test", ln, NDIM);
+            for (const Pointer<IBStandardForceGen>& force_gen : comparison_force->getForceGenerators())
+            {
+                force_gen->resetSpringParameters(ln, l_data_manager);
+                VecSet(F_test_data->getVec(), 0.0);
+                force_gen->computeLagrangianForce(
+                    F_test_data, X_data, U_data, patch_hierarchy, ln, time, l_data_manager);
+                double diff_max = 0.0;
+                VecAXPY(F_test_data->getVec(), -2.0, F_ref_data->getVec());
+                VecNorm(F_test_data->getVec(), NORM_INFINITY, &diff_max);
+                max_rescaled_rel_diff = std::max(max_rescaled_rel_diff, F_max > 0.0 ? diff_max / F_max : diff_max);
+            }
+        }
+        num_springs = IBTK_MPI::sumReduction(num_springs);
+
+        // The springs are stored in a different order by each generator, so
+        // the forces are summed in different orders and only agree to
+        // roundoff.
+        if (IBTK_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "number of springs: " << num_springs << '\n';
+            out << "max relative difference, default and registered spring laws: "
+                << comparison_force->d_max_rel_diff[0] << '\n';
+            out << "max relative difference, default spring law: " << comparison_force->d_max_rel_diff[1] << '\n';
+            out << "max relative difference after doubling the stiffnesses: " << max_rescaled_rel_diff << '\n';
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
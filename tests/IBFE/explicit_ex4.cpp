@@ -100,6 +100,16 @@ PK1_dev_stress_function(TensorValue<double>& PP,
     return;
 } // PK1_dev_stress_function
 
+void
+PK1_dev_batched_stress_function(double* PP, const IBFEMethod::PK1StressBatch& batch, double /*time*/, void* /*ctx*/)
+{
+    for (unsigned int k = 0; k < batch.n_points * NDIM * NDIM; ++k)
+    {
+        PP[k] = 2.0 * c1_s * batch.FF[k];
+    }
+    return;
+} // PK1_dev_batched_stress_function
+
 void
 PK1_dev_inactive_stress_function(TensorValue<double>& PP,
                                  const TensorValue<double>& FF,
@@ -380,7 +390,16 @@ main(int argc, char** argv)
             Utility::string_to_enum<libMesh::Order>(input_db->getStringWithDefault("PK1_DEV_QUAD_ORDER", "THIRD"));
         PK1_dil_stress_data.quad_order =
             Utility::string_to_enum<libMesh::Order>(input_db->getStringWithDefault("PK1_DIL_QUAD_ORDER", "FIRST"));
-        ib_method_ops->registerPK1StressFunction(PK1_dev_stress_data);
+        if (input_db->getBoolWithDefault("use_batched_pk1", false))
+        {
+            IBFEMethod::BatchedPK1StressFcnData PK1_dev_batched_stress_data(PK1_dev_batched_stress_function);
+            PK1_dev_batched_stress_data.quad_order = PK1_dev_stress_data.quad_order;
+            ib_method_ops->registerBatchedPK1StressFunction(PK1_dev_batched_stress_data);
+        }
+        else
+        {
+            ib_method_ops->registerPK1StressFunction(PK1_dev_stress_data);
+        }
         ib_method_ops->registerPK1StressFunction(PK1_dil_stress_data);
 
         IBFEMethod::PK1StressFcnData PK1_dev_inactive_stress_data(PK1_dev_inactive_stress_function);
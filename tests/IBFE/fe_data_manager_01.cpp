@@ -0,0 +1,222 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/FEDataManager.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/StableCentroidPartitioner.h>
+
+#include <libmesh/equation_systems.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/numeric_vector.h>
+#include <libmesh/petsc_vector.h>
+
+#include <petscvec.h>
+
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <SAMRAI_config.h>
+#include <StandardTagAndInitialize.h>
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ibamr/app_namespaces.h>
+
+// Verify that updating the mappings from elements to patches after the
+// structure moves (FEDataManager::updateElementMappings()) gives the same
+// element and node lists and the same IB ghost DoFs as recomputing them from
+// scratch (FEDataManager::reinitElementMappings()).
+
+namespace
+{
+// Get the ids of the elements and nodes associated with each local patch.
+template <class T>
+std::vector<std::vector<dof_id_type> >
+get_ids(const std::vector<std::vector<T*> >& patch_map)
+{
+    std::vector<std::vector<dof_id_type> > ids(patch_map.size());
+    for (std::size_t patch_num = 0; patch_num < patch_map.size(); ++patch_num)
+    {
+        for (const T* const obj : patch_map[patch_num]) ids[patch_num].push_back(obj->id());
+    }
+    return ids;
+}
+
+// Get the global indices of the locally stored entries of the IB ghosted
+// vector of the specified system.
+std::vector<PetscInt>
+get_ib_ghost_indices(FEDataManager* const fe_data_manager, const std::string& system_name)
+{
+    std::unique_ptr<PetscVector<double> > ib_vector = fe_data_manager->buildIBGhostedVector(system_name);
+    ISLocalToGlobalMapping mapping;
+    int ierr = VecGetLocalToGlobalMapping(ib_vector->vec(), &mapping);
+    TBOX_ASSERT(ierr == 0);
+    PetscInt n;
+    ierr = ISLocalToGlobalMappingGetSize(mapping, &n);
+    TBOX_ASSERT(ierr == 0);
+    const PetscInt* indices;
+    ierr = ISLocalToGlobalMappingGetIndices(mapping, &indices);
+    TBOX_ASSERT(ierr == 0);
+    std::vector<PetscInt> ghost_indices(indices, indices + n);
+    ierr = ISLocalToGlobalMappingRestoreIndices(mapping, &indices);
+    TBOX_ASSERT(ierr == 0);
+    return ghost_indices;
+}
+
+// Count the patches whose lists differ.
+int
+count_different_patches(const std::vector<std::vector<dof_id_type> >& a,
+                        const std::vector<std::vector<dof_id_type> >& b)
+{
+    if (a.size() != b.size()) return static_cast<int>(std::max(a.size(), b.size()));
+    int num_different = 0;
+    for (std::size_t patch_num = 0; patch_num < a.size(); ++patch_num)
+    {
+        if (a[patch_num] != b[patch_num]) ++num_different;
+    }
+    return num_different;
+}
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    const LibMeshInit& init = ibtk_init.getLibMeshInit();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create a square FE mesh that covers several patches.
+        Mesh mesh(init.comm(), NDIM);
+        const double dx = input_db->getDouble("DX");
+        const double R = 0.2;
+        const int n_elems_per_side = static_cast<int>(2.0 * R / (input_db->getDouble("MFAC") * dx));
+        MeshTools::Generation::build_square(mesh,
+                                            n_elems_per_side,
+                                            n_elems_per_side,
+                                            -R,
+                                            R,
+                                            -R,
+                                            R,
+                                            Utility::string_to_enum<ElemType>(input_db->getString("ELEM_TYPE")));
+        mesh.prepare_for_use();
+        IBTK::StableCentroidPartitioner partitioner;
+        partitioner.partition(mesh);
+        for (auto node = mesh.nodes_begin(); node != mesh.nodes_end(); ++node)
+        {
+            (**node)(0) += 0.4;
+            (**node)(1) += 0.4;
+        }
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBFEMethod> ib_method_ops =
+            new IBFEMethod("IBFEMethod",
+                           app_initializer->getComponentDatabase("IBFEMethod"),
+                           &mesh,
+                           app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Initialize hierarchy configuration and data on all patches.
+        ib_method_ops->initializeFEEquationSystems();
+        ib_method_ops->initializeFEData();
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        FEDataManager* const fe_data_manager = ib_method_ops->getFEDataManager();
+        const std::string& X_system_name = fe_data_manager->getCurrentCoordinatesSystemName();
+        System& X_system = fe_data_manager->getEquationSystems()->get_system(X_system_name);
+        const unsigned int X_sys_num = X_system.number();
+
+        std::ofstream out;
+        if (IBTK_MPI::getRank() == 0) out.open("output");
+
+        // Move the structure by a fraction of a cell width in each step so that
+        // elements cross cell and patch boundaries, and compare the updated
+        // mappings with recomputed ones.
+        const int num_steps = input_db->getInteger("NUM_STEPS");
+        const double shift[NDIM] = { input_db->getDouble("SHIFT_X") * dx, input_db->getDouble("SHIFT_Y") * dx };
+        for (int step = 0; step < num_steps; ++step)
+        {
+            for (auto node = mesh.local_nodes_begin(); node != mesh.local_nodes_end(); ++node)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X_system.solution->add((*node)->dof_number(X_sys_num, d, 0), shift[d]);
+                }
+            }
+            X_system.solution->close();
+
+            fe_data_manager->updateElementMappings();
+            const std::vector<std::vector<dof_id_type> > updated_elem_ids =
+                get_ids(fe_data_manager->getActivePatchElementMap());
+            const std::vector<std::vector<dof_id_type> > updated_node_ids =
+                get_ids(fe_data_manager->getActivePatchNodeMap());
+            const std::vector<PetscInt> updated_ghost_indices = get_ib_ghost_indices(fe_data_manager, X_system_name);
+
+            fe_data_manager->reinitElementMappings();
+            const int num_different_elem_lists = IBTK_MPI::sumReduction(
+                count_different_patches(updated_elem_ids, get_ids(fe_data_manager->getActivePatchElementMap())));
+            const int num_different_node_lists = IBTK_MPI::sumReduction(
+                count_different_patches(updated_node_ids, get_ids(fe_data_manager->getActivePatchNodeMap())));
+            const int num_different_ghost_indices = IBTK_MPI::sumReduction(
+                static_cast<int>(updated_ghost_indices != get_ib_ghost_indices(fe_data_manager, X_system_name)));
+            if (IBTK_MPI::getRank() == 0)
+            {
+                out << "step " << step << '\n';
+                out << "  number of patches with different element lists: " << num_different_elem_lists << '\n';
+                out << "  number of patches with different node lists: " << num_different_node_lists << '\n';
+                out << "  number of processors with different IB ghost DoFs: " << num_different_ghost_indices
+                    << '\n';
+            }
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
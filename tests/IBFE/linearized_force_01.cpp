@@ -0,0 +1,237 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/numeric_vector.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/StableCentroidPartitioner.h>
+#include <ibtk/libmesh_utilities.h>
+
+#include <cmath>
+#include <fstream>
+#include <memory>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify that IBFEMethod::computeLinearizedLagrangianForce() agrees with a
+// centered finite difference of IBFEMethod::computeLagrangianForce() for a
+// nonlinear material in a nonuniformly deformed configuration. The stress
+// linearization is either provided by a jacobian_fcn or, if USE_JACOBIAN_FCN
+// is FALSE, computed by finite differences at each quadrature point.
+
+namespace
+{
+// Parameters of the compressible neo-Hookean material model.
+double mu_s;
+double lambda_s;
+
+void
+coordinate_mapping_function(libMesh::Point& X, const libMesh::Point& s, void* /*ctx*/)
+{
+    X(0) = 0.5 + 1.1 * s(0) + 0.2 * s(1);
+    X(1) = 0.5 + 0.9 * s(1) + 0.5 * s(0) * s(0);
+    return;
+} // coordinate_mapping_function
+
+void
+PK1_stress_function(TensorValue<double>& PP,
+                    const TensorValue<double>& FF,
+                    const libMesh::Point& /*x*/,
+                    const libMesh::Point& /*X*/,
+                    Elem* const /*elem*/,
+                    const std::vector<const std::vector<double>*>& /*var_data*/,
+                    const std::vector<const std::vector<VectorValue<double> >*>& /*grad_var_data*/,
+                    double /*time*/,
+                    void* /*ctx*/)
+{
+    const TensorValue<double> FF_inv_trans = tensor_inverse_transpose(FF, NDIM);
+    PP = mu_s * (FF - FF_inv_trans) + lambda_s * std::log(FF.det()) * FF_inv_trans;
+    return;
+} // PK1_stress_function
+
+void
+PK1_stress_jacobian_function(TensorValue<double>& dPP,
+                             const TensorValue<double>& FF,
+                             const TensorValue<double>& dFF,
+                             const libMesh::Point& /*x*/,
+                             const libMesh::Point& /*X*/,
+                             Elem* const /*elem*/,
+                             const std::vector<const std::vector<double>*>& /*var_data*/,
+                             const std::vector<const std::vector<VectorValue<double> >*>& /*grad_var_data*/,
+                             double /*time*/,
+                             void* /*ctx*/)
+{
+    const TensorValue<double> FF_inv_trans = tensor_inverse_transpose(FF, NDIM);
+    const double tr_FF_inv_dFF = FF_inv_trans.contract(dFF);
+    dPP = mu_s * dFF + (mu_s - lambda_s * std::log(FF.det())) * (FF_inv_trans * dFF.transpose() * FF_inv_trans) +
+          lambda_s * tr_FF_inv_dFF * FF_inv_trans;
+    return;
+} // PK1_stress_jacobian_function
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    const LibMeshInit& init = ibtk_init.getLibMeshInit();
+
+    // The L2 projections should be accurate enough that they do not pollute
+    // the finite difference approximation.
+    PetscOptionsSetValue(nullptr, "-ksp_rtol", "1e-14");
+    PetscOptionsSetValue(nullptr, "-ksp_atol", "1e-14");
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create a simple FE mesh.
+        ReplicatedMesh mesh(init.comm(), NDIM);
+        const int num_elems = input_db->getInteger("NUM_ELEMS");
+        MeshTools::Generation::build_square(mesh,
+                                            num_elems,
+                                            num_elems,
+                                            -0.1,
+                                            0.1,
+                                            -0.1,
+                                            0.1,
+                                            Utility::string_to_enum<ElemType>(input_db->getString("ELEM_TYPE")));
+        IBTK::StableCentroidPartitioner partitioner;
+        partitioner.partition(mesh);
+
+        mu_s = input_db->getDouble("MU_S");
+        lambda_s = input_db->getDouble("LAMBDA_S");
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBFEMethod> ib_method_ops =
+            new IBFEMethod("IBFEMethod",
+                           app_initializer->getComponentDatabase("IBFEMethod"),
+                           &mesh,
+                           app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IBFE solver.
+        ib_method_ops->registerInitialCoordinateMappingFunction(coordinate_mapping_function);
+        IBFEMethod::PK1StressFcnData PK1_stress_data(PK1_stress_function);
+        if (input_db->getBool("USE_JACOBIAN_FCN")) PK1_stress_data.jacobian_fcn = PK1_stress_jacobian_function;
+        ib_method_ops->registerPK1StressFunction(PK1_stress_data);
+        ib_method_ops->initializeFEEquationSystems();
+        ib_method_ops->initializeFEData();
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        const double current_time = time_integrator->getIntegratorTime();
+        const double dt = input_db->getDouble("DT");
+        time_integrator->preprocessIntegrateHierarchy(current_time, current_time + dt, 1);
+
+        // Set the structure velocity, which determines the linearization
+        // direction dX = dt * U.
+        EquationSystems* equation_systems = ib_method_ops->getFEDataManager()->getEquationSystems();
+        System& X_system = equation_systems->get_system(ib_method_ops->getCurrentCoordinatesSystemName());
+        System& U_system = equation_systems->get_system(ib_method_ops->getVelocitySystemName());
+        System& F_system = equation_systems->get_system(ib_method_ops->getForceSystemName());
+        NumericVector<double>& X_vec = X_system.get_vector("current");
+        NumericVector<double>& U_vec = U_system.get_vector("current");
+        for (auto node_it = mesh.local_nodes_begin(); node_it != mesh.local_nodes_end(); ++node_it)
+        {
+            const Node& node = **node_it;
+            const double s0 = node(0), s1 = node(1);
+            U_vec.set(node.dof_number(U_system.number(), 0, 0), std::sin(10.0 * s1) + 3.0 * s0);
+            U_vec.set(node.dof_number(U_system.number(), 1, 0), std::cos(10.0 * s0) * s1 - s0 * s0);
+        }
+        U_vec.close();
+
+        ib_method_ops->computeLinearizedLagrangianForce(dt, current_time);
+        std::unique_ptr<NumericVector<double> > dF_vec = F_system.solution->clone();
+
+        // Compute a centered finite difference of the force in the same
+        // direction.
+        const double h = input_db->getDouble("FD_STEP");
+        std::unique_ptr<NumericVector<double> > X0_vec = X_vec.clone();
+        std::unique_ptr<NumericVector<double> > dF_fd_vec = F_system.solution->zero_clone();
+        for (const double sign : { 1.0, -1.0 })
+        {
+            X_vec = *X0_vec;
+            X_vec.add(sign * h * dt, U_vec);
+            X_vec.close();
+            ib_method_ops->computeLagrangianForce(current_time);
+            dF_fd_vec->add(sign / (2.0 * h), *F_system.solution);
+        }
+        dF_fd_vec->close();
+        X_vec = *X0_vec;
+        X_vec.close();
+
+        const double dF_norm = dF_vec->l2_norm();
+        const double dF_fd_norm = dF_fd_vec->l2_norm();
+        dF_fd_vec->add(-1.0, *dF_vec);
+        dF_fd_vec->close();
+        const double rel_diff = dF_norm > 0.0 ? dF_fd_vec->l2_norm() / dF_norm : 0.0;
+        if (IBTK_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "number of force DoFs: " << F_system.n_dofs() << '\n';
+            out << "linearized force l2 norm: " << dF_norm << '\n';
+            out << "finite difference force l2 norm: " << dF_fd_norm << '\n';
+            out << "relative difference: " << rel_diff << '\n';
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,184 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/dof_object.h>
+#include <libmesh/equation_systems.h>
+#include <libmesh/explicit_system.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/numeric_vector.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/libmesh_utilities.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify that the finite element data written with
+// IBTK::collect_equation_systems_data() on N processors is read back correctly
+// by IBTK::read_equation_systems_data() on M processors for all M <= N. This
+// is what the asynchronous restart files of FEMechanicsBase use. SAMRAI cannot
+// restart with a different number of processors, so this round trip is tested
+// here without a SAMRAI restart.
+
+namespace
+{
+// Value stored at a given node or element, variable, and vector.
+double
+exact_value(const DofObject& dof_object, const unsigned int var, const bool old_vector)
+{
+    const double value = 1.0 + dof_object.id() + 0.25 * var;
+    return old_vector ? -2.0 * value : value;
+}
+
+// Set up a mesh with nodal and elemental systems, each of which has an extra
+// vector.
+void
+setup_systems(EquationSystems& equation_systems)
+{
+    auto& nodal_system = equation_systems.add_system<ExplicitSystem>("nodal");
+    nodal_system.add_variable("u", FIRST, LAGRANGE);
+    nodal_system.add_variable("v", FIRST, LAGRANGE);
+    nodal_system.add_vector("old", /*projections*/ true, GHOSTED);
+    auto& elemental_system = equation_systems.add_system<ExplicitSystem>("elemental");
+    elemental_system.add_variable("p", CONSTANT, MONOMIAL);
+    elemental_system.add_vector("old", /*projections*/ true, GHOSTED);
+    equation_systems.init();
+}
+
+// Loop over the local degrees of freedom of all systems.
+template <typename F>
+void
+for_each_local_dof(EquationSystems& equation_systems, F f)
+{
+    const MeshBase& mesh = equation_systems.get_mesh();
+    for (unsigned int sys_num = 0; sys_num < equation_systems.n_systems(); ++sys_num)
+    {
+        System& system = equation_systems.get_system(sys_num);
+        const auto do_dof_object = [&](const DofObject& dof_object)
+        {
+            for (unsigned int var = 0; var < dof_object.n_vars(sys_num); ++var)
+            {
+                if (dof_object.n_comp(sys_num, var) == 0) continue;
+                f(system, dof_object.dof_number(sys_num, var, 0), dof_object, var);
+            }
+        };
+        for (auto it = mesh.local_nodes_begin(); it != mesh.local_nodes_end(); ++it) do_dof_object(**it);
+        for (auto it = mesh.local_elements_begin(); it != mesh.local_elements_end(); ++it) do_dof_object(**it);
+    }
+}
+
+void
+build_mesh(ReplicatedMesh& mesh)
+{
+    MeshTools::Generation::build_square(mesh, 6, 5, 0.0, 1.0, 0.0, 1.0, QUAD4);
+}
+
+// Read the data on the processors of @p mpi_comm and return the maximum error
+// on this processor.
+double
+read_and_check(MPI_Comm mpi_comm, const std::string& file_name)
+{
+    const Parallel::Communicator comm(mpi_comm);
+    ReplicatedMesh mesh(comm, NDIM);
+    build_mesh(mesh);
+    EquationSystems equation_systems(mesh);
+    setup_systems(equation_systems);
+    read_equation_systems_data(equation_systems, file_name);
+    double max_error = 0.0;
+    for_each_local_dof(equation_systems,
+                       [&](System& system, const dof_id_type dof, const DofObject& dof_object, unsigned int var)
+                       {
+                           max_error = std::max(
+                               max_error, std::abs((*system.solution)(dof) - exact_value(dof_object, var, false)));
+                           max_error = std::max(
+                               max_error, std::abs(system.get_vector("old")(dof) - exact_value(dof_object, var, true)));
+                       });
+    return max_error;
+}
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    const LibMeshInit& init = ibtk_init.getLibMeshInit();
+
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const int ranks_per_writer = input_db->getInteger("ranks_per_writer");
+        const std::string file_name = "equation_systems_data_01.xda";
+        const int n_ranks = IBTK_MPI::getNodes();
+
+        // Write the data with all processors.
+        {
+            ReplicatedMesh mesh(init.comm(), NDIM);
+            build_mesh(mesh);
+            EquationSystems equation_systems(mesh);
+            setup_systems(equation_systems);
+            for_each_local_dof(equation_systems,
+                               [](System& system, const dof_id_type dof, const DofObject& dof_object, unsigned int var)
+                               {
+                                   system.solution->set(dof, exact_value(dof_object, var, false));
+                                   system.get_vector("old").set(dof, exact_value(dof_object, var, true));
+                               });
+            for (unsigned int sys_num = 0; sys_num < equation_systems.n_systems(); ++sys_num)
+            {
+                equation_systems.get_system(sys_num).solution->close();
+                equation_systems.get_system(sys_num).get_vector("old").close();
+            }
+
+            const auto files = collect_equation_systems_data(equation_systems, file_name, ranks_per_writer);
+            for (const auto& file : files)
+            {
+                std::ofstream out(file.first, std::ios::binary);
+                out.write(file.second.data(), file.second.size());
+            }
+            const int n_files = IBTK_MPI::sumReduction(static_cast<int>(files.size()));
+            plog << "writing with " << n_ranks << " processors and " << ranks_per_writer
+                 << " processors per file: " << n_files << " files" << std::endl;
+        }
+        IBTK_MPI::barrier();
+
+        // Read the data back with every smaller number of processors.
+        for (int n_readers = 1; n_readers <= n_ranks; ++n_readers)
+        {
+            const int rank = IBTK_MPI::getRank();
+            MPI_Comm reader_comm;
+            MPI_Comm_split(MPI_COMM_WORLD, rank < n_readers ? 0 : MPI_UNDEFINED, rank, &reader_comm);
+            double max_error = 0.0;
+            if (reader_comm != MPI_COMM_NULL)
+            {
+                max_error = read_and_check(reader_comm, file_name);
+                MPI_Comm_free(&reader_comm);
+            }
+            max_error = IBTK_MPI::maxReduction(max_error);
+            plog << "reading with " << n_readers << " processors: max error = " << max_error << std::endl;
+        }
+    }
+} // main
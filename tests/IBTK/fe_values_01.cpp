@@ -26,6 +26,7 @@
 
 // Headers for application-specific algorithm/data structure objects
 #include <ibtk/AppInitializer.h>
+#include <ibtk/FEMappingCache.h>
 #include <ibtk/FEValues.h>
 #include <ibtk/IBTKInit.h>
 #include <ibtk/libmesh_utilities.h>
@@ -107,6 +108,18 @@ test(LibMeshInit& init, const MeshType mesh_type = MeshType::libmesh)
                                 IBTK::update_quadrature_points | IBTK::update_JxW | IBTK::update_phi |
                                     IBTK::update_dphi);
 
+    // IBTK values, computed with the reference geometry cache when possible:
+    std::unique_ptr<QBase> quad_3 = QBase::build(QGAUSS, dim, THIRD);
+    quad_3->init(elem_type);
+    IBTK::FEGeometryCache geometry_cache(dim, dim);
+    geometry_cache.reinit(mesh);
+    if (elem_type == TRI3 || elem_type == TET4) TBOX_ASSERT(geometry_cache.size() == mesh.n_active_local_elem());
+    IBTK::FEValues<dim> cached_fe(quad_3.get(),
+                                  fe_type,
+                                  IBTK::update_quadrature_points | IBTK::update_JxW | IBTK::update_phi |
+                                      IBTK::update_dphi);
+    cached_fe.setGeometryCache(&geometry_cache);
+
     for (auto elem_iter = mesh.active_local_elements_begin(); elem_iter != mesh.active_local_elements_end();
          ++elem_iter)
     {
@@ -150,6 +163,30 @@ test(LibMeshInit& init, const MeshType mesh_type = MeshType::libmesh)
                 TBOX_ASSERT(dphi[i][q].relative_fuzzy_equals(dphi_2[i][q], tol));
             }
         }
+
+        // cached values should match the computed ones up to roundoff:
+        cached_fe.reinit(*elem_iter);
+        const std::vector<double>& JxW_3 = cached_fe.getJxW();
+        for (unsigned int i = 0; i < JxW_2.size(); ++i)
+        {
+            const double tol = mesh_type == MeshType::readin ? 1e-13 : 1e-14;
+            TBOX_ASSERT(std::abs(JxW_2[i] - JxW_3[i]) < tol * std::max(1.0, std::abs(JxW_2[i])));
+        }
+        const std::vector<libMesh::Point>& q_3 = cached_fe.getQuadraturePoints();
+        for (unsigned int i = 0; i < q_2.size(); ++i)
+        {
+            TBOX_ASSERT(q_2[i].relative_fuzzy_equals(q_3[i], 1e-14));
+        }
+        TBOX_ASSERT(phi_2 == cached_fe.getShapeValues());
+        const std::vector<std::vector<libMesh::VectorValue<double> > >& dphi_3 = cached_fe.getShapeGradients();
+        for (unsigned int i = 0; i < dphi_2.size(); ++i)
+        {
+            for (unsigned int q = 0; q < dphi_2[i].size(); ++q)
+            {
+                const double tol = mesh_type == MeshType::readin ? 1e-11 : 1e-12;
+                TBOX_ASSERT(dphi_2[i][q].relative_fuzzy_equals(dphi_3[i][q], tol));
+            }
+        }
     }
 }
 
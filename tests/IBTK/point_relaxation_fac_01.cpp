@@ -0,0 +1,205 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCLaplaceOperator.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/muParserCartGridFunction.h>
+#include <ibtk/muParserRobinBcCoefs.h>
+
+#include <cmath>
+#include <iomanip>
+#include <memory>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Compare the residual histories of CCPoissonPointRelaxationFACOperator with
+// red-black Gauss-Seidel smoothing when it fills ghost cells once for several
+// sweeps and when it fills them before each sweep. The FAC preconditioner is
+// used in a defect correction iteration. On a single periodic level every
+// patch smooths its ghost cells and the histories agree exactly; with physical
+// boundaries or a refined level some patches use stale ghost cell values, and
+// the residual histories are printed.
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "cc_poisson.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", nullptr, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc");
+        Pointer<CellVariable<NDIM, double> > f_cc_var = new CellVariable<NDIM, double>("f_cc");
+        Pointer<CellVariable<NDIM, double> > e_cc_var = new CellVariable<NDIM, double>("e_cc");
+        Pointer<CellVariable<NDIM, double> > r_cc_var = new CellVariable<NDIM, double>("r_cc");
+
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, IntVector<NDIM>(1));
+        const int f_cc_idx = var_db->registerVariableAndContext(f_cc_var, ctx, IntVector<NDIM>(1));
+        const int e_cc_idx = var_db->registerVariableAndContext(e_cc_var, ctx, IntVector<NDIM>(1));
+        const int r_cc_idx = var_db->registerVariableAndContext(r_cc_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+
+        // Allocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_cc_idx, 0.0);
+            level->allocatePatchData(f_cc_idx, 0.0);
+            level->allocatePatchData(e_cc_idx, 0.0);
+            level->allocatePatchData(r_cc_idx, 0.0);
+        }
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+        SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+        SAMRAIVectorReal<NDIM, double> e_vec("e", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+        SAMRAIVectorReal<NDIM, double> r_vec("r", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+
+        u_vec.addComponent(u_cc_var, u_cc_idx, h_cc_idx);
+        f_vec.addComponent(f_cc_var, f_cc_idx, h_cc_idx);
+        e_vec.addComponent(e_cc_var, e_cc_idx, h_cc_idx);
+        r_vec.addComponent(r_cc_var, r_cc_idx, h_cc_idx);
+
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(f_cc_idx, f_cc_var, patch_hierarchy, 0.0);
+
+        // Setup the operator C*u + D*Laplacian(u) with C = 1 and D = -1.
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCConstant(1.0);
+        poisson_spec.setDConstant(-1.0);
+        std::unique_ptr<RobinBcCoefStrategy<NDIM> > bc_coef;
+        if (input_db->keyExists("UBcCoefs"))
+        {
+            bc_coef.reset(new muParserRobinBcCoefs(
+                "u_bc_coef", app_initializer->getComponentDatabase("UBcCoefs"), grid_geometry));
+        }
+        CCLaplaceOperator laplace_op("laplace_op");
+        laplace_op.setPoissonSpecifications(poisson_spec);
+        laplace_op.setPhysicalBcCoef(bc_coef.get());
+        laplace_op.initializeOperatorState(u_vec, f_vec);
+
+        // Run the defect correction iteration u <- u + P(f - L*u), in which P
+        // is one FAC cycle, with one and with several sweeps per ghost cell
+        // fill.
+        const std::string precond_type = input_db->getString("precond_type");
+        Pointer<Database> precond_db = input_db->getDatabase("precond_db");
+        const int num_cycles = input_db->getInteger("num_cycles");
+        const int sweeps_per_ghost_fill[2] = { 1, input_db->getInteger("num_sweeps_per_ghost_fill") };
+        std::vector<double> residual_history[2];
+        for (int k = 0; k < 2; ++k)
+        {
+            precond_db->putInteger("num_sweeps_per_ghost_fill", sweeps_per_ghost_fill[k]);
+            Pointer<PoissonSolver> poisson_precond =
+                CCPoissonSolverManager::getManager()->allocateSolver(precond_type, "poisson_precond", precond_db, "");
+            poisson_precond->setPoissonSpecifications(poisson_spec);
+            poisson_precond->setPhysicalBcCoef(bc_coef.get());
+            poisson_precond->initializeSolverState(u_vec, f_vec);
+
+            u_vec.setToScalar(0.0);
+            for (int cycle = 0; cycle <= num_cycles; ++cycle)
+            {
+                laplace_op.apply(u_vec, r_vec);
+                r_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&f_vec, false),
+                               Pointer<SAMRAIVectorReal<NDIM, double> >(&r_vec, false));
+                residual_history[k].push_back(r_vec.L2Norm());
+                if (cycle == num_cycles) break;
+                poisson_precond->solveSystem(e_vec, r_vec);
+                u_vec.add(Pointer<SAMRAIVectorReal<NDIM, double> >(&u_vec, false),
+                          Pointer<SAMRAIVectorReal<NDIM, double> >(&e_vec, false));
+            }
+            poisson_precond->deallocateSolverState();
+        }
+
+        // Print the relative differences between the residual histories,
+        // which vanish when every patch smooths its ghost cells, and, if
+        // requested, the residual histories themselves.
+        const bool print_residual_history = input_db->getBoolWithDefault("print_residual_history", false);
+        plog << std::setprecision(10) << "number of cycles: " << num_cycles << "\n";
+        for (int cycle = 0; cycle <= num_cycles; ++cycle)
+        {
+            plog << "cycle " << cycle << ": relative difference in the residual norm with num_sweeps_per_ghost_fill = "
+                 << sweeps_per_ghost_fill[1] << ": "
+                 << std::abs(residual_history[1][cycle] - residual_history[0][cycle]) / residual_history[0][cycle]
+                 << "\n";
+            if (print_residual_history)
+            {
+                for (int k = 0; k < 2; ++k)
+                {
+                    plog << "cycle " << cycle << ": residual norm with num_sweeps_per_ghost_fill = "
+                         << sweeps_per_ghost_fill[k] << ": " << residual_history[k][cycle] << "\n";
+                }
+            }
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
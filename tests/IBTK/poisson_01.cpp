@@ -22,6 +22,7 @@
 #include <BergerRigoutsos.h>
 #include <CartesianGridGeometry.h>
 #include <GriddingAlgorithm.h>
+#include <InputDatabase.h>
 #include <LoadBalancer.h>
 #include <StandardTagAndInitialize.h>
 
@@ -30,6 +31,8 @@
 #include <ibtk/CCLaplaceOperator.h>
 #include <ibtk/CCPoissonSolverManager.h>
 #include <ibtk/IBTKInit.h>
+#include <ibtk/PETScKrylovLinearSolver.h>
+#include <ibtk/ibtk_utilities.h>
 #include <ibtk/muParserCartGridFunction.h>
 
 // Set up application namespace declarations
@@ -161,6 +164,48 @@ main(int argc, char* argv[])
         u_vec.setToScalar(0.0);
         poisson_solver->solveSystem(u_vec, f_vec);
 
+        // Optionally solve a sequence of problems with slowly varying
+        // right-hand sides, which exercises the computation of initial guesses
+        // from previous solves, and print the number of iterations needed by
+        // each solve.
+        if (input_db->keyExists("f_sequence"))
+        {
+            const int n_solves = input_db->getInteger("n_solves");
+            const double rhs_time_step = input_db->getDouble("rhs_time_step");
+            muParserCartGridFunction f_seq_fcn(
+                "f_sequence", app_initializer->getComponentDatabase("f_sequence"), grid_geometry);
+            Pointer<SAMRAIVectorReal<NDIM, double> > u_seq_vec = u_vec.cloneVector("u_seq");
+            Pointer<SAMRAIVectorReal<NDIM, double> > f_seq_vec = f_vec.cloneVector("f_seq");
+            u_seq_vec->allocateVectorData();
+            f_seq_vec->allocateVectorData();
+            for (int k = 0; k < n_solves; ++k)
+            {
+                f_seq_fcn.setDataOnPatchHierarchy(f_seq_vec->getComponentDescriptorIndex(0),
+                                                  f_seq_vec->getComponentVariable(0),
+                                                  patch_hierarchy,
+                                                  k * rhs_time_step);
+                f_seq_vec->addScalar(f_seq_vec,
+                                     -f_seq_vec->dot(Pointer<SAMRAIVectorReal<NDIM, double> >(&r_vec, false)) /
+                                         r_vec.dot(Pointer<SAMRAIVectorReal<NDIM, double> >(&r_vec, false)));
+                u_seq_vec->setToScalar(0.0);
+                poisson_solver->solveSystem(*u_seq_vec, *f_seq_vec);
+                plog << "solve " << k << ": number of iterations = " << poisson_solver->getNumIterations() << "\n";
+            }
+            free_vector_components(*u_seq_vec);
+            free_vector_components(*f_seq_vec);
+
+            // Using such guesses must not change the initial guess setting of
+            // the KSP object.
+            Pointer<PETScKrylovLinearSolver> petsc_solver = poisson_solver;
+            if (petsc_solver)
+            {
+                PetscBool ksp_initial_guess_nonzero;
+                KSPGetInitialGuessNonzero(petsc_solver->getPETScKSP(), &ksp_initial_guess_nonzero);
+                plog << "KSP initial guess nonzero: " << (ksp_initial_guess_nonzero == PETSC_TRUE)
+                     << ", solver initial guess nonzero: " << petsc_solver->getInitialGuessNonzero() << "\n";
+            }
+        }
+
         // Compute error and print error norms.
         e_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&e_vec, false),
                        Pointer<SAMRAIVectorReal<NDIM, double> >(&u_vec, false));
@@ -203,5 +248,59 @@ main(int argc, char* argv[])
                 }
             }
         }
+
+        // Optionally compare other Krylov methods (e.g., pipelined ones) with
+        // GMRES by printing their iteration counts and the differences between
+        // their solutions. These solves all use a tight tolerance. The solution
+        // of this periodic problem is only determined up to a constant, so the
+        // solutions are compared after removing their means.
+        if (input_db->keyExists("compare_ksp_types"))
+        {
+            const Array<std::string> compare_ksp_types = input_db->getStringArray("compare_ksp_types");
+            const double compare_rel_residual_tol = input_db->getDouble("compare_rel_residual_tol");
+            Pointer<SAMRAIVectorReal<NDIM, double> > u_ref_vec = u_vec.cloneVector("u_ref");
+            Pointer<SAMRAIVectorReal<NDIM, double> > u_cmp_vec = u_vec.cloneVector("u_cmp");
+            u_ref_vec->allocateVectorData();
+            u_cmp_vec->allocateVectorData();
+            r_vec.setToScalar(1.0);
+            const auto solve = [&](const std::string& ksp_type, Pointer<SAMRAIVectorReal<NDIM, double> > x_vec)
+            {
+                Pointer<Database> compare_solver_db = new InputDatabase("compare_solver_db");
+                compare_solver_db->putString("ksp_type", ksp_type);
+                compare_solver_db->putDouble("rel_residual_tol", compare_rel_residual_tol);
+                Pointer<PoissonSolver> compare_solver =
+                    CCPoissonSolverManager::getManager()->allocateSolver(solver_type,
+                                                                         "compare_solver_" + ksp_type,
+                                                                         compare_solver_db,
+                                                                         "",
+                                                                         precond_type,
+                                                                         "compare_precond_" + ksp_type,
+                                                                         precond_db,
+                                                                         "");
+                compare_solver->setPoissonSpecifications(poisson_spec);
+                compare_solver->setPhysicalBcCoef(bc_coef);
+                compare_solver->initializeSolverState(*x_vec, f_vec);
+                x_vec->setToScalar(0.0);
+                compare_solver->solveSystem(*x_vec, f_vec);
+                const int num_iterations = compare_solver->getNumIterations();
+                compare_solver->deallocateSolverState();
+                x_vec->addScalar(x_vec,
+                                 -x_vec->dot(Pointer<SAMRAIVectorReal<NDIM, double> >(&r_vec, false)) /
+                                     r_vec.dot(Pointer<SAMRAIVectorReal<NDIM, double> >(&r_vec, false)));
+                return num_iterations;
+            };
+            const int num_ref_iterations = solve("gmres", u_ref_vec);
+            plog << "ksp_type = gmres: number of iterations = " << num_ref_iterations << "\n";
+            for (int k = 0; k < compare_ksp_types.getSize(); ++k)
+            {
+                const int num_iterations = solve(compare_ksp_types[k], u_cmp_vec);
+                u_cmp_vec->subtract(u_cmp_vec, u_ref_vec);
+                plog << "ksp_type = " << compare_ksp_types[k] << ": number of iterations = " << num_iterations
+                     << ", relative max difference from gmres = " << u_cmp_vec->maxNorm() / u_ref_vec->maxNorm()
+                     << "\n";
+            }
+            free_vector_components(*u_ref_vec);
+            free_vector_components(*u_cmp_vec);
+        }
     } // cleanup dynamically allocated objects prior to shutdown
 } // main
@@ -0,0 +1,309 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2024 - 2024 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <ArrayData.h>
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <EdgeData.h>
+#include <EdgeVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <NodeData.h>
+#include <NodeVariable.h>
+#include <SideData.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+#include <tbox/MemoryDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/LEInteractor.h>
+
+// Set up application namespace declarations
+#include <algorithm>
+#include <random>
+
+#include <ibtk/app_namespaces.h>
+
+// This test compares the templated C++ implementations of the delta function
+// kernels (LEInteractorKernels.h) with the Fortran implementations. Both
+// interpolate the same random Eulerian field at random points and spread the
+// same random Lagrangian values, and the maximum differences are printed. The
+// weight cache is disabled throughout since it takes precedence over the
+// templated kernels.
+//
+// Every kernel with a templated implementation is tested on cell-centered data
+// of depth 1, NDIM, and NDIM + 1 (which use the specialized depth 1 and depth
+// NDIM and the generic implementations), node-centered data of depth 1 and
+// NDIM, side-centered data, and, in 3D, edge-centered data.
+
+namespace
+{
+void
+use_templated_kernels(const bool use_templated_kernels)
+{
+    Pointer<Database> db = new MemoryDatabase("LEInteractor");
+    db->putBool("use_weight_cache", false);
+    db->putBool("use_templated_kernels", use_templated_kernels);
+    LEInteractor::setFromDatabase(db);
+}
+
+std::vector<ArrayData<NDIM, double>*>
+get_array_data(Pointer<CellData<NDIM, double> > data)
+{
+    return { &data->getArrayData() };
+}
+
+std::vector<ArrayData<NDIM, double>*>
+get_array_data(Pointer<NodeData<NDIM, double> > data)
+{
+    return { &data->getArrayData() };
+}
+
+std::vector<ArrayData<NDIM, double>*>
+get_array_data(Pointer<SideData<NDIM, double> > data)
+{
+    std::vector<ArrayData<NDIM, double>*> arrays;
+    for (unsigned int axis = 0; axis < NDIM; ++axis) arrays.push_back(&data->getArrayData(axis));
+    return arrays;
+}
+
+std::vector<ArrayData<NDIM, double>*>
+get_array_data(Pointer<EdgeData<NDIM, double> > data)
+{
+    std::vector<ArrayData<NDIM, double>*> arrays;
+    for (unsigned int axis = 0; axis < NDIM; ++axis) arrays.push_back(&data->getArrayData(axis));
+    return arrays;
+}
+
+void
+fill_random(const std::vector<ArrayData<NDIM, double>*>& arrays, std::mt19937& rng)
+{
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    for (ArrayData<NDIM, double>* const array : arrays)
+    {
+        for (int d = 0; d < array->getDepth(); ++d)
+        {
+            double* const values = array->getPointer(d);
+            for (int i = 0; i < array->getBox().size(); ++i) values[i] = distribution(rng);
+        }
+    }
+}
+
+double
+max_difference(const std::vector<ArrayData<NDIM, double>*>& arrays_1,
+               const std::vector<ArrayData<NDIM, double>*>& arrays_2)
+{
+    double max_diff = 0.0;
+    for (std::size_t k = 0; k < arrays_1.size(); ++k)
+    {
+        TBOX_ASSERT(arrays_1[k]->getBox() == arrays_2[k]->getBox());
+        for (int d = 0; d < arrays_1[k]->getDepth(); ++d)
+        {
+            const double* const values_1 = arrays_1[k]->getPointer(d);
+            const double* const values_2 = arrays_2[k]->getPointer(d);
+            for (int i = 0; i < arrays_1[k]->getBox().size(); ++i)
+            {
+                max_diff = std::max(max_diff, std::abs(values_1[i] - values_2[i]));
+            }
+        }
+    }
+    return max_diff;
+}
+
+template <class DataType>
+void
+compare_kernels(std::ostream& out,
+                const std::string& kernel_fcn,
+                const std::string& data_name,
+                const int fortran_idx,
+                const int templated_idx,
+                const int Q_depth,
+                const std::vector<double>& X_data,
+                Pointer<Patch<NDIM> > patch,
+                std::mt19937& rng)
+{
+    Pointer<DataType> fortran_data = patch->getPatchData(fortran_idx);
+    Pointer<DataType> templated_data = patch->getPatchData(templated_idx);
+    const Box<NDIM>& box = patch->getBox();
+    const std::size_t n_points = X_data.size() / NDIM;
+
+    // Interpolate the same field with both implementations.
+    fill_random(get_array_data(fortran_data), rng);
+    std::vector<double> Q_fortran(Q_depth * n_points), Q_templated(Q_depth * n_points);
+    use_templated_kernels(false);
+    LEInteractor::interpolate(Q_fortran, Q_depth, X_data, NDIM, fortran_data, patch, box, kernel_fcn);
+    use_templated_kernels(true);
+    LEInteractor::interpolate(Q_templated, Q_depth, X_data, NDIM, fortran_data, patch, box, kernel_fcn);
+    double interp_diff = 0.0;
+    for (std::size_t k = 0; k < Q_fortran.size(); ++k)
+    {
+        interp_diff = std::max(interp_diff, std::abs(Q_fortran[k] - Q_templated[k]));
+    }
+
+    // Spread the same values with both implementations.
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    std::vector<double> Q_data(Q_depth * n_points);
+    for (double& v : Q_data) v = distribution(rng);
+    fortran_data->fillAll(0.0);
+    templated_data->fillAll(0.0);
+    use_templated_kernels(false);
+    LEInteractor::spread(fortran_data, Q_data, Q_depth, X_data, NDIM, patch, box, kernel_fcn);
+    use_templated_kernels(true);
+    LEInteractor::spread(templated_data, Q_data, Q_depth, X_data, NDIM, patch, box, kernel_fcn);
+    const double spread_diff = max_difference(get_array_data(fortran_data), get_array_data(templated_data));
+
+    out << kernel_fcn << ", " << data_name << ":\n"
+        << "  max interpolation difference = " << interp_diff << "\n"
+        << "  max spreading difference = " << spread_diff << "\n";
+}
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "interpolate_02.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", nullptr, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // All kernels with templated implementations.
+        const std::vector<std::string> kernel_fcns = { "PIECEWISE_LINEAR", "IB_3",      "IB_4",
+                                                       "IB_5",             "IB_6",      "BSPLINE_3",
+                                                       "BSPLINE_4",        "BSPLINE_5", "BSPLINE_6" };
+        int n_ghosts = 0;
+        for (const std::string& kernel_fcn : kernel_fcns)
+        {
+            n_ghosts = std::max(n_ghosts, LEInteractor::getMinimumGhostWidth(kernel_fcn));
+        }
+        const IntVector<NDIM> ghosts(n_ghosts);
+
+        // Create variables and register them with the variable database. Each
+        // variable has one context for each implementation.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> fortran_ctx = var_db->getContext("fortran");
+        Pointer<VariableContext> templated_ctx = var_db->getContext("templated");
+        std::vector<Pointer<Variable<NDIM> > > vars = {
+            new CellVariable<NDIM, double>("q_cc_1", 1),        new CellVariable<NDIM, double>("q_cc_ndim", NDIM),
+            new CellVariable<NDIM, double>("q_cc_n", NDIM + 1), new NodeVariable<NDIM, double>("q_nc_1", 1),
+            new NodeVariable<NDIM, double>("q_nc_ndim", NDIM),  new SideVariable<NDIM, double>("q_sc", 1)
+        };
+#if (NDIM == 3)
+        vars.push_back(new EdgeVariable<NDIM, double>("q_ec", 1));
+#endif
+        std::vector<int> fortran_idxs, templated_idxs;
+        for (const Pointer<Variable<NDIM> >& var : vars)
+        {
+            fortran_idxs.push_back(var_db->registerVariableAndContext(var, fortran_ctx, ghosts));
+            templated_idxs.push_back(var_db->registerVariableAndContext(var, templated_ctx, ghosts));
+        }
+
+        // Initialize the AMR patch hierarchy and allocate data.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        for (std::size_t k = 0; k < vars.size(); ++k)
+        {
+            level->allocatePatchData(fortran_idxs[k], 0.0);
+            level->allocatePatchData(templated_idxs[k], 0.0);
+        }
+
+        std::ofstream out("output");
+        std::mt19937 rng(42u);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+
+            // Pick random points in the patch interior.
+            const std::size_t n_points = 100;
+            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+            const double* const patch_x_lower = patch_geom->getXLower();
+            const double* const patch_x_upper = patch_geom->getXUpper();
+            std::vector<double> X_data(NDIM * n_points);
+            for (std::size_t k = 0; k < n_points; ++k)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    std::uniform_real_distribution<double> distribution(patch_x_lower[d], patch_x_upper[d]);
+                    X_data[NDIM * k + d] = distribution(rng);
+                }
+            }
+            out << "number of points = " << n_points << "\n";
+
+            for (const std::string& kernel_fcn : kernel_fcns)
+            {
+                using CellDataType = CellData<NDIM, double>;
+                using NodeDataType = NodeData<NDIM, double>;
+                using SideDataType = SideData<NDIM, double>;
+                compare_kernels<CellDataType>(
+                    out, kernel_fcn, "cell depth 1", fortran_idxs[0], templated_idxs[0], 1, X_data, patch, rng);
+                compare_kernels<CellDataType>(
+                    out, kernel_fcn, "cell depth NDIM", fortran_idxs[1], templated_idxs[1], NDIM, X_data, patch, rng);
+                compare_kernels<CellDataType>(out,
+                                              kernel_fcn,
+                                              "cell depth NDIM + 1",
+                                              fortran_idxs[2],
+                                              templated_idxs[2],
+                                              NDIM + 1,
+                                              X_data,
+                                              patch,
+                                              rng);
+                compare_kernels<NodeDataType>(
+                    out, kernel_fcn, "node depth 1", fortran_idxs[3], templated_idxs[3], 1, X_data, patch, rng);
+                compare_kernels<NodeDataType>(
+                    out, kernel_fcn, "node depth NDIM", fortran_idxs[4], templated_idxs[4], NDIM, X_data, patch, rng);
+                compare_kernels<SideDataType>(
+                    out, kernel_fcn, "side", fortran_idxs[5], templated_idxs[5], NDIM, X_data, patch, rng);
+#if (NDIM == 3)
+                compare_kernels<EdgeData<NDIM, double> >(
+                    out, kernel_fcn, "edge", fortran_idxs[6], templated_idxs[6], NDIM, X_data, patch, rng);
+#endif
+            }
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,674 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellVariable.h>
+#include <EdgeVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <NodeVariable.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/LData.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/LNode.h>
+#include <ibtk/LNodeSet.h>
+#include <ibtk/LNodeSetData.h>
+
+#ifdef IBTK_HAVE_LIBMESH
+#include <ibtk/FEDataManager.h>
+#include <ibtk/libmesh_utilities.h>
+
+#include <libmesh/equation_systems.h>
+#include <libmesh/explicit_system.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/petsc_vector.h>
+#include <libmesh/string_to_enum.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <random>
+#include <tuple>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// This file is the main driver for the spreading and interpolation
+// benchmarks. Unlike the tests in this directory, which only check the
+// correctness of the kernels, this program reports the throughput of
+// LEInteractor::interpolate() and LEInteractor::spread() for each kernel
+// function, data centering, data depth, and Lagrangian point density given in
+// the Benchmark database of the input file. When IBAMR is configured with
+// libMesh the same measurements are also made for
+// FEDataManager::interpWeighted() and FEDataManager::spread().
+//
+// Memory traffic is estimated from a simple model in which every point reads
+// its position and reads (interpolation) or reads and writes (spreading) each
+// Eulerian value in its stencil once. The model ignores cache reuse between
+// neighboring points, so the reported bandwidth is an upper bound on the
+// traffic to main memory and is only comparable between runs of this program.
+//
+// Since the output is machine-dependent the input files for this program use
+// the input2d and input3d suffixes so that they are not picked up by attest.
+
+namespace
+{
+using benchmark_clock = std::chrono::steady_clock;
+
+// All kernels except USER_DEFINED, which requires a callback.
+const std::vector<std::string> default_kernels = {
+    "PIECEWISE_CONSTANT", "DISCONTINUOUS_LINEAR", "PIECEWISE_LINEAR",     "PIECEWISE_CUBIC",
+    "IB_3",               "IB_4",                 "IB_4_W8",              "IB_5",
+    "IB_6",               "BSPLINE_3",            "BSPLINE_4",            "BSPLINE_5",
+    "BSPLINE_6",          "COMPOSITE_BSPLINE_32", "COMPOSITE_BSPLINE_43", "COMPOSITE_BSPLINE_54",
+    "COMPOSITE_BSPLINE_65"
+};
+
+struct BenchmarkResult
+{
+    double interp_time = 0.0;
+    double spread_time = 0.0;
+    int n_points = 0;
+    double bytes_per_interp = 0.0;
+    double bytes_per_spread = 0.0;
+};
+
+template <class T>
+std::vector<T>
+to_vector(const Array<T>& values)
+{
+    std::vector<T> result;
+    for (int k = 0; k < values.getSize(); ++k) result.push_back(values[k]);
+    return result;
+} // to_vector
+
+template <class T>
+double
+time_operation(T&& operation, const int num_repetitions)
+{
+    // Run the operation once so that the timings do not include first-touch
+    // costs (e.g., building the weight cache).
+    operation();
+    IBTK_MPI::barrier();
+    const auto start = benchmark_clock::now();
+    for (int k = 0; k < num_repetitions; ++k) operation();
+    const std::chrono::duration<double> elapsed = benchmark_clock::now() - start;
+    return IBTK_MPI::maxReduction(elapsed.count()) / num_repetitions;
+} // time_operation
+
+// Estimated number of bytes moved by one interpolation (or spread) of n_values
+// values at one Lagrangian point.
+double
+estimate_bytes_per_point(const std::string& kernel_fcn, const int n_values, const bool is_spread)
+{
+    const double n_stencil = std::pow(static_cast<double>(LEInteractor::getStencilSize(kernel_fcn)), NDIM);
+    return sizeof(double) * (NDIM + n_values + (is_spread ? 2.0 : 1.0) * n_stencil * n_values);
+} // estimate_bytes_per_point
+
+void
+print_header(std::ostream& os, const std::string& n_label)
+{
+    os << std::left << std::setw(8) << "path" << std::setw(22) << "kernel" << std::setw(7) << "center"
+       << std::setw(7) << "depth" << std::setw(10) << "density" << std::setw(12) << n_label << std::right
+       << std::setw(14) << "interp Mpt/s" << std::setw(14) << "interp GB/s" << std::setw(14) << "spread Mpt/s"
+       << std::setw(14) << "spread GB/s" << '\n';
+} // print_header
+
+void
+print_result(std::ostream& os,
+             const std::string& path,
+             const std::string& kernel_fcn,
+             const std::string& centering,
+             const int depth,
+             const double density,
+             const BenchmarkResult& result)
+{
+    const double n = static_cast<double>(result.n_points);
+    os << std::left << std::setw(8) << path << std::setw(22) << kernel_fcn << std::setw(7) << centering
+       << std::setw(7) << depth << std::setw(10) << density << std::setw(12) << result.n_points << std::right
+       << std::fixed << std::setprecision(3) << std::setw(14) << 1.0e-6 * n / result.interp_time << std::setw(14)
+       << 1.0e-9 * n * result.bytes_per_interp / result.interp_time << std::setw(14)
+       << 1.0e-6 * n / result.spread_time << std::setw(14)
+       << 1.0e-9 * n * result.bytes_per_spread / result.spread_time << '\n';
+    os.unsetf(std::ios_base::floatfield);
+    os << std::setprecision(6);
+} // print_result
+
+// Lagrangian points on one patch, stored both in the plain arrays used by
+// the std::vector overloads of LEInteractor and as an index set that refers
+// into the rank-wide LData objects.
+struct PatchPoints
+{
+    Pointer<Patch<NDIM> > patch;
+    std::vector<double> X;
+    Pointer<LNodeSetData> idx_data;
+};
+
+std::vector<PatchPoints>
+scatter_points(Pointer<PatchLevel<NDIM> > level,
+               const double points_per_cell,
+               const double cluster_fraction,
+               const double cluster_radius,
+               const int ghost_width,
+               const bool use_morton_ordering,
+               Pointer<LData>& X_data)
+{
+    std::mt19937 rng(42u + IBTK_MPI::getRank());
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::normal_distribution<double> normal(0.0, cluster_radius);
+
+    std::vector<PatchPoints> patch_points;
+    int n_local_points = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        PatchPoints points;
+        points.patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = points.patch->getBox();
+        const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = points.patch->getPatchGeometry();
+        const double* const x_lower = patch_geom->getXLower();
+        const double* const x_upper = patch_geom->getXUpper();
+
+        // A fraction of the points is drawn from a normal distribution
+        // centered on the patch to mimic structures that only occupy a small
+        // portion of the grid.
+        const int n_points = static_cast<int>(std::round(points_per_cell * patch_box.size()));
+        points.X.resize(NDIM * n_points);
+        for (int k = 0; k < n_points; ++k)
+        {
+            const bool in_cluster = uniform(rng) < cluster_fraction;
+            for (int d = 0; d < NDIM; ++d)
+            {
+                const double width = x_upper[d] - x_lower[d];
+                const double s = in_cluster ? std::min(std::max(0.5 + normal(rng), 0.0), 1.0 - 1.0e-8) : uniform(rng);
+                points.X[NDIM * k + d] = x_lower[d] + s * width;
+            }
+        }
+        n_local_points += n_points;
+        patch_points.push_back(std::move(points));
+    }
+
+    // Set up the index data in the same way as LDataManager, i.e., with local
+    // PETSc indices that are contiguous across the patches owned by this
+    // rank.
+    X_data = new LData("X", n_local_points, NDIM);
+    boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+    int local_idx = 0;
+    for (PatchPoints& points : patch_points)
+    {
+        const Box<NDIM>& patch_box = points.patch->getBox();
+        const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = points.patch->getPatchGeometry();
+        points.idx_data = new LNodeSetData(patch_box, IntVector<NDIM>(ghost_width));
+        const int n_points = static_cast<int>(points.X.size()) / NDIM;
+        for (int k = 0; k < n_points; ++k, ++local_idx)
+        {
+            const double* const X = &points.X[NDIM * k];
+            for (int d = 0; d < NDIM; ++d) X_array[local_idx][d] = X[d];
+            const CellIndex<NDIM> cell_idx = IndexUtilities::getCellIndex(X, patch_geom, patch_box);
+            if (!points.idx_data->isElement(cell_idx))
+            {
+                points.idx_data->appendItemPointer(cell_idx, new LNodeSet());
+            }
+            LNodeSet* const node_set = points.idx_data->getItem(cell_idx);
+            node_set->push_back(LNodeSet::value_type(new LNode(local_idx, local_idx, local_idx)));
+        }
+        points.idx_data->cacheLocalIndices(points.patch, IntVector<NDIM>(0), use_morton_ordering);
+    }
+    X_data->restoreArrays();
+    return patch_points;
+} // scatter_points
+
+template <class DataType>
+BenchmarkResult
+benchmark_points(const std::vector<PatchPoints>& patch_points,
+                 const int q_idx,
+                 const int Q_depth,
+                 const std::string& kernel_fcn,
+                 const int num_repetitions)
+{
+    BenchmarkResult result;
+    std::vector<std::vector<double> > Q(patch_points.size());
+    for (unsigned int k = 0; k < patch_points.size(); ++k)
+    {
+        const int n_points = static_cast<int>(patch_points[k].X.size()) / NDIM;
+        Q[k].assign(Q_depth * n_points, 1.0);
+        result.n_points += n_points;
+    }
+    result.n_points = IBTK_MPI::sumReduction(result.n_points);
+    result.bytes_per_interp = estimate_bytes_per_point(kernel_fcn, Q_depth, false);
+    result.bytes_per_spread = estimate_bytes_per_point(kernel_fcn, Q_depth, true);
+
+    result.interp_time = time_operation(
+        [&]()
+        {
+            for (unsigned int k = 0; k < patch_points.size(); ++k)
+            {
+                const PatchPoints& points = patch_points[k];
+                Pointer<DataType> q_data = points.patch->getPatchData(q_idx);
+                LEInteractor::interpolate(
+                    Q[k], Q_depth, points.X, NDIM, q_data, points.patch, points.patch->getBox(), kernel_fcn);
+            }
+        },
+        num_repetitions);
+    result.spread_time = time_operation(
+        [&]()
+        {
+            for (unsigned int k = 0; k < patch_points.size(); ++k)
+            {
+                const PatchPoints& points = patch_points[k];
+                Pointer<DataType> q_data = points.patch->getPatchData(q_idx);
+                LEInteractor::spread(
+                    q_data, Q[k], Q_depth, points.X, NDIM, points.patch, points.patch->getBox(), kernel_fcn);
+            }
+        },
+        num_repetitions);
+    return result;
+} // benchmark_points
+
+template <class DataType>
+BenchmarkResult
+benchmark_ldata(const std::vector<PatchPoints>& patch_points,
+                Pointer<LData> X_data,
+                const int q_idx,
+                const int Q_depth,
+                const std::string& kernel_fcn,
+                const int num_repetitions)
+{
+    BenchmarkResult result;
+    Pointer<LData> Q_data = new LData("Q", X_data->getLocalNodeCount(), Q_depth);
+    result.n_points = X_data->getGlobalNodeCount();
+    result.bytes_per_interp = estimate_bytes_per_point(kernel_fcn, Q_depth, false);
+    result.bytes_per_spread = estimate_bytes_per_point(kernel_fcn, Q_depth, true);
+
+    result.interp_time = time_operation(
+        [&]()
+        {
+            for (const PatchPoints& points : patch_points)
+            {
+                Pointer<DataType> q_data = points.patch->getPatchData(q_idx);
+                LEInteractor::interpolate(Q_data,
+                                          X_data,
+                                          points.idx_data,
+                                          q_data,
+                                          points.patch,
+                                          points.patch->getBox(),
+                                          IntVector<NDIM>(0),
+                                          kernel_fcn);
+            }
+        },
+        num_repetitions);
+    result.spread_time = time_operation(
+        [&]()
+        {
+            for (const PatchPoints& points : patch_points)
+            {
+                Pointer<DataType> q_data = points.patch->getPatchData(q_idx);
+                LEInteractor::spread(q_data,
+                                     Q_data,
+                                     X_data,
+                                     points.idx_data,
+                                     points.patch,
+                                     points.patch->getBox(),
+                                     IntVector<NDIM>(0),
+                                     kernel_fcn);
+            }
+        },
+        num_repetitions);
+    return result;
+} // benchmark_ldata
+
+template <class DataType>
+BenchmarkResult
+benchmark_centering(const std::string& path,
+                    const std::vector<PatchPoints>& patch_points,
+                    Pointer<LData> X_data,
+                    const int q_idx,
+                    const int Q_depth,
+                    const std::string& kernel_fcn,
+                    const int num_repetitions)
+{
+    if (path == "LDATA")
+    {
+        return benchmark_ldata<DataType>(patch_points, X_data, q_idx, Q_depth, kernel_fcn, num_repetitions);
+    }
+    return benchmark_points<DataType>(patch_points, q_idx, Q_depth, kernel_fcn, num_repetitions);
+} // benchmark_centering
+
+int
+allocate_variable(Pointer<PatchLevel<NDIM> > level,
+                  Pointer<hier::Variable<NDIM> > var,
+                  Pointer<VariableContext> ctx,
+                  const int ghost_width)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int idx = var_db->registerVariableAndContext(var, ctx, IntVector<NDIM>(ghost_width));
+    level->allocatePatchData(idx, 0.0);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<PatchData<NDIM> > data = level->getPatch(p())->getPatchData(idx);
+        if (Pointer<CellData<NDIM, double> > cc_data = data) cc_data->fillAll(1.0);
+        if (Pointer<NodeData<NDIM, double> > nc_data = data) nc_data->fillAll(1.0);
+        if (Pointer<SideData<NDIM, double> > sc_data = data) sc_data->fillAll(1.0);
+        if (Pointer<EdgeData<NDIM, double> > ec_data = data) ec_data->fillAll(1.0);
+    }
+    return idx;
+} // allocate_variable
+
+#ifdef IBTK_HAVE_LIBMESH
+void
+benchmark_fe_data(const LibMeshInit& init,
+                  Pointer<Database> fe_data_manager_db,
+                  Pointer<Database> bench_db,
+                  Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                  const std::vector<std::string>& kernels,
+                  const int cc_idx,
+                  const int sc_idx,
+                  const int ghost_width,
+                  const int num_repetitions)
+{
+    // Set up a block of elements in the middle of the domain.
+    ReplicatedMesh mesh(init.comm(), NDIM);
+    const int n_elems = bench_db->getIntegerWithDefault("fe_num_elems", 16);
+    const auto elem_type = Utility::string_to_enum<ElemType>(
+        bench_db->getStringWithDefault("fe_elem_type", NDIM == 2 ? "QUAD9" : "HEX27"));
+    if (NDIM == 2)
+        MeshTools::Generation::build_square(mesh, n_elems, n_elems, 0.25, 0.75, 0.25, 0.75, elem_type);
+    else
+        MeshTools::Generation::build_cube(
+            mesh, n_elems, n_elems, n_elems, 0.25, 0.75, 0.25, 0.75, 0.25, 0.75, elem_type);
+    const libMesh::Order order = (*mesh.elements_begin())->default_order();
+
+    EquationSystems equation_systems(mesh);
+    auto& X_system = equation_systems.add_system<ExplicitSystem>("coordinates");
+    auto& F_system = equation_systems.add_system<ExplicitSystem>("F");
+    auto& Q_system = equation_systems.add_system<ExplicitSystem>("Q");
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        X_system.add_variable("X_" + std::to_string(d), order, LAGRANGE);
+        F_system.add_variable("F_" + std::to_string(d), order, LAGRANGE);
+    }
+    Q_system.add_variable("Q", order, LAGRANGE);
+    equation_systems.init();
+
+    const unsigned int X_sys_num = X_system.number();
+    for (const libMesh::Node* const node : mesh.local_node_ptr_range())
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X_system.solution->set(node->dof_number(X_sys_num, d, 0), (*node)(d));
+        }
+    }
+    X_system.solution->close();
+    *F_system.solution = 1.0;
+    *Q_system.solution = 1.0;
+
+    const std::string quad_order_str = bench_db->getStringWithDefault("fe_quad_order", "FIFTH");
+    const libMesh::Order quad_order = Utility::string_to_enum<libMesh::Order>(quad_order_str);
+    const double point_density = bench_db->getDoubleWithDefault("fe_point_density", 2.0);
+    const bool use_adaptive_quadrature = bench_db->getBoolWithDefault("fe_use_adaptive_quadrature", true);
+
+    auto fe_data = std::make_shared<FEData>("fe_benchmark_data", equation_systems, false);
+    const FEDataManager::InterpSpec default_interp_spec(
+        "IB_4", QGAUSS, quad_order, use_adaptive_quadrature, point_density, false, false);
+    const FEDataManager::SpreadSpec default_spread_spec(
+        "IB_4", QGAUSS, quad_order, use_adaptive_quadrature, point_density, false);
+    FEDataManager* fe_data_manager = FEDataManager::getManager(fe_data,
+                                                               "fe_benchmark_manager",
+                                                               fe_data_manager_db,
+                                                               1,
+                                                               default_interp_spec,
+                                                               default_spread_spec,
+                                                               FEDataManager::WorkloadSpec(),
+                                                               IntVector<NDIM>(ghost_width),
+                                                               nullptr,
+                                                               false);
+    fe_data_manager->setCurrentCoordinatesSystemName(X_system.name());
+    fe_data_manager->setPatchHierarchy(patch_hierarchy);
+    fe_data_manager->reinitElementMappings();
+
+    std::unique_ptr<PetscVector<double> > X_vec = fe_data_manager->buildIBGhostedVector(X_system.name());
+    std::unique_ptr<PetscVector<double> > F_vec = fe_data_manager->buildIBGhostedVector(F_system.name());
+    std::unique_ptr<PetscVector<double> > Q_vec = fe_data_manager->buildIBGhostedVector(Q_system.name());
+    copy_and_synch(*X_system.solution, *X_vec, /*close_v_in*/ false);
+    copy_and_synch(*F_system.solution, *F_vec, /*close_v_in*/ false);
+    copy_and_synch(*Q_system.solution, *Q_vec, /*close_v_in*/ false);
+
+    const int n_elems_global = mesh.n_active_elem();
+    pout << "\nFEDataManager benchmark: " << n_elems_global << " " << Utility::enum_to_string(elem_type)
+         << " elements, " << quad_order_str << " order quadrature"
+         << (use_adaptive_quadrature ? " (adaptive, point density " + std::to_string(point_density) + ")" : "")
+         << "\nthroughput is reported in elements per second\n\n";
+    print_header(pout, "n_elems");
+    for (const std::string& kernel_fcn : kernels)
+    {
+        const FEDataManager::InterpSpec interp_spec(
+            kernel_fcn, QGAUSS, quad_order, use_adaptive_quadrature, point_density, false, false);
+        const FEDataManager::SpreadSpec spread_spec(
+            kernel_fcn, QGAUSS, quad_order, use_adaptive_quadrature, point_density, false);
+        const std::array<std::tuple<std::string, int, PetscVector<double>*, std::string>, 2> fields = {
+            { std::make_tuple("CELL", cc_idx, Q_vec.get(), Q_system.name()),
+              std::make_tuple("SIDE", sc_idx, F_vec.get(), F_system.name()) }
+        };
+        for (const auto& field : fields)
+        {
+            const int f_idx = std::get<1>(field);
+            PetscVector<double>& vec = *std::get<2>(field);
+            const std::string& system_name = std::get<3>(field);
+            BenchmarkResult result;
+            // Report elements instead of quadrature points since the number
+            // of quadrature points depends on the deformation.
+            result.n_points = n_elems_global;
+            result.interp_time = time_operation(
+                [&]() { fe_data_manager->interpWeighted(f_idx, vec, *X_vec, system_name, interp_spec); },
+                num_repetitions);
+            result.spread_time = time_operation(
+                [&]() { fe_data_manager->spread(f_idx, vec, *X_vec, system_name, spread_spec); }, num_repetitions);
+            print_result(pout, "FE", kernel_fcn, std::get<0>(field), 1, point_density, result);
+        }
+    }
+} // benchmark_fe_data
+#endif
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "spread_interp_benchmark.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        Pointer<Database> bench_db = app_initializer->getComponentDatabase("Benchmark");
+        if (input_db->isDatabase("LEInteractor"))
+        {
+            LEInteractor::setFromDatabase(input_db->getDatabase("LEInteractor"));
+        }
+
+        const std::vector<std::string> kernels =
+            bench_db->keyExists("kernels") ? to_vector(bench_db->getStringArray("kernels")) : default_kernels;
+        // LEInteractor only supports edge-centered data in three dimensions.
+        std::vector<std::string> default_centerings{ "CELL", "NODE", "SIDE" };
+        if (NDIM == 3) default_centerings.push_back("EDGE");
+        const std::vector<std::string> centerings = bench_db->keyExists("centerings") ?
+                                                        to_vector(bench_db->getStringArray("centerings")) :
+                                                        default_centerings;
+        const std::vector<std::string> paths = bench_db->keyExists("paths") ?
+                                                   to_vector(bench_db->getStringArray("paths")) :
+                                                   std::vector<std::string>{ "POINTS", "LDATA", "FE" };
+        const std::vector<int> depths =
+            bench_db->keyExists("depths") ? to_vector(bench_db->getIntegerArray("depths")) : std::vector<int>{ 1 };
+        const std::vector<double> densities = bench_db->keyExists("points_per_cell") ?
+                                                  to_vector(bench_db->getDoubleArray("points_per_cell")) :
+                                                  std::vector<double>{ 1.0 };
+        const double cluster_fraction = bench_db->getDoubleWithDefault("cluster_fraction", 0.0);
+        const double cluster_radius = bench_db->getDoubleWithDefault("cluster_radius", 0.1);
+        const int num_repetitions = bench_db->getIntegerWithDefault("num_repetitions", 10);
+        const bool use_morton_ordering = bench_db->getBoolWithDefault("use_morton_ordering", false);
+        const auto uses_path = [&](const std::string& path)
+        { return std::find(paths.begin(), paths.end(), path) != paths.end(); };
+
+        int ghost_width = 0;
+        for (const std::string& kernel_fcn : kernels)
+        {
+            if (!LEInteractor::isKnownKernel(kernel_fcn) || kernel_fcn == "USER_DEFINED")
+            {
+                TBOX_ERROR("spread_interp_benchmark: unsupported kernel function " << kernel_fcn << std::endl);
+            }
+            ghost_width = std::max(ghost_width, LEInteractor::getMinimumGhostWidth(kernel_fcn));
+        }
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", nullptr, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+
+        // Create variables and allocate data for every centering and depth.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        std::map<std::pair<std::string, int>, int> data_idxs;
+        for (const std::string& centering : centerings)
+        {
+            // LEInteractor only supports side- and edge-centered data with
+            // depth one, which are interpolated to NDIM values per point.
+            const bool is_vector_centering = centering == "SIDE" || centering == "EDGE";
+            for (unsigned int k = 0; k < (is_vector_centering ? 1 : depths.size()); ++k)
+            {
+                const int depth = is_vector_centering ? 1 : depths[k];
+                const std::string name = "q_" + centering + "_" + std::to_string(depth);
+                Pointer<hier::Variable<NDIM> > var;
+                if (centering == "CELL")
+                    var = new CellVariable<NDIM, double>(name, depth);
+                else if (centering == "NODE")
+                    var = new NodeVariable<NDIM, double>(name, depth);
+                else if (centering == "SIDE")
+                    var = new SideVariable<NDIM, double>(name, depth);
+                else if (centering == "EDGE" && NDIM == 3)
+                    var = new EdgeVariable<NDIM, double>(name, depth);
+                else if (centering == "EDGE")
+                    TBOX_ERROR("spread_interp_benchmark: edge-centered data are only supported for NDIM == 3"
+                               << std::endl);
+                else
+                    TBOX_ERROR("spread_interp_benchmark: unknown data centering " << centering << std::endl);
+                data_idxs[std::make_pair(centering, depth)] = allocate_variable(level, var, ctx, ghost_width);
+            }
+        }
+
+        pout << "spread_interp_benchmark: " << IBTK_MPI::getNodes() << " processes, " << level->getNumberOfPatches()
+             << " patches, " << num_repetitions << " repetitions, cluster fraction " << cluster_fraction
+             << ", cluster radius " << cluster_radius << "\n";
+        LEInteractor::printClassData(pout);
+        pout << "\nthroughput is reported in Lagrangian points per second\n\n";
+        print_header(pout, "n_points");
+        for (const double density : densities)
+        {
+            Pointer<LData> X_data;
+            const std::vector<PatchPoints> patch_points = scatter_points(
+                level, density, cluster_fraction, cluster_radius, ghost_width, use_morton_ordering, X_data);
+            for (const std::string& kernel_fcn : kernels)
+            {
+                for (const auto& entry : data_idxs)
+                {
+                    const std::string& centering = entry.first.first;
+                    const int depth = entry.first.second;
+                    const int q_idx = entry.second;
+                    const int Q_depth = (centering == "SIDE" || centering == "EDGE") ? NDIM : depth;
+                    const std::array<std::string, 2> point_paths = { { "POINTS", "LDATA" } };
+                    for (const std::string& path : point_paths)
+                    {
+                        if (!uses_path(path)) continue;
+                        BenchmarkResult result;
+                        if (centering == "CELL")
+                            result = benchmark_centering<CellData<NDIM, double> >(
+                                path, patch_points, X_data, q_idx, Q_depth, kernel_fcn, num_repetitions);
+                        else if (centering == "NODE")
+                            result = benchmark_centering<NodeData<NDIM, double> >(
+                                path, patch_points, X_data, q_idx, Q_depth, kernel_fcn, num_repetitions);
+                        else if (centering == "SIDE")
+                            result = benchmark_centering<SideData<NDIM, double> >(
+                                path, patch_points, X_data, q_idx, Q_depth, kernel_fcn, num_repetitions);
+                        else
+                            result = benchmark_centering<EdgeData<NDIM, double> >(
+                                path, patch_points, X_data, q_idx, Q_depth, kernel_fcn, num_repetitions);
+                        print_result(pout, path, kernel_fcn, centering, depth, density, result);
+                    }
+                }
+            }
+        }
+
+        if (uses_path("FE"))
+        {
+#ifdef IBTK_HAVE_LIBMESH
+            const auto cc_it = data_idxs.find(std::make_pair(std::string("CELL"), 1));
+            const auto sc_it = data_idxs.find(std::make_pair(std::string("SIDE"), 1));
+            if (cc_it == data_idxs.end() || sc_it == data_idxs.end())
+            {
+                TBOX_ERROR("spread_interp_benchmark: the FE benchmark requires CELL data with depth 1 and SIDE data"
+                           << std::endl);
+            }
+            benchmark_fe_data(ibtk_init.getLibMeshInit(),
+                              app_initializer->getComponentDatabase("FEDataManager"),
+                              bench_db,
+                              patch_hierarchy,
+                              kernels,
+                              cc_it->second,
+                              sc_it->second,
+                              ghost_width,
+                              num_repetitions);
+#else
+            pout << "\nskipping the FEDataManager benchmark since IBAMR was configured without libMesh\n";
+#endif
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main